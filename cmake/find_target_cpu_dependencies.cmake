@@ -0,0 +1,2 @@
+# CPU Specific CMake
+# The CPU target has no dependencies beyond the host toolchain; OpenMP, when enabled, is found by QUDAConfig.cmake
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/**
+   @file alloc_trace.h
+
+   @section Tracing of the memory allocations, which is enabled by
+   setting the environment variable QUDA_ENABLE_ALLOC_TRACE=1.  Each
+   allocation is attributed to its call site and to the category of
+   the object being created, e.g., a gauge, clover or spinor field, a
+   ghost buffer or a multigrid transfer operator, where categories
+   nest so that the fields of each multigrid level are kept apart.
+   The live and peak bytes are aggregated per call site and per
+   category, separately for device and host memory, and the sequence
+   of allocation events is recorded, such that the composition of the
+   memory footprint at any point can be reconstructed.  Blocks handed
+   out by the memory pools are attributed to the fields that requested
+   them, rather than to the slabs obtained by the pools.
+ */
+
+namespace quda
+{
+
+  namespace alloc_trace
+  {
+
+    /**
+       @brief Whether allocations are traced, which is set with the
+       QUDA_ENABLE_ALLOC_TRACE environment variable
+     */
+    bool enabled();
+
+    /**
+       Scoped category of the allocations made by this thread, which is
+       appended to the enclosing category for the lifetime of this
+       object.  Re-entering the innermost category has no effect, such
+       that functions that open a category may call one another.
+     */
+    class category_scope
+    {
+      bool active;
+
+    public:
+      /**
+         @brief Enter a category
+         @param[in] name Name of the category
+       */
+      category_scope(const std::string &name);
+
+      /**
+         @brief Leave the category
+       */
+      ~category_scope();
+
+      category_scope(const category_scope &) = delete;
+      category_scope &operator=(const category_scope &) = delete;
+    };
+
+    /**
+       @brief Record an allocation
+       @param[in] kind The type of memory allocated, e.g., device or pinned
+       @param[in] device Whether this is device memory, else host memory
+       @param[in] ptr The pointer allocated
+       @param[in] bytes The size of the allocation
+       @param[in] func Function of the call site
+       @param[in] file File of the call site
+       @param[in] line Line of the call site
+     */
+    void record_alloc(const char *kind, bool device, void *ptr, size_t bytes, const char *func, const char *file,
+                      int line);
+
+    /**
+       @brief Record the release of an allocation, where pointers that
+       have not been recorded are ignored
+       @param[in] ptr The pointer freed
+     */
+    void record_free(void *ptr);
+
+    /**
+       @brief Print the live and peak bytes of the categories, and of
+       the call sites holding the most device memory, e.g., to
+       diagnose an allocation failure
+       @param[in] n_site The number of call sites to print
+     */
+    void print_summary(int n_site = 10);
+
+    /**
+       @brief Write the aggregates per call site and per category, and
+       the sequence of allocation events, of this process to the files
+       <prefix>alloc_sites_<rank>.tsv, <prefix>alloc_categories_<rank>.tsv
+       and <prefix>alloc_trace_<rank>.tsv
+       @param[in] prefix The path prefix of the files
+       @param[in] rank The rank of this process
+     */
+    void save(const std::string &prefix, int rank);
+
+  } // namespace alloc_trace
+
+} // namespace quda
@@ -254,6 +254,19 @@ namespace quda {
     void tripleCGUpdate(double a, double b, const ColorSpinorField &x,
 			ColorSpinorField &y, ColorSpinorField &z, ColorSpinorField &w);
 
+    /**
+       @brief Pipelined CG direction update: y = x + b * y, w = z + b * w,
+       z -= a * y, where the update of z uses the new y
+       @param[in] a scalar multiplier
+       @param[in] b scalar multiplier
+       @param[in] x input vector (q = A w)
+       @param[in,out] y update vector (z = A s)
+       @param[in,out] z update vector (s = A p)
+       @param[in,out] w update vector (s_w, the search direction of w)
+    */
+    void pipeCGUpdate(double a, double b, const ColorSpinorField &x, ColorSpinorField &y, ColorSpinorField &z,
+                      ColorSpinorField &w);
+
     // reduction kernels - defined in reduce_quda.cu
 
     /**
@@ -471,6 +484,22 @@ namespace quda {
     double quadrupleCG3UpdateNorm(double a, double b, ColorSpinorField &x, ColorSpinorField &y,
                                   ColorSpinorField &z, ColorSpinorField &w, const ColorSpinorField &v);
 
+    /**
+       @brief Pipelined CG solution update: y = z + b * y, x += a * y,
+       z -= a * w, returning (||z||^2, Re(v, z)).  Both results are
+       computed from the updated z in the same pass.
+       @param[in] a scalar multiplier
+       @param[in] b scalar multiplier
+       @param[in,out] x update vector (solution)
+       @param[in,out] y update vector (search direction p)
+       @param[in,out] z update vector (residual r)
+       @param[in] w input vector (s = A p)
+       @param[in] v input vector (w = A r)
+       @return (||z||^2, Re(v, z))
+    */
+    double2 pipeCGUpdateNorm(double a, double b, ColorSpinorField &x, ColorSpinorField &y, ColorSpinorField &z,
+                             const ColorSpinorField &w, const ColorSpinorField &v);
+
     // multi-blas kernels - defined in multi_blas.cu
 
     /**
@@ -625,6 +625,27 @@ namespace quda
     */
     void sendStart(int d, const qudaStream_t &stream, bool gdr = false, bool remote_write = false);
 
+    /**
+       @brief Initiate the halo communication receives of all
+       partitioned dimensions that are enabled.  Peer-to-peer faces
+       are started individually, and all other faces are started as a
+       single persistent message set.
+       @param[in] comm_dim Which dimensions to receive in
+       @param[in] gdr Whether we are using GDR on the receive side
+    */
+    void recvStartAll(const int *comm_dim, bool gdr = false);
+
+    /**
+       @brief Initiate the halo communication sends of all
+       non-peer-to-peer faces of the partitioned dimensions that are
+       enabled as a single persistent message set.  Peer-to-peer faces
+       must still be sent with sendStart since they are tied to a
+       stream.
+       @param[in] comm_dim Which dimensions to send in
+       @param[in] gdr Whether we are using GDR on the send side
+    */
+    void sendStartAll(const int *comm_dim, bool gdr = false);
+
     /**
        @brief Initiate halo communication
        @param[in] d d=[2*dim+dir], where dim is dimension and dir is
@@ -834,7 +834,7 @@ namespace quda
     class FieldOrderCB : public GhostOrder<Float, nSpin_, nColor_, nVec, order, storeFloat, ghostFloat, disable_ghost>
     {
       static_assert((block_float && nVec == 1) || !block_float, "Not supported");
-      using GhostOrder = GhostOrder<Float, nSpin_, nColor_, nVec, order, storeFloat, ghostFloat, disable_ghost>;
+      using GhostAccessor = GhostOrder<Float, nSpin_, nColor_, nVec, order, storeFloat, ghostFloat, disable_ghost>;
       using norm_t = float;
 
     public:
@@ -859,7 +859,7 @@ namespace quda
        * @param field The field that we are accessing
        */
       FieldOrderCB(const ColorSpinorField &field, int nFace = 1, void *const v_ = 0, void *const *ghost_ = 0) :
-        GhostOrder(field, nFace, ghost_), volumeCB(field.VolumeCB()), accessor(field)
+        GhostAccessor(field, nFace, ghost_), volumeCB(field.VolumeCB()), accessor(field)
       {
         v.v = v_ ? static_cast<complex<storeFloat> *>(const_cast<void *>(v_)) :
                    static_cast<complex<storeFloat> *>(const_cast<void *>(field.V()));
@@ -885,7 +885,7 @@ namespace quda
           v.scale = static_cast<Float>(std::numeric_limits<storeFloat>::max() / max);
           v.scale_inv = static_cast<Float>(max / std::numeric_limits<storeFloat>::max());
         }
-        if constexpr (GhostOrder::supports_ghost_zone) GhostOrder::resetScale(max);
+        if constexpr (GhostAccessor::supports_ghost_zone) GhostAccessor::resetScale(max);
       }
 
       /**
@@ -1054,7 +1054,7 @@ namespace quda
       static constexpr int M_ghost = length_ghost / N_ghost;
       using Accessor = FloatNOrder<Float, Ns, Nc, N, spin_project, huge_alloc>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using Complex = complex<real>;
       using Vector = typename VectorType<Float, N>::type;
       using GhostVector = typename VectorType<Float, N_ghost>::type;
       using AllocInt = typename AllocType<huge_alloc>::type;
@@ -1099,7 +1099,7 @@ namespace quda
         }
       }
 
-      __device__ __host__ inline void load(complex out[length / 2], int x, int parity = 0) const
+      __device__ __host__ inline void load(Complex out[length / 2], int x, int parity = 0) const
       {
         real v[length];
         norm_type nrm = isFixed<Float>::value ? vector_load<float>(norm, x + parity * norm_offset) : 0.0;
@@ -1114,10 +1114,10 @@ namespace quda
         }
 
 #pragma unroll
-        for (int i = 0; i < length / 2; i++) out[i] = complex(v[2 * i + 0], v[2 * i + 1]);
+        for (int i = 0; i < length / 2; i++) out[i] = Complex(v[2 * i + 0], v[2 * i + 1]);
       }
 
-      __device__ __host__ inline void save(const complex in[length / 2], int x, int parity = 0) const
+      __device__ __host__ inline void save(const Complex in[length / 2], int x, int parity = 0) const
       {
         real v[length];
 
@@ -1168,7 +1168,7 @@ namespace quda
         return colorspinor_wrapper<real, Accessor>(*this, x_cb, parity);
       }
 
-      __device__ __host__ inline void loadGhost(complex out[length_ghost / 2], int x, int dim, int dir, int parity = 0) const
+      __device__ __host__ inline void loadGhost(Complex out[length_ghost / 2], int x, int dim, int dir, int parity = 0) const
       {
         real v[length_ghost];
         norm_type nrm
@@ -1184,10 +1184,10 @@ namespace quda
         }
 
 #pragma unroll
-        for (int i = 0; i < length_ghost / 2; i++) out[i] = complex(v[2 * i + 0], v[2 * i + 1]);
+        for (int i = 0; i < length_ghost / 2; i++) out[i] = Complex(v[2 * i + 0], v[2 * i + 1]);
       }
 
-      __device__ __host__ inline void saveGhost(const complex in[length_ghost / 2], int x, int dim, int dir,
+      __device__ __host__ inline void saveGhost(const Complex in[length_ghost / 2], int x, int dim, int dir,
                                                 int parity = 0) const
       {
         real v[length_ghost];
@@ -1285,7 +1285,7 @@ namespace quda
       static constexpr int length_ghost = 2 * Ns * Nc;
       using Accessor = FloatNOrder<Float, Ns, Nc, N_, spin_project, huge_alloc>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using Complex = complex<real>;
       using Vector = int4;      // 128-bit packed type
       using GhostVector = int4; // 128-bit packed type
       using AllocInt = typename AllocType<huge_alloc>::type;
@@ -1320,7 +1320,7 @@ namespace quda
         }
       }
 
-      __device__ __host__ inline void load(complex out[length / 2], int x, int parity = 0) const
+      __device__ __host__ inline void load(Complex out[length / 2], int x, int parity = 0) const
       {
         real v[length];
         Vector vecTmp = vector_load<Vector>(field, parity * offset + x);
@@ -1334,10 +1334,10 @@ namespace quda
         for (int i = 0; i < length; i++) copy_and_scale(v[i], reinterpret_cast<Float *>(&vecTmp)[i], nrm);
 
 #pragma unroll
-        for (int i = 0; i < length / 2; i++) out[i] = complex(v[2 * i + 0], v[2 * i + 1]);
+        for (int i = 0; i < length / 2; i++) out[i] = Complex(v[2 * i + 0], v[2 * i + 1]);
       }
 
-      __device__ __host__ inline void save(const complex in[length / 2], int x, int parity = 0) const
+      __device__ __host__ inline void save(const Complex in[length / 2], int x, int parity = 0) const
       {
         real v[length];
 
@@ -1385,7 +1385,7 @@ namespace quda
         return colorspinor_wrapper<real, Accessor>(*this, x_cb, parity);
       }
 
-      __device__ __host__ inline void loadGhost(complex out[length_ghost / 2], int x, int dim, int dir, int parity = 0) const
+      __device__ __host__ inline void loadGhost(Complex out[length_ghost / 2], int x, int dim, int dir, int parity = 0) const
       {
         real v[length_ghost];
         GhostVector vecTmp = vector_load<GhostVector>(ghost[2 * dim + dir], parity * faceVolumeCB[dim] + x);
@@ -1398,10 +1398,10 @@ namespace quda
         for (int i = 0; i < length_ghost; i++) copy_and_scale(v[i], reinterpret_cast<Float *>(&vecTmp)[i], nrm);
 
 #pragma unroll
-        for (int i = 0; i < length_ghost / 2; i++) out[i] = complex(v[2 * i + 0], v[2 * i + 1]);
+        for (int i = 0; i < length_ghost / 2; i++) out[i] = Complex(v[2 * i + 0], v[2 * i + 1]);
       }
 
-      __device__ __host__ inline void saveGhost(const complex in[length_ghost / 2], int x, int dim, int dir,
+      __device__ __host__ inline void saveGhost(const Complex in[length_ghost / 2], int x, int dim, int dir,
                                                 int parity = 0) const
       {
         real v[length_ghost];
@@ -1480,7 +1480,7 @@ namespace quda
     template <typename Float, int Ns, int Nc> struct SpaceColorSpinorOrder {
       using Accessor = SpaceColorSpinorOrder<Float, Ns, Nc>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using Complex = complex<real>;
       static const int length = 2 * Ns * Nc;
       Float *field;
       size_t offset;
@@ -1501,26 +1501,26 @@ namespace quda
         }
       }
 
-      __device__ __host__ inline void load(complex v[length / 2], int x, int parity = 0) const
+      __device__ __host__ inline void load(Complex v[length / 2], int x, int parity = 0) const
       {
         auto in = &field[(parity * volumeCB + x) * length];
-        complex v_[length / 2];
-        block_load<complex, length / 2>(v_, reinterpret_cast<const complex *>(in));
+        Complex v_[length / 2];
+        block_load<Complex, length / 2>(v_, reinterpret_cast<const Complex *>(in));
 
         for (int s = 0; s < Ns; s++) {
           for (int c = 0; c < Nc; c++) { v[s * Nc + c] = v_[c * Ns + s]; }
         }
       }
 
-      __device__ __host__ inline void save(const complex v[length / 2], int x, int parity = 0) const
+      __device__ __host__ inline void save(const Complex v[length / 2], int x, int parity = 0) const
       {
         auto out = &field[(parity * volumeCB + x) * length];
-        complex v_[length / 2];
+        Complex v_[length / 2];
         for (int s = 0; s < Ns; s++) {
           for (int c = 0; c < Nc; c++) { v_[c * Ns + s] = v[s * Nc + c]; }
         }
 
-        block_store<complex, length / 2>(reinterpret_cast<complex *>(out), v_);
+        block_store<Complex, length / 2>(reinterpret_cast<Complex *>(out), v_);
       }
 
       /**
@@ -1537,18 +1537,18 @@ namespace quda
         return colorspinor_wrapper<real, Accessor>(*this, x_cb, parity);
       }
 
-      __device__ __host__ inline void loadGhost(complex v[length / 2], int x, int dim, int dir, int parity = 0) const
+      __device__ __host__ inline void loadGhost(Complex v[length / 2], int x, int dim, int dir, int parity = 0) const
       {
         for (int s = 0; s < Ns; s++) {
           for (int c = 0; c < Nc; c++) {
             v[s * Nc + c]
-              = complex(ghost[2 * dim + dir][(((parity * faceVolumeCB[dim] + x) * Nc + c) * Ns + s) * 2 + 0],
+              = Complex(ghost[2 * dim + dir][(((parity * faceVolumeCB[dim] + x) * Nc + c) * Ns + s) * 2 + 0],
                         ghost[2 * dim + dir][(((parity * faceVolumeCB[dim] + x) * Nc + c) * Ns + s) * 2 + 1]);
           }
         }
       }
 
-      __device__ __host__ inline void saveGhost(const complex v[length / 2], int x, int dim, int dir, int parity = 0) const
+      __device__ __host__ inline void saveGhost(const Complex v[length / 2], int x, int dim, int dir, int parity = 0) const
       {
         for (int s = 0; s < Ns; s++) {
           for (int c = 0; c < Nc; c++) {
@@ -1564,7 +1564,7 @@ namespace quda
     template <typename Float, int Ns, int Nc> struct SpaceSpinorColorOrder {
       using Accessor = SpaceSpinorColorOrder<Float, Ns, Nc>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using Complex = complex<real>;
       static const int length = 2 * Ns * Nc;
       Float *field;
       size_t offset;
@@ -1585,16 +1585,16 @@ namespace quda
         }
       }
 
-      __device__ __host__ inline void load(complex v[length / 2], int x, int parity = 0) const
+      __device__ __host__ inline void load(Complex v[length / 2], int x, int parity = 0) const
       {
         auto in = &field[(parity * volumeCB + x) * length];
-        block_load<complex, length / 2>(v, reinterpret_cast<const complex *>(in));
+        block_load<Complex, length / 2>(v, reinterpret_cast<const Complex *>(in));
       }
 
-      __device__ __host__ inline void save(const complex v[length / 2], int x, int parity = 0) const
+      __device__ __host__ inline void save(const Complex v[length / 2], int x, int parity = 0) const
       {
         auto out = &field[(parity * volumeCB + x) * length];
-        block_store<complex, length / 2>(reinterpret_cast<complex *>(out), v);
+        block_store<Complex, length / 2>(reinterpret_cast<Complex *>(out), v);
       }
 
       /**
@@ -1611,18 +1611,18 @@ namespace quda
         return colorspinor_wrapper<real, Accessor>(*this, x_cb, parity);
       }
 
-      __device__ __host__ inline void loadGhost(complex v[length / 2], int x, int dim, int dir, int parity = 0) const
+      __device__ __host__ inline void loadGhost(Complex v[length / 2], int x, int dim, int dir, int parity = 0) const
       {
         for (int s = 0; s < Ns; s++) {
           for (int c = 0; c < Nc; c++) {
             v[s * Nc + c]
-              = complex(ghost[2 * dim + dir][(((parity * faceVolumeCB[dim] + x) * Ns + s) * Nc + c) * 2 + 0],
+              = Complex(ghost[2 * dim + dir][(((parity * faceVolumeCB[dim] + x) * Ns + s) * Nc + c) * 2 + 0],
                         ghost[2 * dim + dir][(((parity * faceVolumeCB[dim] + x) * Ns + s) * Nc + c) * 2 + 1]);
           }
         }
       }
 
-      __device__ __host__ inline void saveGhost(const complex v[length / 2], int x, int dim, int dir, int parity = 0) const
+      __device__ __host__ inline void saveGhost(const Complex v[length / 2], int x, int dim, int dir, int parity = 0) const
       {
         for (int s = 0; s < Ns; s++) {
           for (int c = 0; c < Nc; c++) {
@@ -1639,7 +1639,7 @@ namespace quda
     template <typename Float, int Ns, int Nc> struct PaddedSpaceSpinorColorOrder {
       using Accessor = PaddedSpaceSpinorColorOrder<Float, Ns, Nc>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using Complex = complex<real>;
       static const int length = 2 * Ns * Nc;
       Float *field;
       size_t offset;
@@ -1687,18 +1687,18 @@ namespace quda
         return linkIndex(coord, exDim);
       }
 
-      __device__ __host__ inline void load(complex v[length / 2], int x, int parity = 0) const
+      __device__ __host__ inline void load(Complex v[length / 2], int x, int parity = 0) const
       {
         int y = getPaddedIndex(x, parity);
         auto in = &field[(parity * exVolumeCB + y) * length];
-        block_load<complex, length / 2>(v, reinterpret_cast<const complex *>(in));
+        block_load<Complex, length / 2>(v, reinterpret_cast<const Complex *>(in));
       }
 
-      __device__ __host__ inline void save(const complex v[length / 2], int x, int parity = 0) const
+      __device__ __host__ inline void save(const Complex v[length / 2], int x, int parity = 0) const
       {
         int y = getPaddedIndex(x, parity);
         auto out = &field[(parity * exVolumeCB + y) * length];
-        block_store<complex, length / 2>(reinterpret_cast<complex *>(out), v);
+        block_store<Complex, length / 2>(reinterpret_cast<Complex *>(out), v);
       }
 
       /**
@@ -1715,18 +1715,18 @@ namespace quda
         return colorspinor_wrapper<real, Accessor>(*this, x_cb, parity);
       }
 
-      __device__ __host__ inline void loadGhost(complex v[length / 2], int x, int dim, int dir, int parity = 0) const
+      __device__ __host__ inline void loadGhost(Complex v[length / 2], int x, int dim, int dir, int parity = 0) const
       {
         for (int s = 0; s < Ns; s++) {
           for (int c = 0; c < Nc; c++) {
             v[s * Nc + c]
-              = complex(ghost[2 * dim + dir][(((parity * faceVolumeCB[dim] + x) * Ns + s) * Nc + c) * 2 + 0],
+              = Complex(ghost[2 * dim + dir][(((parity * faceVolumeCB[dim] + x) * Ns + s) * Nc + c) * 2 + 0],
                         ghost[2 * dim + dir][(((parity * faceVolumeCB[dim] + x) * Ns + s) * Nc + c) * 2 + 1]);
           }
         }
       }
 
-      __device__ __host__ inline void saveGhost(const complex v[length / 2], int x, int dim, int dir, int parity = 0) const
+      __device__ __host__ inline void saveGhost(const Complex v[length / 2], int x, int dim, int dir, int parity = 0) const
       {
         for (int s = 0; s < Ns; s++) {
           for (int c = 0; c < Nc; c++) {
@@ -1742,7 +1742,7 @@ namespace quda
     template <typename Float, int Ns, int Nc> struct QDPJITDiracOrder {
       using Accessor = QDPJITDiracOrder<Float, Ns, Nc>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using Complex = complex<real>;
       Float *field;
       int volumeCB;
       int nParity;
@@ -1751,17 +1751,17 @@ namespace quda
       {
       }
 
-      __device__ __host__ inline void load(complex v[Ns * Nc], int x, int parity = 0) const
+      __device__ __host__ inline void load(Complex v[Ns * Nc], int x, int parity = 0) const
       {
         for (int s = 0; s < Ns; s++) {
           for (int c = 0; c < Nc; c++) {
-            v[s * Nc + c] = complex(field[(((0 * Nc + c) * Ns + s) * 2 + (1 - parity)) * volumeCB + x],
+            v[s * Nc + c] = Complex(field[(((0 * Nc + c) * Ns + s) * 2 + (1 - parity)) * volumeCB + x],
                                     field[(((1 * Nc + c) * Ns + s) * 2 + (1 - parity)) * volumeCB + x]);
           }
         }
       }
 
-      __device__ __host__ inline void save(const complex v[Ns * Nc], int x, int parity = 0) const
+      __device__ __host__ inline void save(const Complex v[Ns * Nc], int x, int parity = 0) const
       {
         for (int s = 0; s < Ns; s++) {
           for (int c = 0; c < Nc; c++) {
@@ -23,6 +23,7 @@ namespace quda
 {
 
   typedef struct MsgHandle_s MsgHandle;
+  typedef struct MsgPlan_s MsgPlan;
   typedef struct Topology_s Topology;
 
   char *comm_hostname(void);
@@ -38,6 +39,22 @@ namespace quda
   void comm_set_default_topology(Topology *topo);
   Topology *comm_default_topology(void);
 
+  /**
+     @brief Select the process grid for a given lattice, together with
+     the mapping of grid coordinates to ranks.  The halo traffic that
+     crosses node boundaries is minimized first, and then the total
+     halo traffic, so that the ranks of a node are neighbors along
+     the dimensions with the largest faces.
+     @param[in] ndim Number of grid dimensions
+     @param[in] X Global lattice dimensions
+     @param[in] node Node identifier of each rank, where ranks with
+     the same identifier share a node
+     @param[out] dims The selected process grid
+     @param[out] rank_map The rank of each grid coordinate, indexed
+     lexicographically with the last dimension running fastest
+  */
+  void comm_select_grid(int ndim, const int *X, const std::vector<int> &node, int *dims, std::vector<int> &rank_map);
+
   // routines related to direct peer-2-peer access
   void comm_set_neighbor_ranks(Topology *topo = NULL);
   int comm_neighbor_rank(int dir, int dim);
@@ -391,12 +408,62 @@ namespace quda
   void comm_wait(MsgHandle *mh);
   int comm_query(MsgHandle *mh);
 
+  /**
+     Create a persistent set of messages, e.g., all faces of a halo
+     exchange, which are started with a single call and completed or
+     queried together.  The messages may still be waited on
+     individually.
+     @param mh The message handles of the set, which must outlive it
+     @param n The number of messages
+  */
+  MsgPlan *comm_declare_plan(MsgHandle *const *mh, int n);
+
+  void comm_free_plan(MsgPlan *&plan);
+
+  /**
+     @brief Start all messages of a set
+  */
+  void comm_start_plan(MsgPlan *plan);
+
+  /**
+     @brief Wait for all messages of a set to complete
+  */
+  void comm_wait_plan(MsgPlan *plan);
+
+  /**
+     @brief Non-blocking query of whether a message of a set has
+     completed, where all messages of the set that are in flight are
+     tested with a single call
+     @param plan The set of messages
+     @param i The index of the message in the set
+     @return Whether the message has completed
+  */
+  int comm_query_plan(MsgPlan *plan, int i);
+
   template <typename T> void comm_allreduce_sum(T &v);
   template <typename T> void comm_allreduce_max(T &v);
   template <typename T> void comm_allreduce_min(T &v);
 
   void comm_allreduce_int(int &data);
   void comm_allreduce_xor(uint64_t &data);
+
+  /**
+     @brief Start a non-blocking sum reduction of an array over all
+     processes, e.g., to overlap the global reduction of a solver
+     with the application of the operator.  At most one such
+     reduction may be in flight per communicator, and the array may
+     not be accessed until comm_allreduce_sum_wait has returned.
+     Backends without non-blocking collectives complete the reduction
+     here.
+     @param[in,out] data The array that is reduced in place
+     @param[in] size The length of the array
+  */
+  void comm_allreduce_sum_start(double *data, size_t size);
+
+  /**
+     @brief Complete the reduction started with comm_allreduce_sum_start
+  */
+  void comm_allreduce_sum_wait();
   void comm_broadcast(void *data, size_t nbytes);
   void comm_barrier(void);
   void comm_abort(int status);
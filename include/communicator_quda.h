@@ -143,6 +143,13 @@ namespace quda
     }
   }
 
+#if defined(SHM_COMMS)
+  namespace shm
+  {
+    struct segment_t;
+  }
+#endif
+
   struct Communicator {
 
     /**
@@ -463,6 +470,11 @@ namespace quda
     if (!gdr_init) {
       char *enable_gdr_env = getenv("QUDA_ENABLE_GDR");
       if (enable_gdr_env && strcmp(enable_gdr_env, "1") == 0) { gdr_enabled = true; }
+#if defined(SHM_COMMS)
+      // messages are copied on the host, so they cannot be sent from device memory
+      if (gdr_enabled) warningQuda("GPU-Direct RDMA is not supported with shared-memory communications");
+      gdr_enabled = false;
+#endif
       gdr_init = true;
     }
 #endif
@@ -651,6 +663,13 @@ namespace quda
   MPI_Comm MPI_COMM_HANDLE;
 #endif
 
+#if defined(MPI_COMMS)
+  /**
+   * The request of the non-blocking reduction in flight, if any
+   */
+  MPI_Request reduce_request = MPI_REQUEST_NULL;
+#endif
+
 #if defined(QMP_COMMS)
   QMP_comm_t QMP_COMM_HANDLE;
 
@@ -661,6 +680,14 @@ namespace quda
   bool is_qmp_handle_default;
 #endif
 
+#if defined(SHM_COMMS)
+  /**
+   * The shared-memory segment of this communicator, through which the
+   * collectives are staged and which names its point-to-point channels.
+   */
+  shm::segment_t *shm_segment = nullptr;
+#endif
+
   int rank = -1;
   int size = -1;
 
@@ -733,6 +760,16 @@ namespace quda
 
   int comm_query(MsgHandle *mh);
 
+  MsgPlan *comm_declare_plan(MsgHandle *const *mh, int n);
+
+  void comm_free_plan(MsgPlan *&plan);
+
+  void comm_start_plan(MsgPlan *plan);
+
+  void comm_wait_plan(MsgPlan *plan);
+
+  int comm_query_plan(MsgPlan *plan, int i);
+
   template <typename T> T deterministic_reduce(T *array, int n)
   {
     std::sort(array, array + n); // sort reduction into ascending order for deterministic reduction
@@ -741,6 +778,10 @@ namespace quda
 
   void comm_allreduce_sum_array(double *data, size_t size);
 
+  void comm_allreduce_sum_start(double *data, size_t size);
+
+  void comm_allreduce_sum_wait();
+
   void comm_allreduce_max_array(double *data, size_t size);
 
   void comm_allreduce_max_array(deviation_t<double> *data, size_t size);
@@ -768,4 +809,10 @@ void push_communicator(const CommKey &split_key);
 /** @brief These routine broadcast the data according to the default communicator */
 void comm_broadcast_global(void *data, size_t nbytes);
 
+/** @brief Return the number of processes in the default communicator */
+size_t comm_size_global();
+
+/** @brief Element-wise minimum of an array over the default communicator */
+void comm_allreduce_min_array_global(double *data, size_t size);
+
 } // namespace quda
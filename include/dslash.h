@@ -6,6 +6,7 @@
 #include <dslash_quda.h>
 #include <dslash_helper.cuh>
 #include <tunable_nd.h>
+#include <dslash_host.h>
 #include <instantiate.h>
 #include <instantiate_dslash.h>
 
@@ -82,6 +83,12 @@ namespace quda
     virtual bool tuneGridDim() const override { return arg.kernel_type == EXTERIOR_KERNEL_ALL && arg.shmem > 0; }
     virtual unsigned int minThreads() const override { return arg.threads; }
 
+    /**
+       @brief Host launches only tune the number of sites per tile
+       (see dslash_host.h)
+    */
+    int hostChunkDim() const override { return 1; }
+
     virtual unsigned int minGridSize() const override
     {
       /* when using nvshmem we perform the exterior Dslash using a grid strided loop and uniquely assign communication
@@ -154,8 +161,8 @@ namespace quda
       }
     }
 
-    virtual int blockStep() const override { return 16; }
-    virtual int blockMin() const override { return 16; }
+    virtual int blockStep() const override { return std::min(16, device::warp_size()); }
+    virtual int blockMin() const override { return std::min(16, device::warp_size()); }
 
     unsigned int maxSharedBytesPerBlock() const override { return maxDynamicSharedBytesPerBlock(); }
 
@@ -258,7 +265,8 @@ namespace quda
     inline void instantiate(TuneParam &tp, const qudaStream_t &stream)
     {
       if (in.Location() == QUDA_CPU_FIELD_LOCATION) {
-        errorQuda("Not implemented");
+        if (arg.kernel_type != INTERIOR_KERNEL) errorQuda("Unexpected kernel type %d for host dslash", arg.kernel_type);
+        dslash_host<D, nParity, dagger, xpay>(arg, host::get_launch_param(tp));
       } else {
         switch (arg.kernel_type) {
         case INTERIOR_KERNEL: launch<P, nParity, dagger, xpay, INTERIOR_KERNEL>(tp, stream); break;
@@ -330,8 +338,12 @@ namespace quda
     Dslash(Arg &arg, const ColorSpinorField &out, const ColorSpinorField &in, const std::string &app_base = "") :
       TunableKernel3D(in, 1, arg.nParity), arg(arg), out(out), in(in), nDimComms(4), dslashParam(arg)
     {
-      if (checkLocation(out, in) == QUDA_CPU_FIELD_LOCATION)
-        errorQuda("CPU Fields not supported in Dslash framework yet");
+      if (checkLocation(out, in) == QUDA_CPU_FIELD_LOCATION) {
+        // the host dslash has no halo exchange, and uses the same native accessors as the device
+        for (int d = 0; d < 4; d++)
+          if (arg.commDim[d]) errorQuda("Host dslash does not support partitioned dimension %d", d);
+        if (!in.isNative() || !out.isNative()) errorQuda("Host dslash requires native field order");
+      }
 
       // this sets the communications pattern for the packing kernel
       setPackComms(arg.commDim);
@@ -126,6 +126,9 @@ typedef enum QudaInverterType_s {
   QUDA_CA_CGNE_INVERTER,
   QUDA_CA_CGNR_INVERTER,
   QUDA_CA_GCR_INVERTER,
+  QUDA_PIPE_CG_INVERTER,
+  QUDA_BLOCK_CG_INVERTER,
+  QUDA_GCRODR_INVERTER,
   QUDA_INVALID_INVERTER = QUDA_INVALID_ENUM
 } QudaInverterType;
 
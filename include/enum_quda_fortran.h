@@ -121,6 +121,9 @@
 #define QUDA_CA_CGNE_INVERTER 20
 #define QUDA_CA_CGNR_INVERTER 21
 #define QUDA_CA_GCR_INVERTER 22
+#define QUDA_PIPE_CG_INVERTER 23
+#define QUDA_BLOCK_CG_INVERTER 24
+#define QUDA_GCRODR_INVERTER 25
 #define QUDA_INVALID_INVERTER QUDA_INVALID_ENUM
 
 #define QudaEigType integer(4)
@@ -1,11 +1,24 @@
 #pragma once
 
+#include <cstdint>
+#include <deque>
+#include <list>
 #include <string>
-#include <map>
-#include <stack>
+#include <unordered_map>
 #include <vector>
 #include <reference_wrapper_helper.h>
 
+/**
+   @file field_cache.h
+
+   @section Cache of field temporaries.  Temporaries that go out of
+   scope are kept for reuse by later requests with the same key.  The
+   memory held by the cache is bounded by the budget set with the
+   environment variable QUDA_FIELD_CACHE_BUDGET (in MiB, unbounded by
+   default), beyond which the least recently returned fields are
+   freed, regardless of their key.
+ */
+
 namespace quda {
 
   /**
@@ -17,6 +30,7 @@ namespace quda {
   struct FieldKey {
     std::string volume; /** volume kstring */
     std::string aux;    /** auxiliary string */
+    uint64_t hash = 0;  /** hash of the strings, which must be updated with rehash() if they are changed */
 
     FieldKey() = default;
 
@@ -24,31 +38,104 @@ namespace quda {
        @brief Constructor for FieldKey
        @param[in] a Field whose key we wish to generate
     */
-    FieldKey(const T &a) : volume(a.VolString()), aux(a.AuxString()) { }
+    FieldKey(const T &a) : volume(a.VolString()), aux(a.AuxString()) { rehash(); }
+
+    /**
+       @brief Constructor for a custom FieldKey
+       @param[in] volume The volume string
+       @param[in] aux The auxiliary string
+    */
+    FieldKey(const std::string &volume, const std::string &aux) : volume(volume), aux(aux) { rehash(); }
 
     /**
-       @brief Less than operator used for ordering in the container
+       @brief Compute the hash of the key strings (FNV-1a), with a
+       separator between the strings so that the boundaries are
+       significant.
+    */
+    void rehash()
+    {
+      uint64_t h = 0xcbf29ce484222325ull;
+      for (const std::string *s : {&volume, &aux}) {
+        for (auto c : *s) h = (h ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;
+        h = (h ^ 0xff) * 0x100000001b3ull;
+      }
+      hash = h;
+    }
+
+    /**
+       @brief Key equality, where the strings are only compared if the hashes match
+     */
+    bool operator==(const FieldKey<T> &other) const
+    {
+      return hash == other.hash && volume == other.volume && aux == other.aux;
+    }
+
+    /**
+       @brief Less than operator used for ordering in the container,
+       which orders by hash first
      */
     bool operator<(const FieldKey<T> &other) const
     {
-      if (volume < other.volume) {
-        return true;
-      } else if (volume == other.volume) {
-        return aux < other.aux ? true : false;
-      }
-      return false;
+      if (hash != other.hash) return hash < other.hash;
+      if (volume != other.volume) return volume < other.volume;
+      return aux < other.aux;
     }
   };
 
+  /**
+     Hasher for FieldKey, which returns the precomputed hash
+   */
+  template <typename T> struct FieldKeyHash {
+    size_t operator()(const FieldKey<T> &key) const { return key.hash; }
+  };
+
+  /**
+     Statistics of a field cache
+   */
+  struct FieldCacheStats {
+    size_t n_hit = 0;             /** requests served from the cache */
+    size_t n_miss = 0;            /** requests that allocated a new field */
+    size_t n_evict = 0;           /** fields freed to stay within the budget */
+    size_t n_cached = 0;          /** fields held in the cache */
+    size_t cached_bytes = 0;      /** bytes of the fields held in the cache */
+    size_t peak_cached_bytes = 0; /** peak of the bytes held in the cache */
+  };
+
   /**
      FieldTmp is a wrapper for a cached field.
      @tparam T The field type
    */
   template <typename T>
   class FieldTmp {
-    static std::map<FieldKey<T>, std::stack<T>> cache; /** Field Cache */
-    T tmp;                                             /** The temporary field instance */
-    FieldKey<T> key;                                   /** Key associated with this instance */
+    struct entry_t {
+      FieldKey<T> key;
+      T field;
+      size_t bytes;
+    };
+    using lru_t = std::list<entry_t>;
+
+    /** Cached fields, most recently returned first */
+    static lru_t lru;
+    /** Cached fields of each key, most recently returned last */
+    static std::unordered_map<FieldKey<T>, std::deque<typename lru_t::iterator>, FieldKeyHash<T>> cache;
+
+    static FieldCacheStats stats; /** Statistics of the cache */
+    T tmp;                        /** The temporary field instance */
+    FieldKey<T> key;              /** Key associated with this instance */
+
+    /**
+       @brief Take the most recently returned field of a key from the cache
+       @param[in] key The key of the field
+       @param[out] field The field taken from the cache
+       @return Whether there was a field of this key in the cache
+     */
+    static bool take(const FieldKey<T> &key, T &field);
+
+    /**
+       @brief Free the least recently returned fields until the cache
+       is within its budget
+     */
+    static void evict();
 
   public:
     /**
@@ -91,12 +178,19 @@ namespace quda {
 
     /**
        @brief Push the temporary onto the cache, where it will be
-       available for subsequent reuse.
+       available for subsequent reuse, and evict the least recently
+       returned fields if the cache exceeds its budget.
     */
     ~FieldTmp();
 
     /** @brief Flush the cache and frees all temporary allocations */
     static void destroy();
+
+    /** @brief Return the statistics of the cache */
+    static const FieldCacheStats &get_stats() { return stats; }
+
+    /** @brief Print the statistics of the cache */
+    static void print_stats();
   };
 
   /**
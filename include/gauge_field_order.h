@@ -947,7 +947,7 @@ namespace quda {
       template <int N, typename Float, QudaGhostExchange ghostExchange_, QudaStaggeredPhase = QUDA_STAGGERED_PHASE_NO>
       struct Reconstruct {
         using real = typename mapper<Float>::type;
-        using complex = complex<real>;
+        using Complex = complex<real>;
         real scale;
         real scale_inv;
         Reconstruct(const GaugeField &u) :
@@ -956,7 +956,7 @@ namespace quda {
         {
         }
 
-        __device__ __host__ inline void Pack(real out[N], const complex in[N / 2]) const
+        __device__ __host__ inline void Pack(real out[N], const Complex in[N / 2]) const
         {
           if constexpr (isFixed<Float>::value) {
 #pragma unroll
@@ -974,18 +974,18 @@ namespace quda {
         }
 
         template <typename I>
-        __device__ __host__ inline void Unpack(complex out[N / 2], const real in[N], int, int, real, const I *,
+        __device__ __host__ inline void Unpack(Complex out[N / 2], const real in[N], int, int, real, const I *,
                                                const int *) const
         {
           if constexpr (isFixed<Float>::value) {
 #pragma unroll
-            for (int i = 0; i < N / 2; i++) { out[i] = scale * complex(in[2 * i + 0], in[2 * i + 1]); }
+            for (int i = 0; i < N / 2; i++) { out[i] = scale * Complex(in[2 * i + 0], in[2 * i + 1]); }
           } else {
 #pragma unroll
-            for (int i = 0; i < N / 2; i++) { out[i] = complex(in[2 * i + 0], in[2 * i + 1]); }
+            for (int i = 0; i < N / 2; i++) { out[i] = Complex(in[2 * i + 0], in[2 * i + 1]); }
           }
         }
-        __device__ __host__ inline real getPhase(const complex[]) const { return 0; }
+        __device__ __host__ inline real getPhase(const Complex[]) const { return 0; }
       };
 
       /**
@@ -1053,7 +1053,7 @@ namespace quda {
       */
       template <typename Float, QudaGhostExchange ghostExchange_> struct Reconstruct<12, Float, ghostExchange_> {
         using real = typename mapper<Float>::type;
-        using complex = complex<real>;
+        using Complex = complex<real>;
         const real anisotropy;
         const real tBoundary;
         const int firstTimeSliceBound;
@@ -1073,7 +1073,7 @@ namespace quda {
         {
         }
 
-        __device__ __host__ inline void Pack(real out[12], const complex in[9]) const
+        __device__ __host__ inline void Pack(real out[12], const Complex in[9]) const
         {
 #pragma unroll
           for (int i = 0; i < 6; i++) {
@@ -1083,11 +1083,11 @@ namespace quda {
         }
 
         template <typename I>
-        __device__ __host__ inline void Unpack(complex out[9], const real in[12], int idx, int dir, real, const I *X,
+        __device__ __host__ inline void Unpack(Complex out[9], const real in[12], int idx, int dir, real, const I *X,
                                                const int *R) const
         {
 #pragma unroll
-          for (int i = 0; i < 6; i++) out[i] = complex(in[2 * i + 0], in[2 * i + 1]);
+          for (int i = 0; i < 6; i++) out[i] = Complex(in[2 * i + 0], in[2 * i + 1]);
 
           const real u0 = dir < 3 ?
             anisotropy :
@@ -1110,7 +1110,7 @@ namespace quda {
           out[8] = u0 * conj(out[8]);
         }
 
-        __device__ __host__ inline real getPhase(const complex[]) const { return 0; }
+        __device__ __host__ inline real getPhase(const Complex[]) const { return 0; }
       };
 
       /**
@@ -1125,11 +1125,11 @@ namespace quda {
       */
       template <typename Float, QudaGhostExchange ghostExchange_> struct Reconstruct<11, Float, ghostExchange_> {
         using real = typename mapper<Float>::type;
-        using complex = complex<real>;
+        using Complex = complex<real>;
 
         Reconstruct(const GaugeField &) { ; }
 
-        __device__ __host__ inline void Pack(real out[10], const complex in[9]) const
+        __device__ __host__ inline void Pack(real out[10], const Complex in[9]) const
         {
 #pragma unroll
           for (int i = 0; i < 2; i++) {
@@ -1145,21 +1145,21 @@ namespace quda {
         }
 
         template <typename I>
-        __device__ __host__ inline void Unpack(complex out[9], const real in[10], int, int, real, const I *,
+        __device__ __host__ inline void Unpack(Complex out[9], const real in[10], int, int, real, const I *,
                                                const int *) const
         {
-          out[0] = complex(0.0, in[6]);
-          out[1] = complex(in[0], in[1]);
-          out[2] = complex(in[2], in[3]);
-          out[3] = complex(-out[1].real(), out[1].imag());
-          out[4] = complex(0.0, in[7]);
-          out[5] = complex(in[4], in[5]);
-          out[6] = complex(-out[2].real(), out[2].imag());
-          out[7] = complex(-out[5].real(), out[5].imag());
-          out[8] = complex(0.0, in[8]);
+          out[0] = Complex(0.0, in[6]);
+          out[1] = Complex(in[0], in[1]);
+          out[2] = Complex(in[2], in[3]);
+          out[3] = Complex(-out[1].real(), out[1].imag());
+          out[4] = Complex(0.0, in[7]);
+          out[5] = Complex(in[4], in[5]);
+          out[6] = Complex(-out[2].real(), out[2].imag());
+          out[7] = Complex(-out[5].real(), out[5].imag());
+          out[8] = Complex(0.0, in[8]);
         }
 
-        __device__ __host__ inline real getPhase(const complex[]) const { return 0; }
+        __device__ __host__ inline real getPhase(const Complex[]) const { return 0; }
       };
 
       /**
@@ -1173,7 +1173,7 @@ namespace quda {
       template <typename Float, QudaGhostExchange ghostExchange_, QudaStaggeredPhase stag_phase>
       struct Reconstruct<13, Float, ghostExchange_, stag_phase> {
         using real = typename mapper<Float>::type;
-        using complex = complex<real>;
+        using Complex = complex<real>;
         const Reconstruct<12, Float, ghostExchange_> reconstruct_12;
         const real scale;
         const real scale_inv;
@@ -1183,14 +1183,14 @@ namespace quda {
         {
         }
 
-        __device__ __host__ inline void Pack(real out[12], const complex in[9]) const { reconstruct_12.Pack(out, in); }
+        __device__ __host__ inline void Pack(real out[12], const Complex in[9]) const { reconstruct_12.Pack(out, in); }
 
         template <typename I>
-        __device__ __host__ inline void Unpack(complex out[9], const real in[12], int, int, real phase, const I *,
+        __device__ __host__ inline void Unpack(Complex out[9], const real in[12], int, int, real phase, const I *,
                                                const int *) const
         {
 #pragma unroll
-          for (int i = 0; i < 6; i++) out[i] = complex(in[2 * i + 0], in[2 * i + 1]);
+          for (int i = 0; i < 6; i++) out[i] = Complex(in[2 * i + 0], in[2 * i + 1]);
 
           out[6] = cmul(out[2], out[4]);
           out[6] = cmac(out[1], out[5], -out[6]);
@@ -1208,7 +1208,7 @@ namespace quda {
             // Multiply the third row by exp(I*3*phase), since the cross product will end up in a scale factor of exp(-I*2*phase)
             real cos_sin[2];
             sincospi(static_cast<real>(3.0) * phase, &cos_sin[1], &cos_sin[0]);
-            complex A(cos_sin[0], cos_sin[1]);
+            Complex A(cos_sin[0], cos_sin[1]);
             out[6] = cmul(A, out[6]);
             out[7] = cmul(A, out[7]);
             out[8] = cmul(A, out[8]);
@@ -1219,22 +1219,22 @@ namespace quda {
           }
         }
 
-        __device__ __host__ inline real getPhase(const complex in[9]) const
+        __device__ __host__ inline real getPhase(const Complex in[9]) const
         {
 #if 1 // phase from cross product
           // denominator = (U[0][0]*U[1][1] - U[0][1]*U[1][0])*
-          complex denom = conj(in[0] * in[4] - in[1] * in[3]) * scale_inv;
-          complex expI3Phase = in[8] / denom; // numerator = U[2][2]
+          Complex denom = conj(in[0] * in[4] - in[1] * in[3]) * scale_inv;
+          Complex expI3Phase = in[8] / denom; // numerator = U[2][2]
 
           // dynamic phasing
           if constexpr (stag_phase == QUDA_STAGGERED_PHASE_NO) return arg(expI3Phase) / static_cast<real>(3.0 * M_PI);
           // static phasing
           return expI3Phase.real() > 0 ? 1 : -1;
 #else // phase from determinant
-          Matrix<complex, 3> a;
+          Matrix<Complex, 3> a;
 #pragma unroll
           for (int i = 0; i < 9; i++) a(i) = scale_inv * in[i];
-          const complex det = getDeterminant(a);
+          const Complex det = getDeterminant(a);
           return phase = arg(det) / static_cast<real>(3.0 * M_PI);
 #endif
         }
@@ -1249,9 +1249,9 @@ namespace quda {
       */
       template <typename Float, QudaGhostExchange ghostExchange_> struct Reconstruct<8, Float, ghostExchange_> {
         using real = typename mapper<Float>::type;
-        using complex = complex<real>;
-        const complex anisotropy; // imaginary value stores inverse
-        const complex tBoundary;  // imaginary value stores inverse
+        using Complex = complex<real>;
+        const Complex anisotropy; // imaginary value stores inverse
+        const Complex tBoundary;  // imaginary value stores inverse
         const int firstTimeSliceBound;
         const int lastTimeSliceBound;
         const bool isFirstTimeSlice;
@@ -1275,7 +1275,7 @@ namespace quda {
         // compressing the matrix {{b1,b2,b3},{a1,a2,a3},{-c1,-c2,-c3}}
         // instead of {{a1,a2,a3},{b1,b2,b3},{c1,c2,c3}}
 
-        __device__ __host__ inline void Pack(real out[8], const complex in[9]) const
+        __device__ __host__ inline void Pack(real out[8], const Complex in[9]) const
         {
           out[0] = atan2(in[3].imag(), in[3].real()) / static_cast<real>(M_PI);   // a1 -> b1
           out[1] = atan2(-in[6].imag(), -in[6].real()) / static_cast<real>(M_PI); // c1 -> -c1
@@ -1289,22 +1289,22 @@ namespace quda {
         }
 
         template <typename I>
-        __device__ __host__ inline void Unpack(complex out[9], const real in[8], int, int, real, const I *, const int *,
-                                               const complex, const complex u) const
+        __device__ __host__ inline void Unpack(Complex out[9], const real in[8], int, int, real, const I *, const int *,
+                                               const Complex, const Complex u) const
         {
           real u0 = u.real();
           real u0_inv = u.imag();
 
 #pragma unroll
           for (int i = 1; i <= 3; i++)
-            out[i] = complex(in[2 * i + 0], in[2 * i + 1]); // these elements are copied directly
+            out[i] = Complex(in[2 * i + 0], in[2 * i + 1]); // these elements are copied directly
 
           real tmp[2];
           quda::sincospi(in[0], &tmp[1], &tmp[0]);
-          out[0] = complex(tmp[0], tmp[1]);
+          out[0] = Complex(tmp[0], tmp[1]);
 
           quda::sincospi(in[1], &tmp[1], &tmp[0]);
-          out[6] = complex(tmp[0], tmp[1]);
+          out[6] = Complex(tmp[0], tmp[1]);
 
           // First, reconstruct first row
           real row_sum = out[1].real() * out[1].real();
@@ -1332,7 +1332,7 @@ namespace quda {
           // Finally, reconstruct last elements from SU(2) rotation
           real r_inv2 = u0_inv * row_sum_inv;
           {
-            complex A = cmul(conj(out[0]), out[3]);
+            Complex A = cmul(conj(out[0]), out[3]);
 
             // out[4] = -(conj(out[6])*conj(out[2]) + u0*A*out[1])*r_inv2; // U11
             out[4] = cmul(conj(out[6]), conj(out[2]));
@@ -1346,7 +1346,7 @@ namespace quda {
           }
 
           {
-            complex A = cmul(conj(out[0]), out[6]);
+            Complex A = cmul(conj(out[0]), out[6]);
 
             // out[7] = (conj(out[3])*conj(out[2]) - u0*A*out[1])*r_inv2;  // U21
             out[7] = cmul(conj(out[3]), conj(out[2]));
@@ -1372,10 +1372,10 @@ namespace quda {
 
         template <typename I>
         __device__ __host__ inline void
-        Unpack(complex out[9], const real in[8], int idx, int dir, real phase, const I *X, const int *R,
-               const complex scale = complex(static_cast<real>(1.0), static_cast<real>(1.0))) const
+        Unpack(Complex out[9], const real in[8], int idx, int dir, real phase, const I *X, const int *R,
+               const Complex scale = Complex(static_cast<real>(1.0), static_cast<real>(1.0))) const
         {
-          complex u = dir < 3 ?
+          Complex u = dir < 3 ?
             anisotropy :
             timeBoundary<ghostExchange_>(idx, X, R, tBoundary, scale, firstTimeSliceBound, lastTimeSliceBound,
                                          isFirstTimeSlice, isLastTimeSlice, ghostExchange);
@@ -1383,7 +1383,7 @@ namespace quda {
           Unpack(out, in, idx, dir, phase, X, R, scale, u);
         }
 
-        __device__ __host__ inline real getPhase(const complex[]) const { return 0; }
+        __device__ __host__ inline real getPhase(const Complex[]) const { return 0; }
       };
 
       /**
@@ -1397,7 +1397,7 @@ namespace quda {
       template <typename Float, QudaGhostExchange ghostExchange_, QudaStaggeredPhase stag_phase>
       struct Reconstruct<9, Float, ghostExchange_, stag_phase> {
         using real = typename mapper<Float>::type;
-        using complex = complex<real>;
+        using Complex = complex<real>;
         const Reconstruct<8, Float, ghostExchange_> reconstruct_8;
         const real scale;
         const real scale_inv;
@@ -1407,36 +1407,36 @@ namespace quda {
         {
         }
 
-        __device__ __host__ inline real getPhase(const complex in[9]) const
+        __device__ __host__ inline real getPhase(const Complex in[9]) const
         {
 #if 1 // phase from cross product
           // denominator = (U[0][0]*U[1][1] - U[0][1]*U[1][0])*
-          complex denom = conj(in[0] * in[4] - in[1] * in[3]) * scale_inv;
-          complex expI3Phase = in[8] / denom; // numerator = U[2][2]
+          Complex denom = conj(in[0] * in[4] - in[1] * in[3]) * scale_inv;
+          Complex expI3Phase = in[8] / denom; // numerator = U[2][2]
           // dynamic phasing
           if constexpr (stag_phase == QUDA_STAGGERED_PHASE_NO) return arg(expI3Phase) / static_cast<real>(3.0 * M_PI);
           // static phasing
           return expI3Phase.real() > 0 ? 1 : -1;
 #else // phase from determinant
-          Matrix<complex, 3> a;
+          Matrix<Complex, 3> a;
 #pragma unroll
           for (int i = 0; i < 9; i++) a(i) = scale_inv * in[i];
-          const complex det = getDeterminant(a);
+          const Complex det = getDeterminant(a);
           real phase = arg(det) / static_cast<real>(3.0 * M_PI);
           return phase;
 #endif
         }
 
         // Rescale the U3 input matrix by exp(-I*phase) to obtain an SU3 matrix multiplied by a real scale factor,
-        __device__ __host__ inline void Pack(real out[8], const complex in[9]) const
+        __device__ __host__ inline void Pack(real out[8], const Complex in[9]) const
         {
           real phase = getPhase(in);
-          complex su3[9];
+          Complex su3[9];
 
           if constexpr (stag_phase == QUDA_STAGGERED_PHASE_NO) {
             real cos_sin[2];
             sincospi(static_cast<real>(-phase), &cos_sin[1], &cos_sin[0]);
-            complex z(cos_sin[0], cos_sin[1]);
+            Complex z(cos_sin[0], cos_sin[1]);
             z *= scale_inv;
 #pragma unroll
             for (int i = 0; i < 9; i++) su3[i] = cmul(z, in[i]);
@@ -1448,16 +1448,16 @@ namespace quda {
         }
 
         template <typename I>
-        __device__ __host__ inline void Unpack(complex out[9], const real in[8], int idx, int dir, real phase,
+        __device__ __host__ inline void Unpack(Complex out[9], const real in[8], int idx, int dir, real phase,
                                                const I *X, const int *R) const
         {
-          reconstruct_8.Unpack(out, in, idx, dir, phase, X, R, complex(static_cast<real>(1.0), static_cast<real>(1.0)),
-                               complex(static_cast<real>(1.0), static_cast<real>(1.0)));
+          reconstruct_8.Unpack(out, in, idx, dir, phase, X, R, Complex(static_cast<real>(1.0), static_cast<real>(1.0)),
+                               Complex(static_cast<real>(1.0), static_cast<real>(1.0)));
 
           if constexpr (stag_phase == QUDA_STAGGERED_PHASE_NO) { // dynamic phase
             real cos_sin[2];
             sincospi(static_cast<real>(phase), &cos_sin[1], &cos_sin[0]);
-            complex z(cos_sin[0], cos_sin[1]);
+            Complex z(cos_sin[0], cos_sin[1]);
             z *= scale;
 #pragma unroll
             for (int i = 0; i < 9; i++) out[i] = cmul(z, out[i]);
@@ -1503,7 +1503,7 @@ namespace quda {
         using store_t = Float;
         static constexpr int length = length_;
         using real = typename mapper<Float>::type;
-        using complex = complex<real>;
+        using Complex = complex<real>;
         typedef typename VectorType<Float, N>::type Vector;
         typedef typename AllocType<huge_alloc>::type AllocInt;
         Reconstruct<reconLenParam, Float, ghostExchange_, stag_phase> reconstruct;
@@ -1547,7 +1547,7 @@ namespace quda {
           }
         }
 
-      __device__ __host__ inline void load(complex v[length / 2], int x, int dir, int parity, real phase = 1.0) const
+      __device__ __host__ inline void load(Complex v[length / 2], int x, int dir, int parity, real phase = 1.0) const
       {
         const int M = reconLen / N;
         real tmp[reconLen];
@@ -1570,7 +1570,7 @@ namespace quda {
         reconstruct.Unpack(v, tmp, x, dir, phase, X, R);
       }
 
-      __device__ __host__ inline void save(const complex v[length / 2], int x, int dir, int parity) const
+      __device__ __host__ inline void save(const Complex v[length / 2], int x, int dir, int parity) const
       {
         const int M = reconLen / N;
         real tmp[reconLen];
@@ -1606,7 +1606,7 @@ namespace quda {
         return gauge_wrapper<real, Accessor>(const_cast<Accessor &>(*this), dim, x_cb, parity, phase);
       }
 
-      __device__ __host__ inline void loadGhost(complex v[length / 2], int x, int dir, int parity, real inphase = 1.0) const
+      __device__ __host__ inline void loadGhost(Complex v[length / 2], int x, int dir, int parity, real inphase = 1.0) const
       {
         if (!ghost[dir]) { // load from main field not separate array
           load(v, volumeCB + x, dir, parity, inphase); // an offset of size volumeCB puts us at the padded region
@@ -1639,7 +1639,7 @@ namespace quda {
         }
       }
 
-      __device__ __host__ inline void saveGhost(const complex v[length / 2], int x, int dir, int parity) const
+      __device__ __host__ inline void saveGhost(const Complex v[length / 2], int x, int dir, int parity) const
       {
         if (!ghost[dir]) { // store in main field not separate array
           save(v, volumeCB + x, dir, parity); // an offset of size volumeCB puts us at the padded region
@@ -1698,7 +1698,7 @@ namespace quda {
         return gauge_ghost_wrapper<real, Accessor>(const_cast<Accessor &>(*this), dim, ghost_idx, parity, phase);
       }
 
-      __device__ __host__ inline void loadGhostEx(complex v[length / 2], int buff_idx, int extended_idx, int dir,
+      __device__ __host__ inline void loadGhostEx(Complex v[length / 2], int buff_idx, int extended_idx, int dir,
                                                   int dim, int g, int parity, const int R[]) const
       {
         const int M = reconLen / N;
@@ -1723,7 +1723,7 @@ namespace quda {
         reconstruct.Unpack(v, tmp, extended_idx, g, 2. * phase, X, R);
       }
 
-      __device__ __host__ inline void saveGhostEx(const complex v[length / 2], int buff_idx, int, int dir, int dim,
+      __device__ __host__ inline void saveGhostEx(const Complex v[length / 2], int buff_idx, int, int dir, int dim,
                                                   int g, int parity, const int R[]) const
       {
         const int M = reconLen / N;
@@ -1760,7 +1760,7 @@ namespace quda {
         using Accessor = LegacyOrder<Float, length>;
         using store_t = Float;
         using real = typename mapper<Float>::type;
-        using complex = complex<real>;
+        using Complex = complex<real>;
         Float *ghost[QUDA_MAX_DIM];
         int faceVolumeCB[QUDA_MAX_DIM];
         const int volumeCB;
@@ -1783,16 +1783,16 @@ namespace quda {
           }
         }
 
-        __device__ __host__ inline void loadGhost(complex v[length / 2], int x, int dir, int parity, real = 1.0) const
+        __device__ __host__ inline void loadGhost(Complex v[length / 2], int x, int dir, int parity, real = 1.0) const
         {
           auto in = &ghost[dir][(parity * faceVolumeCB[dir] + x) * length];
-          block_load<complex, length / 2>(v, reinterpret_cast<complex *>(in));
+          block_load<Complex, length / 2>(v, reinterpret_cast<Complex *>(in));
         }
 
-        __device__ __host__ inline void saveGhost(const complex v[length / 2], int x, int dir, int parity)
+        __device__ __host__ inline void saveGhost(const Complex v[length / 2], int x, int dir, int parity)
         {
           auto out = &ghost[dir][(parity * faceVolumeCB[dir] + x) * length];
-          block_store<complex, length / 2>(reinterpret_cast<complex *>(out), v);
+          block_store<Complex, length / 2>(reinterpret_cast<Complex *>(out), v);
         }
 
         /**
@@ -1811,18 +1811,18 @@ namespace quda {
           return gauge_ghost_wrapper<real, Accessor>(const_cast<Accessor &>(*this), dim, ghost_idx, parity, phase);
         }
 
-        __device__ __host__ inline void loadGhostEx(complex v[length / 2], int x, int, int dir, int dim, int g,
+        __device__ __host__ inline void loadGhostEx(Complex v[length / 2], int x, int, int dir, int dim, int g,
                                                     int parity, const int R[]) const
         {
           auto in = &ghost[dim][(((dir * 2 + parity) * R[dim] * faceVolumeCB[dim] + x) * geometry + g) * length];
-          block_load<complex, length / 2>(v, reinterpret_cast<complex *>(in));
+          block_load<Complex, length / 2>(v, reinterpret_cast<Complex *>(in));
         }
 
-        __device__ __host__ inline void saveGhostEx(const complex v[length / 2], int x, int, int dir, int dim, int g,
+        __device__ __host__ inline void saveGhostEx(const Complex v[length / 2], int x, int, int dir, int dim, int g,
                                                     int parity, const int R[]) const
         {
           auto out = &ghost[dim][(((dir * 2 + parity) * R[dim] * faceVolumeCB[dim] + x) * geometry + g) * length];
-          block_store<complex, length / 2>(reinterpret_cast<complex *>(out), v);
+          block_store<Complex, length / 2>(reinterpret_cast<Complex *>(out), v);
         }
       };
 
@@ -1833,23 +1833,23 @@ namespace quda {
     template <typename Float, int length> struct QDPOrder : public LegacyOrder<Float,length> {
       using Accessor = QDPOrder<Float, length>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using Complex = complex<real>;
       Float *gauge[QUDA_MAX_DIM];
       const int volumeCB;
     QDPOrder(const GaugeField &u, Float *gauge_=0, Float **ghost_=0)
       : LegacyOrder<Float,length>(u, ghost_), volumeCB(u.VolumeCB())
 	{ for (int i=0; i<4; i++) gauge[i] = gauge_ ? ((Float**)gauge_)[i] : ((Float**)u.Gauge_p())[i]; }
 
-        __device__ __host__ inline void load(complex v[length / 2], int x, int dir, int parity, real = 1.0) const
+        __device__ __host__ inline void load(Complex v[length / 2], int x, int dir, int parity, real = 1.0) const
         {
           auto in = &gauge[dir][(parity * volumeCB + x) * length];
-          block_load<complex, length / 2>(v, reinterpret_cast<complex *>(in));
+          block_load<Complex, length / 2>(v, reinterpret_cast<Complex *>(in));
       }
 
-      __device__ __host__ inline void save(const complex v[length / 2], int x, int dir, int parity) const
+      __device__ __host__ inline void save(const Complex v[length / 2], int x, int dir, int parity) const
       {
         auto out = &gauge[dir][(parity * volumeCB + x) * length];
-        block_store<complex, length / 2>(reinterpret_cast<complex *>(out), v);
+        block_store<Complex, length / 2>(reinterpret_cast<Complex *>(out), v);
       }
 
       /**
@@ -1877,14 +1877,14 @@ namespace quda {
     template <typename Float, int length> struct QDPJITOrder : public LegacyOrder<Float,length> {
       using Accessor = QDPJITOrder<Float, length>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using Complex = complex<real>;
       Float *gauge[QUDA_MAX_DIM];
       const int volumeCB;
     QDPJITOrder(const GaugeField &u, Float *gauge_=0, Float **ghost_=0)
       : LegacyOrder<Float,length>(u, ghost_), volumeCB(u.VolumeCB())
 	{ for (int i=0; i<4; i++) gauge[i] = gauge_ ? ((Float**)gauge_)[i] : ((Float**)u.Gauge_p())[i]; }
 
-        __device__ __host__ inline void load(complex v[length / 2], int x, int dir, int parity, real = 1.0) const
+        __device__ __host__ inline void load(Complex v[length / 2], int x, int dir, int parity, real = 1.0) const
         {
           for (int i = 0; i < length / 2; i++) {
             v[i].real((real)gauge[dir][((0 * (length / 2) + i) * 2 + parity) * volumeCB + x]);
@@ -1892,7 +1892,7 @@ namespace quda {
           }
       }
 
-      __device__ __host__ inline void save(const complex v[length / 2], int x, int dir, int parity) const
+      __device__ __host__ inline void save(const Complex v[length / 2], int x, int dir, int parity) const
       {
         for (int i = 0; i < length / 2; i++) {
           gauge[dir][((0 * (length / 2) + i) * 2 + parity) * volumeCB + x] = v[i].real();
@@ -1925,7 +1925,7 @@ namespace quda {
   template <typename Float, int length> struct MILCOrder : public LegacyOrder<Float,length> {
     using Accessor = MILCOrder<Float, length>;
     using real = typename mapper<Float>::type;
-    using complex = complex<real>;
+    using Complex = complex<real>;
     Float *gauge;
     const int volumeCB;
     const int geometry;
@@ -1933,16 +1933,16 @@ namespace quda {
     LegacyOrder<Float,length>(u, ghost_), gauge(gauge_ ? gauge_ : (Float*)u.Gauge_p()),
       volumeCB(u.VolumeCB()), geometry(u.Geometry()) { ; }
 
-  __device__ __host__ inline void load(complex v[length / 2], int x, int dir, int parity, real = 1.0) const
+  __device__ __host__ inline void load(Complex v[length / 2], int x, int dir, int parity, real = 1.0) const
   {
     auto in = &gauge[((parity * volumeCB + x) * geometry + dir) * length];
-    block_load<complex, length / 2>(v, reinterpret_cast<complex *>(in));
+    block_load<Complex, length / 2>(v, reinterpret_cast<Complex *>(in));
     }
 
-    __device__ __host__ inline void save(const complex v[length / 2], int x, int dir, int parity) const
+    __device__ __host__ inline void save(const Complex v[length / 2], int x, int dir, int parity) const
     {
       auto out = &gauge[((parity * volumeCB + x) * geometry + dir) * length];
-      block_store<complex, length / 2>(reinterpret_cast<complex *>(out), v);
+      block_store<Complex, length / 2>(reinterpret_cast<Complex *>(out), v);
     }
 
     /**
@@ -1981,7 +1981,7 @@ namespace quda {
   template <typename Float, int length> struct MILCSiteOrder : public LegacyOrder<Float,length> {
     using Accessor = MILCSiteOrder<Float, length>;
     using real = typename mapper<Float>::type;
-    using complex = complex<real>;
+    using Complex = complex<real>;
     Float *gauge;
     const int volumeCB;
     const int geometry;
@@ -1998,20 +1998,20 @@ namespace quda {
       if ((uintptr_t)((char *)gauge + offset) % 16 != 0) { errorQuda("MILC structure has misaligned offset"); }
     }
 
-    __device__ __host__ inline void load(complex v[length / 2], int x, int dir, int parity, real = 1.0) const
+    __device__ __host__ inline void load(Complex v[length / 2], int x, int dir, int parity, real = 1.0) const
     {
       // get base pointer
       auto in = reinterpret_cast<const Float *>(reinterpret_cast<const char *>(gauge) + (parity * volumeCB + x) * size
                                                 + offset + dir * length * sizeof(Float));
-      block_load<complex, length / 2>(v, reinterpret_cast<const complex *>(in));
+      block_load<Complex, length / 2>(v, reinterpret_cast<const Complex *>(in));
     }
 
-    __device__ __host__ inline void save(const complex v[length / 2], int x, int dir, int parity) const
+    __device__ __host__ inline void save(const Complex v[length / 2], int x, int dir, int parity) const
     {
       // get base pointer
       auto out = reinterpret_cast<Float *>(reinterpret_cast<char *>(gauge) + (parity * volumeCB + x) * size + offset
                                            + dir * length * sizeof(Float));
-      block_store<complex, length / 2>(reinterpret_cast<complex *>(out), v);
+      block_store<Complex, length / 2>(reinterpret_cast<Complex *>(out), v);
     }
 
     /**
@@ -2040,7 +2040,7 @@ namespace quda {
   template <typename Float, int length> struct CPSOrder : LegacyOrder<Float,length> {
     using Accessor = CPSOrder<Float, length>;
     using real = typename mapper<Float>::type;
-    using complex = complex<real>;
+    using Complex = complex<real>;
     Float *gauge;
     const int volumeCB;
     const real anisotropy;
@@ -2059,26 +2059,26 @@ namespace quda {
     }
 
     // we need to transpose and scale for CPS ordering
-    __device__ __host__ inline void load(complex v[9], int x, int dir, int parity, Float = 1.0) const
+    __device__ __host__ inline void load(Complex v[9], int x, int dir, int parity, Float = 1.0) const
     {
       auto in = &gauge[((parity * volumeCB + x) * geometry + dir) * length];
-      complex v_[9];
-      block_load<complex, length / 2>(v_, reinterpret_cast<complex *>(in));
+      Complex v_[9];
+      block_load<Complex, length / 2>(v_, reinterpret_cast<Complex *>(in));
 
       for (int i=0; i<Nc; i++) {
         for (int j = 0; j < Nc; j++) { v[i * Nc + j] = v_[j * Nc + i] * anisotropy_inv; }
       }
     }
 
-    __device__ __host__ inline void save(const complex v[9], int x, int dir, int parity) const
+    __device__ __host__ inline void save(const Complex v[9], int x, int dir, int parity) const
     {
       auto out = &gauge[((parity * volumeCB + x) * geometry + dir) * length];
-      complex v_[9];
+      Complex v_[9];
       for (int i=0; i<Nc; i++) {
         for (int j = 0; j < Nc; j++) { v_[i * Nc + j] = v[j * Nc + i] * anisotropy; }
       }
 
-      block_store<complex, length / 2>(reinterpret_cast<complex *>(out), v_);
+      block_store<Complex, length / 2>(reinterpret_cast<Complex *>(out), v_);
     }
 
     /**
@@ -2109,7 +2109,7 @@ namespace quda {
     template <typename Float, int length> struct BQCDOrder : LegacyOrder<Float,length> {
       using Accessor = BQCDOrder<Float, length>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using Complex = complex<real>;
       Float *gauge;
       const int volumeCB;
       int exVolumeCB; // extended checkerboard volume
@@ -2126,26 +2126,26 @@ namespace quda {
       }
 
       // we need to transpose for BQCD ordering
-      __device__ __host__ inline void load(complex v[9], int x, int dir, int parity, real = 1.0) const
+      __device__ __host__ inline void load(Complex v[9], int x, int dir, int parity, real = 1.0) const
       {
         auto in = &gauge[((dir * 2 + parity) * exVolumeCB + x) * length];
-        complex v_[9];
-        block_load<complex, 9>(v_, reinterpret_cast<complex *>(in));
+        Complex v_[9];
+        block_load<Complex, 9>(v_, reinterpret_cast<Complex *>(in));
 
         for (int i = 0; i < Nc; i++) {
           for (int j = 0; j < Nc; j++) { v[i * Nc + j] = v_[j * Nc + i]; }
         }
       }
 
-      __device__ __host__ inline void save(const complex v[9], int x, int dir, int parity) const
+      __device__ __host__ inline void save(const Complex v[9], int x, int dir, int parity) const
       {
         auto out = &gauge[((dir * 2 + parity) * exVolumeCB + x) * length];
-        complex v_[9];
+        Complex v_[9];
         for (int i = 0; i < Nc; i++) {
           for (int j = 0; j < Nc; j++) { v_[i * Nc + j] = v[j * Nc + i]; }
         }
 
-        block_store<complex, 9>(reinterpret_cast<complex *>(out), v_);
+        block_store<Complex, 9>(reinterpret_cast<Complex *>(out), v_);
       }
 
       /**
@@ -2173,7 +2173,7 @@ namespace quda {
     template <typename Float, int length> struct TIFROrder : LegacyOrder<Float,length> {
       using Accessor = TIFROrder<Float, length>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using Complex = complex<real>;
       Float *gauge;
       const int volumeCB;
       static constexpr int Nc = 3;
@@ -2190,26 +2190,26 @@ namespace quda {
       }
 
       // we need to transpose for TIFR ordering
-      __device__ __host__ inline void load(complex v[9], int x, int dir, int parity, real = 1.0) const
+      __device__ __host__ inline void load(Complex v[9], int x, int dir, int parity, real = 1.0) const
       {
         auto in = &gauge[((dir * 2 + parity) * volumeCB + x) * length];
-        complex v_[9];
-        block_load<complex, 9>(v_, reinterpret_cast<complex *>(in));
+        Complex v_[9];
+        block_load<Complex, 9>(v_, reinterpret_cast<Complex *>(in));
 
         for (int i = 0; i < Nc; i++) {
           for (int j = 0; j < Nc; j++) { v[i * Nc + j] = v_[j * Nc + i] * scale_inv; }
         }
       }
 
-      __device__ __host__ inline void save(const complex v[9], int x, int dir, int parity) const
+      __device__ __host__ inline void save(const Complex v[9], int x, int dir, int parity) const
       {
         auto out = &gauge[((dir * 2 + parity) * volumeCB + x) * length];
-        complex v_[9];
+        Complex v_[9];
         for (int i = 0; i < Nc; i++) {
           for (int j = 0; j < Nc; j++) { v_[i * Nc + j] = v[j * Nc + i] * scale; }
         }
 
-        block_store<complex, 9>(reinterpret_cast<complex *>(out), v_);
+        block_store<Complex, 9>(reinterpret_cast<Complex *>(out), v_);
       }
 
       /**
@@ -2237,7 +2237,7 @@ namespace quda {
     template <typename Float, int length> struct TIFRPaddedOrder : LegacyOrder<Float,length> {
       using Accessor = TIFRPaddedOrder<Float, length>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using Complex = complex<real>;
       Float *gauge;
       const int volumeCB;
       int exVolumeCB;
@@ -2278,29 +2278,29 @@ namespace quda {
       }
 
       // we need to transpose for TIFR ordering
-      __device__ __host__ inline void load(complex v[9], int x, int dir, int parity, real = 1.0) const
+      __device__ __host__ inline void load(Complex v[9], int x, int dir, int parity, real = 1.0) const
       {
         int y = getPaddedIndex(x, parity);
         auto in = &gauge[((dir * 2 + parity) * exVolumeCB + y) * length];
-        complex v_[9];
-        block_load<complex, 9>(v_, reinterpret_cast<complex *>(in));
+        Complex v_[9];
+        block_load<Complex, 9>(v_, reinterpret_cast<Complex *>(in));
 
         for (int i = 0; i < Nc; i++) {
           for (int j = 0; j < Nc; j++) { v[i * Nc + j] = v_[j * Nc + i] * scale_inv; }
         }
       }
 
-      __device__ __host__ inline void save(const complex v[9], int x, int dir, int parity) const
+      __device__ __host__ inline void save(const Complex v[9], int x, int dir, int parity) const
       {
         int y = getPaddedIndex(x, parity);
         auto out = &gauge[((dir * 2 + parity) * exVolumeCB + y) * length];
 
-        complex v_[9];
+        Complex v_[9];
         for (int i = 0; i < Nc; i++) {
           for (int j = 0; j < Nc; j++) { v_[i * Nc + j] = v[j * Nc + i] * scale; }
         }
 
-        block_store<complex, 9>(reinterpret_cast<complex *>(out), v_);
+        block_store<Complex, 9>(reinterpret_cast<Complex *>(out), v_);
       }
 
       /**
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+   @file host_numa.h
+
+   @section NUMA placement of large host allocations.  By default the
+   pages of a host allocation are placed on the NUMA node of the
+   thread that first touches them, which for fields initialized by a
+   single thread is the node of the master thread.  The placement is
+   set with the QUDA_HOST_NUMA environment variable:
+
+   - first-touch: the pages are touched in parallel by the host
+     threads, each taking the same contiguous share that a
+     statically scheduled host kernel would, so they are placed on the
+     node of the thread that will use them (this requires the threads
+     to be pinned, e.g., with OMP_PROC_BIND).  Since the placement is
+     made once, at allocation, it can only match one partitioning:
+     that of a static schedule over all host::max_threads() threads.
+     A host kernel that is tuned to a dynamic schedule, or to fewer
+     threads, hands out its chunks differently and will access some
+     pages remotely.
+   - interleave: the pages are interleaved across all online nodes
+   - a comma-separated list of nodes, e.g., 0,1: the pages are bound
+     to these nodes
+
+   Additionally, QUDA_HOST_HUGEPAGES=1 requests transparent huge pages
+   for these allocations.
+ */
+
+namespace quda
+{
+
+  namespace numa
+  {
+
+    /**
+       @brief Apply the NUMA placement to a freshly allocated host
+       buffer, which must not have been touched yet.  Buffers smaller
+       than a huge page are left alone, since they are likely served
+       from pages the allocator has already touched.
+       @param[in] ptr The buffer
+       @param[in] bytes The size of the buffer
+     */
+    void place(void *ptr, size_t bytes);
+
+  } // namespace numa
+
+} // namespace quda
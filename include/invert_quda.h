@@ -265,6 +265,28 @@ namespace quda {
     /** Which external lib to use in the solver */
     QudaExtLibType extlib_type;
 
+    /** Maximum dimension of the recycled subspace kept resident by GCRO-DR */
+    int recycle_max_dim = 0;
+
+    /** Index of the resident recycled subspace used by GCRO-DR */
+    int recycle_index = 0;
+
+    /** File to checkpoint the solver state to (empty disables
+        checkpointing).  The checkpoint settings are deliberately not
+        copied by the copy constructor, which is used to derive the
+        parameters of nested solvers, so only the outer solver
+        checkpoints */
+    std::string checkpoint_file;
+
+    /** Minimum number of iterations between checkpoints */
+    int checkpoint_interval = 0;
+
+    /** Signal that requests a checkpoint (0 disables) */
+    int checkpoint_signal = 0;
+
+    /** Whether to resume the first solve from checkpoint_file */
+    bool checkpoint_resume = false;
+
     /**
        Default constructor
      */
@@ -349,7 +371,13 @@ namespace quda {
       global_reduction(true),
       mg_instance(false),
       precondition_no_advanced_feature(param.schwarz_type == QUDA_ADDITIVE_SCHWARZ),
-      extlib_type(param.extlib_type)
+      extlib_type(param.extlib_type),
+      recycle_max_dim(param.recycle_max_dim),
+      recycle_index(param.recycle_index),
+      checkpoint_file(param.checkpoint_file),
+      checkpoint_interval(param.checkpoint_interval),
+      checkpoint_signal(param.checkpoint_signal),
+      checkpoint_resume(param.checkpoint_resume == QUDA_BOOLEAN_TRUE)
     {
       if (deflate) { eig_param = *(static_cast<QudaEigParam *>(param.eig_param)); }
       for (int i=0; i<num_offset; i++) {
@@ -439,7 +467,9 @@ namespace quda {
       mg_instance(param.mg_instance),
       madwf_param(param.madwf_param),
       precondition_no_advanced_feature(param.precondition_no_advanced_feature),
-      extlib_type(param.extlib_type)
+      extlib_type(param.extlib_type),
+      recycle_max_dim(param.recycle_max_dim),
+      recycle_index(param.recycle_index)
     {
       for (int i=0; i<num_offset; i++) {
 	offset[i] = param.offset[i];
@@ -489,6 +519,9 @@ namespace quda {
       param.ca_lambda_min_precondition = ca_lambda_min_precondition;
       param.ca_lambda_max_precondition = ca_lambda_max_precondition;
 
+      // a resumed checkpoint is consumed, so later solves with this param start afresh
+      if (!checkpoint_resume) param.checkpoint_resume = QUDA_BOOLEAN_FALSE;
+
       if (deflate) *static_cast<QudaEigParam *>(param.eig_param) = eig_param;
     }
 
@@ -519,6 +552,73 @@ namespace quda {
 
     bool mixed() { return param.precision != param.precision_sloppy; }
 
+    int checkpoint_iter = 0;                   /** Iteration count of the most recent checkpoint */
+    std::string checkpoint_fingerprint;        /** Identifies the system being solved, see checkpointResume */
+    double checkpoint_b2 = 0.0;                /** Norm squared of the source being solved */
+    int checkpoint_signal_installed = 0;       /** Signal whose handler this solver installed */
+    void (*checkpoint_signal_prev)(int) = nullptr; /** Handler to restore on destruction */
+
+    /**
+       @return Whether this solver checkpoints its state: only outer
+       solvers do, since a preconditioner's state is transient
+     */
+    bool checkpointEnabled() const { return !param.is_preconditioner && !param.checkpoint_file.empty(); }
+
+    /**
+       @brief Whether a checkpoint should be taken now, either since
+       checkpoint_interval iterations have passed since the last one,
+       or since checkpoint_signal has been received by any process.
+       This is collective when checkpoint_signal is set, so should
+       only be called at the (infrequent) points where the solver
+       state is consistent, e.g., reliable updates or restarts.
+       @param[in] k The current iteration count
+       @return Whether a checkpoint is due
+     */
+    bool checkpointDue(int k);
+
+    /**
+       @brief Save the solver state to param.checkpoint_file.  The
+       vectors are written with VectorIO (at a precision no lower than
+       single), the scalars and iteration count alongside them in a
+       "<file>.state" text file.  Both are written to temporaries that
+       are only renamed once complete, so a job killed while writing
+       leaves the previous checkpoint intact.
+       @param[in] name The solver name, recorded to validate a resume
+       @param[in] v The vectors to save (precisions may differ)
+       @param[in] scalar The scalars to save
+       @param[in] k The current iteration count
+     */
+    void checkpointSave(const char *name, cvector_ref<const ColorSpinorField> &v, const std::vector<double> &scalar,
+                        int k);
+
+    /**
+       @brief Restore the solver state from param.checkpoint_file, if
+       param.checkpoint_resume is set and a checkpoint of the same
+       system exists.  The system is identified by a fingerprint of
+       the solver and operator types, the lattice and precisions, the
+       mass, kappa, mu and shift of the operator, and |b|^2, which is
+       saved with every checkpoint.  A checkpoint of another system is
+       refused, leaving checkpoint_resume set in case a later solve
+       matches it; otherwise checkpoint_resume is cleared.  This must
+       be called at the start of every solve that checkpoints, since
+       it also sets the fingerprint and resets the interval.
+       @param[in] name The solver name, which must match the checkpoint
+       @param[in] b The source vector
+       @param[in] b2 The norm squared of the source vector
+       @param[out] v The vectors to restore into, matching those saved
+       @param[out] scalar The scalars to restore, matching those saved
+       @param[out] k The iteration count of the checkpoint (unchanged if not resuming)
+       @return Whether the state was restored
+     */
+    bool checkpointResume(const char *name, const ColorSpinorField &b, double b2, cvector_ref<ColorSpinorField> &v,
+                          std::vector<double> &scalar, int &k);
+
+    /**
+       @brief Remove the checkpoint once the solve has converged, so
+       that it cannot be resumed by a later solve
+     */
+    void checkpointRemove();
+
   public:
     Solver(const DiracMatrix &mat, const DiracMatrix &matSloppy, const DiracMatrix &matPrecon,
            const DiracMatrix &matEig, SolverParam &param, TimeProfile &profile);
@@ -870,6 +970,47 @@ namespace quda {
     virtual bool hermitian() { return true; } /** CG is only for Hermitian systems */
   };
 
+  /**
+     @brief Pipelined conjugate gradient (Ghysels and Vanroose,
+     Parallel Computing 40, 224 (2014)).  The two inner products of
+     each iteration are fused into a single non-blocking global
+     reduction, which is overlapped with the application of the
+     operator.  The price is three extra recurrences (w = A r, s = A p
+     and z = A s), whose drift from the true vectors is bounded by
+     residual replacement, triggered with the same conditions as the
+     reliable updates of CG.
+   */
+  class PipeCG : public Solver
+  {
+
+  private:
+    ColorSpinorField r;  /** true residual */
+    ColorSpinorField y;  /** high-precision solution accumulator */
+    ColorSpinorField rS; /** sloppy residual, aliases r when not mixed precision */
+    ColorSpinorField xS; /** sloppy solution since the last residual replacement */
+    ColorSpinorField pS; /** search direction */
+    ColorSpinorField sS; /** s = A p */
+    ColorSpinorField wS; /** w = A r */
+    ColorSpinorField zS; /** z = A s */
+    ColorSpinorField qS; /** q = A w */
+    bool init = false;
+
+    /**
+       @brief Initiate the fields needed by the solver
+       @param[in] x Solution vector
+       @param[in] b Source vector
+    */
+    void create(ColorSpinorField &x, const ColorSpinorField &b);
+
+  public:
+    PipeCG(const DiracMatrix &mat, const DiracMatrix &matSloppy, const DiracMatrix &matPrecon, SolverParam &param,
+           TimeProfile &profile);
+
+    void operator()(ColorSpinorField &out, ColorSpinorField &in);
+
+    virtual bool hermitian() { return true; } /** PipeCG is only for Hermitian systems */
+  };
+
   class CG3NE : public CG3
   {
 
@@ -1521,6 +1662,77 @@ public:
     }
   };
 
+  /**
+     @brief Base class for solvers of a system with several right-hand
+     sides, Ax_i = b_i, that share the Krylov space between the sources
+   */
+  class MultiSrcSolver
+  {
+
+  protected:
+    const DiracMatrix &mat;
+    const DiracMatrix &matSloppy;
+    SolverParam &param;
+    TimeProfile &profile;
+
+  public:
+    MultiSrcSolver(const DiracMatrix &mat, const DiracMatrix &matSloppy, SolverParam &param, TimeProfile &profile) :
+      mat(mat), matSloppy(matSloppy), param(param), profile(profile)
+    {
+    }
+
+    virtual ~MultiSrcSolver() = default;
+
+    /**
+       @brief Solve for all sources at once
+       @param[in,out] out Solution vectors, used as initial guess if requested
+       @param[in] in Source vectors
+     */
+    virtual void operator()(std::vector<ColorSpinorField> &out, std::vector<ColorSpinorField> &in) = 0;
+
+    /**
+       @brief Create a multiple-source solver of type param.inv_type
+       @return Pointer to the solver
+     */
+    static MultiSrcSolver *create(SolverParam &param, const DiracMatrix &mat, const DiracMatrix &matSloppy,
+                                  TimeProfile &profile);
+  };
+
+  /**
+     @brief Block conjugate gradient for multiple right-hand sides, in
+     the BCGrQ formulation of Dubrulle (ETNA 12, 216 (2001)) that
+     carries an orthonormal basis Q of the block residual R = Q C.  The
+     basis is computed with a rank-revealing Cholesky QR, i.e., from the
+     eigendecomposition of the Gram matrix, and directions that have
+     become linearly dependent are dropped from the block.  This
+     deflation removes the breakdown of O'Leary's block CG when the
+     residuals become degenerate, e.g., as individual sources converge.
+   */
+  class MultiSrcCG : public MultiSrcSolver
+  {
+
+  private:
+    int n_src = 0;
+    std::vector<ColorSpinorField> r;  /** true residuals */
+    std::vector<ColorSpinorField> y;  /** high-precision solution accumulators */
+    std::vector<ColorSpinorField> xS; /** sloppy solutions since the last reliable update */
+    std::vector<ColorSpinorField> Q;  /** orthonormal basis of the block residual */
+    std::vector<ColorSpinorField> P;  /** block search directions */
+    std::vector<ColorSpinorField> AP; /** A P */
+    std::vector<ColorSpinorField> T;  /** temporary block */
+
+    /**
+       @brief Initiate the fields needed by the solver
+       @param[in] x Solution vectors
+       @param[in] b Source vectors
+    */
+    void create(const std::vector<ColorSpinorField> &x, const std::vector<ColorSpinorField> &b);
+
+  public:
+    MultiSrcCG(const DiracMatrix &mat, const DiracMatrix &matSloppy, SolverParam &param, TimeProfile &profile);
+
+    void operator()(std::vector<ColorSpinorField> &out, std::vector<ColorSpinorField> &in);
+  };
 
   /**
      @brief This computes the optimum guess for the system Ax=b in the L2
@@ -1572,6 +1784,41 @@ public:
     */
     void operator()(ColorSpinorField &x, const ColorSpinorField &b, std::vector<ColorSpinorField> &p,
                     std::vector<ColorSpinorField> &q);
+
+    /**
+       @brief Construct the guess from an already orthonormal basis,
+       which may be stored at a lower precision than the operator.
+       Each basis vector is promoted to the precision of b in turn,
+       the operator applied, and its column of the projected system
+       accumulated with a fused multi-dot product, so no A p_i basis
+       is stored.  The local contributions are reduced globally only
+       once.  For a non-Hermitian operator the normal system is
+       formed instead, which needs the A p_i retained: these are
+       stored at the precision of the basis rather than that of the
+       operator.
+       @param x The optimum for the solution vector.
+       @param b The source vector, at the precision of the operator
+       @param p The orthonormal basis vectors
+    */
+    void operator()(ColorSpinorField &x, const ColorSpinorField &b, cvector_ref<const ColorSpinorField> &p);
+
+    /**
+       @brief Add a new vector to an orthonormal basis.  The vector is
+       orthogonalised against the retained basis vectors (classical
+       Gram-Schmidt applied twice, each pass using a fused multi-dot
+       product), normalised and then stored at the front of the basis
+       at the requested precision.  If the basis is full then the last
+       (oldest) vector is dropped.  A vector that is numerically
+       dependent on the retained basis is not added.
+       @param p The orthonormal basis
+       @param v The new vector
+       @param max_dim The maximum basis size
+       @param replace_first Whether the new vector replaces p[0] rather than being added
+       @param precision The precision at which the basis is stored
+       @return Whether the vector was added to the basis
+    */
+    static bool insert(std::vector<ColorSpinorField> &p, const ColorSpinorField &v, int max_dim, bool replace_first,
+                       QudaPrecision precision);
   };
 
   using ColorSpinorFieldSet = ColorSpinorField;
@@ -1673,6 +1920,86 @@ public:
     bool hermitian() { return false; } // GMRESDR for any linear system
  };
 
+  /**
+     @brief GCRO-DR: restarted GMRES augmented with a recycled subspace
+     U, where C = A U is orthonormal (Parks et al, SIAM J. Sci. Comput.
+     28, 1651 (2006)).  Each cycle builds an Arnoldi basis V for the
+     operator projected orthogonally to C, minimizes the residual over
+     [U V], and replaces U with the harmonic Ritz vectors of that cycle
+     that have the smallest harmonic Ritz values.
+
+     The recycled subspace is kept resident between solves, indexed by
+     recycle_index, so a sequence of slowly varying systems (e.g.,
+     successive HMC trajectories or propagator sources) starts from the
+     subspace of the previous solve.  At the start of each solve C is
+     recomputed with the current operator, which takes recycle_dim
+     operator applications instead of an eigensolve.  A subspace that
+     is incompatible with the system, or far from invariant under the
+     current operator, is discarded and the solve starts from a plain
+     GMRES cycle.
+
+     The Krylov and recycled spaces are in the sloppy precision, and the
+     true residual is recomputed at the end of every cycle.
+   */
+  class GCRODR : public Solver
+  {
+
+  private:
+    int n_krylov; /** total dimension of the cycle subspace [U V] */
+    int n_recycle; /** maximum dimension of the recycled subspace */
+
+    ColorSpinorField r;  /** true residual */
+    ColorSpinorField rS; /** sloppy residual, aliases r when not mixed precision */
+    ColorSpinorField xS; /** sloppy solution since the last true residual */
+    std::vector<ColorSpinorField> W; /** [C V] basis of the cycle, C occupying the leading vectors */
+    std::vector<ColorSpinorField> U_new; /** work space for the recycled subspace update */
+    std::vector<ColorSpinorField> C_new; /** work space for the recycled subspace update */
+    bool init = false;
+
+    /**
+       @brief Initiate the fields needed by the solver
+       @param[in] x Solution vector
+       @param[in] b Source vector
+    */
+    void create(ColorSpinorField &x, const ColorSpinorField &b);
+
+    /**
+       @brief Prepare the resident subspace U for the current operator:
+       compute C = A U, orthonormalise C (updating U to match) and
+       discard U if it is incompatible or stale.
+       @param[in,out] U The recycled subspace
+       @return The dimension of the recycled subspace
+    */
+    int prepareRecycle(std::vector<ColorSpinorField> &U);
+
+    /**
+       @brief Run a single GCRO-DR cycle, and update the recycled subspace
+       @param[in,out] U The recycled subspace
+       @param[in] k The dimension of the recycled subspace
+       @param[in] r2 The norm squared of the sloppy residual
+       @param[in] stop The norm squared of the residual at which the cycle is terminated early
+       @param[out] n_iter The number of operator applications of this cycle
+       @return The dimension of the updated recycled subspace
+    */
+    int cycle(std::vector<ColorSpinorField> &U, int k, double r2, double stop, int &n_iter);
+
+  public:
+    static constexpr int max_recycle = 12; /** the number of resident recycled subspaces */
+
+    GCRODR(const DiracMatrix &mat, const DiracMatrix &matSloppy, const DiracMatrix &matPrecon, SolverParam &param,
+           TimeProfile &profile);
+
+    void operator()(ColorSpinorField &out, ColorSpinorField &in);
+
+    virtual bool hermitian() { return false; } /** GCRO-DR is for any linear system */
+
+    /**
+       @brief Free the resident recycled subspace with the given index
+       @param[in] index The index of the recycled subspace
+    */
+    static void flushRecycle(int index);
+  };
+
  /**
     @brief This is an object that captures the state required for a
     deflated solver.
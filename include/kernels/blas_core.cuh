@@ -422,5 +422,29 @@ namespace quda
       constexpr int flops() const { return 6; }   //! flops per element
     };
 
+    /**
+       void pipeCGUpdate(d a, d b, V x, V y, V z, V w){}
+       First performs the operation y[i] = x[i] + b*y[i]
+       Second performs the operation w[i] = z[i] + b*w[i]
+       Third performs the operation z[i] = z[i] - a*y[i]
+    */
+    template <typename real> struct pipeCGUpdate_ : public BlasFunctor {
+      static constexpr memory_access<1, 1, 1, 1> read{ };
+      static constexpr memory_access<0, 1, 1, 1> write{ };
+      const real a;
+      const real b;
+      pipeCGUpdate_(const real &a, const real &b, const real &) : a(a), b(b) { ; }
+      template <typename T> __device__ __host__ void operator()(T &x, T &y, T &z, T &w, T &) const
+      {
+#pragma unroll
+        for (int i = 0; i < x.size(); i++) {
+          y[i] = x[i] + b * y[i];
+          w[i] = z[i] + b * w[i];
+          z[i] -= a * y[i];
+        }
+      }
+      constexpr int flops() const { return 6; }   //! flops per element
+    };
+
   } // namespace blas
 } // namespace quda
@@ -15,7 +15,7 @@ namespace quda
 
     static constexpr int nColor = nColor_;
 
-    using DomainWall4DArg = DomainWall4DArg<Float, nColor, nDim, reconstruct_>;
+    using DomainWall4DArg = quda::DomainWall4DArg<Float, nColor, nDim, reconstruct_>;
     using DomainWall4DArg::a_5;
     using DomainWall4DArg::dagger;
     using DomainWall4DArg::in;
@@ -31,7 +31,7 @@ namespace quda
 
     static constexpr Dslash5Type dslash5_type = dslash5_type_;
 
-    using Dslash5Arg = Dslash5Arg<Float, nColor, false, false, dslash5_type>;
+    using Dslash5Arg = quda::Dslash5Arg<Float, nColor, false, false, dslash5_type>;
     using Dslash5Arg::Ls;
 
     using real = typename mapper<Float>::type;
@@ -272,7 +272,7 @@ namespace quda
       int local_block_idx = target::block_idx().x % arg.blocks_per_dir;
       int dim_dir = target::block_idx().x / arg.blocks_per_dir;
       int dir = dim_dir % 2;
-      int dim;
+      int dim = -1;
       switch (dim_dir / 2) {
       case 0: dim = arg.dim_map[0]; break;
       case 1: dim = arg.dim_map[1]; break;
@@ -352,7 +352,7 @@ namespace quda
     {
       if (arg.nParity == 1) parity = arg.parity;
       packShmem<Arg::dagger, Arg::pc_type, Arg> pack;
-      pack.operator()<Arg::twist>(arg, s, parity);
+      pack.template operator()<Arg::twist>(arg, s, parity);
     }
   };
 
@@ -403,7 +403,7 @@ namespace quda
       int local_block_idx = target::block_idx().x % arg.blocks_per_dir;
       int dim_dir = target::block_idx().x / arg.blocks_per_dir;
       int dir = dim_dir % 2;
-      int dim;
+      int dim = -1;
       switch (dim_dir / 2) {
       case 0: dim = arg.dim_map[0]; break;
       case 1: dim = arg.dim_map[1]; break;
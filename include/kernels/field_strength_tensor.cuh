@@ -181,7 +181,7 @@ namespace quda
 
     __device__ __host__ inline void operator()(int x_cb, int parity, int mu_nu)
     {
-      int mu, nu;
+      int mu = -1, nu = -1;
       switch (mu_nu) { // F[1,0], F[2,0], F[2,1], F[3,0], F[3,1], F[3,2]
       case 0: mu = 1, nu = 0; break;
       case 1: mu = 2, nu = 0; break;
@@ -262,7 +262,7 @@ namespace quda {
     {
       int X[4];
       for (int dr = 0; dr < 4; dr++) X[dr] = arg.X[dr];
-      int x[4];
+      int x[4] = {};
       int za, xodd;
       int borderid = Arg::top ? arg.X[arg.dim] - 1 : 0;
       int parity = Arg::top ? arg.parity : 1 - arg.parity;
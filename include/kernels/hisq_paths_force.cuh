@@ -209,7 +209,7 @@ namespace quda {
 
     template <typename store_t, int nColor_, QudaReconstructType recon, QudaStaggeredPhase phase>
     struct OneLinkArg : public BaseForceArg<store_t, nColor_, recon, phase> {
-      using BaseForceArg = BaseForceArg<store_t, nColor_, recon, phase>;
+      using BaseForceArg = fermion_force::BaseForceArg<store_t, nColor_, recon, phase>;
       using real = typename mapper<store_t>::type;
       static constexpr int nColor = nColor_;
       using Link = typename gauge_mapper<real, QUDA_RECONSTRUCT_NO>::type;
@@ -278,7 +278,7 @@ namespace quda {
      **************************************************************************/
     template <typename store_t, int nColor_, QudaReconstructType recon, QudaStaggeredPhase phase>
     struct AllThreeAllLepageLinkArg : public BaseForceArg<store_t, nColor_, recon, phase> {
-      using BaseForceArg = BaseForceArg<store_t, nColor_, recon, phase>;
+      using BaseForceArg = fermion_force::BaseForceArg<store_t, nColor_, recon, phase>;
       using real = typename mapper<store_t>::type;
       static constexpr int nColor = nColor_;
       using Link = typename gauge_mapper<real, QUDA_RECONSTRUCT_NO>::type;
@@ -628,7 +628,7 @@ namespace quda {
      **************************************************************************/
     template <typename store_t, int nColor_, QudaReconstructType recon, QudaStaggeredPhase phase>
     struct AllFiveAllSevenLinkArg : public BaseForceArg<store_t, nColor_, recon, phase> {
-      using BaseForceArg = BaseForceArg<store_t, nColor_, recon, phase>;
+      using BaseForceArg = fermion_force::BaseForceArg<store_t, nColor_, recon, phase>;
       using real = typename mapper<store_t>::type;
       static constexpr int nColor = nColor_;
       using Link = typename gauge_mapper<real, QUDA_RECONSTRUCT_NO>::type;
@@ -996,7 +996,7 @@ namespace quda {
 
     template <typename store_t, int nColor_, QudaReconstructType recon, QudaStaggeredPhase phase>
     struct CompleteForceArg : public BaseForceArg<store_t, nColor_, recon, phase> {
-      using BaseForceArg = BaseForceArg<store_t, nColor_, recon, phase>;
+      using BaseForceArg = fermion_force::BaseForceArg<store_t, nColor_, recon, phase>;
       using real = typename mapper<store_t>::type;
       static constexpr int nColor = nColor_;
       using Link = typename gauge_mapper<real, QUDA_RECONSTRUCT_NO>::type;
@@ -1044,7 +1044,7 @@ namespace quda {
 
     template <typename store_t, int nColor_, QudaReconstructType recon, QudaStaggeredPhase phase>
     struct LongLinkArg : public BaseForceArg<store_t, nColor_, recon, phase> {
-      using BaseForceArg = BaseForceArg<store_t, nColor_, recon, phase>;
+      using BaseForceArg = fermion_force::BaseForceArg<store_t, nColor_, recon, phase>;
       using real = typename mapper<store_t>::type;
       static constexpr int nColor = nColor_;
       using Link = typename gauge_mapper<real, QUDA_RECONSTRUCT_NO>::type;
@@ -223,7 +223,7 @@ namespace quda {
 
     __device__ __host__ void operator()(int x_cb, int parity, int mu_idx)
     {
-      int mu;
+      int mu = -1;
       switch(mu_idx) {
       case 0: mu = arg.mu_map[0]; break;
       case 1: mu = arg.mu_map[1]; break;
@@ -38,7 +38,7 @@ namespace quda {
     {
       auto &X = arg.X;
       auto &Xh = arg.Xh;
-      int x[4];
+      int x[4] = {};
       int za, xodd;
       switch ( arg.face ) {
       case 0: //X FACE
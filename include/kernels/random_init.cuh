@@ -22,8 +22,10 @@ namespace quda {
       for (int i=0; i<4; i++) {
         commCoord[i] = comm_coord(i);
         X[i] = meta.LocalX()[i];
-        X_global[i] = X[i] * comm_dim(i);
       }
+      // the coordinates are computed on the full lattice, so undo the checkerboarding of a single-parity meta
+      if (meta.SiteSubset() == QUDA_PARITY_SITE_SUBSET) X[0] *= 2;
+      for (int i = 0; i < 4; i++) X_global[i] = X[i] * comm_dim(i);
     }
   };
 
@@ -657,6 +657,36 @@ namespace quda
       constexpr int flops() const { return 16; }  //! flops per element check if it's right
     };
 
+    /**
+       double2 pipeCGUpdateNorm(d a, d b, V x, V y, V z, V w, V v){}
+        y = z + b*y;
+        x += a*y;
+        z -= a*w;
+        norm2(z);
+        dot(v, z);
+    */
+    template <typename real_reduce_t, typename real>
+    struct pipeCGUpdateNorm_ : public ReduceFunctor<array<real_reduce_t, 2>> {
+      using reduce_t = array<real_reduce_t, 2>;
+      static constexpr memory_access<1, 1, 1, 1, 1> read{ };
+      static constexpr memory_access<1, 1, 1> write{ };
+      const real a;
+      const real b;
+      pipeCGUpdateNorm_(const real &a, const real &b) : a(a), b(b) { ; }
+      template <typename T> __device__ __host__ void operator()(reduce_t &sum, T &x, T &y, T &z, T &w, T &v) const
+      {
+#pragma unroll
+        for (int i = 0; i < x.size(); i++) {
+          y[i] = z[i] + b * y[i];
+          x[i] += a * y[i];
+          z[i] -= a * w[i];
+          norm2_<real_reduce_t, real>(sum[0], z[i]);
+          dot_<real_reduce_t, real>(sum[1], v[i], z[i]);
+        }
+      }
+      constexpr int flops() const { return 10; }  //! flops per element
+    };
+
   } // namespace blas
 
 } // namespace quda
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <iostream>
+#include <map>
 #include <quda_internal.h>
 #include <comm_quda.h>
 #include <util_quda.h>
@@ -397,6 +398,28 @@ namespace quda {
     */
     inline static array_3d<MsgHandle *, 2, QUDA_MAX_DIM, 2> mh_send_p2p = {};
 
+    /**
+       A persistent set of halo messages that is started with a single
+       call, e.g., the receives of all non-peer-to-peer faces
+    */
+    struct HaloPlan {
+      MsgPlan *plan = nullptr;                   /** the message set */
+      bool gdr = false;                          /** whether the set uses the GDR message handles */
+      array_2d<int, QUDA_MAX_DIM, 2> index = {}; /** index of each face [dim][dir] in the set, or -1 */
+    };
+
+    /**
+       Cache of halo message sets, keyed by buffer index, send or
+       receive, GDR and the mask of faces included
+    */
+    std::map<int, HaloPlan> halo_plans;
+
+    /**
+       The most recently started message set for each buffer index
+       and for receive (0) or send (1), which may be queried
+    */
+    array_2d<HaloPlan *, 2, 2> halo_plan_active = {};
+
     /**
        Buffer used by peer-to-peer message handler
     */
@@ -545,6 +568,40 @@ namespace quda {
     */
     void destroyComms();
 
+    /**
+       @brief Start the halo messages of a set of faces with a single
+       call, where the set is created on first use and cached.  The
+       started set becomes the active set for the current buffer
+       index, which is then used by haloPlanQuery.
+       @param[in] mask The faces to start, with bit 2 * dim + dir set
+       for face [dim][dir]
+       @param[in] send Whether to start the sends or the receives
+       @param[in] gdr Whether to use the GDR message handles
+    */
+    void haloPlanStart(int mask, bool send, bool gdr);
+
+    /**
+       @brief Non-blocking query of a halo message through the active
+       set of the current buffer index
+       @param[in] dim The dimension of the face
+       @param[in] dir The direction of the face
+       @param[in] send Whether to query the send or the receive
+       @param[in] gdr Whether the GDR message handle is in use
+       @return Whether the message has completed, or -1 if it is not
+       part of the active set and must be queried individually
+    */
+    int haloPlanQuery(int dim, int dir, bool send, bool gdr);
+
+    /**
+       @brief Deactivate the active set of the current buffer index if
+       it contains a given face, e.g., since the message of that face
+       is being started individually
+       @param[in] dim The dimension of the face
+       @param[in] dir The direction of the face
+       @param[in] send Whether this is the send or the receive
+    */
+    void haloPlanClear(int dim, int dir, bool send);
+
     /**
        Create the inter-process communication handlers
     */
@@ -161,6 +161,12 @@ namespace quda {
     */
     void flush_pinned();
 
+    /**
+       @brief Print the statistics of the pool allocators, e.g., their
+       peak usage, hit rate and fragmentation.
+    */
+    void print_stats();
+
   } // namespace pool
 
 }
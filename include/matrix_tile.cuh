@@ -238,9 +238,9 @@ namespace quda {
     static constexpr int N_tiles = n / N;
     static constexpr int K_tiles = k / K;
 
-    static_assert(M > m == 0, "tile height must not be larger than matrix height");
-    static_assert(N > n == 0, "tile width must not be larger than matrix width");
-    static_assert(K > n == 0, "tile depth must not be larger than matrix depth");
+    static_assert(M <= m, "tile height must not be larger than matrix height");
+    static_assert(N <= n, "tile width must not be larger than matrix width");
+    static_assert(K <= k, "tile depth must not be larger than matrix depth");
     static_assert(m % M == 0, "tile height must be an integer divisor of the matrix height");
     static_assert(n % N == 0, "tile width must be an integer divisor of the matrix width");
     static_assert(k % K == 0, "tile depth must be an integer divisor of the matrix depth");
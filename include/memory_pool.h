@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+
+/**
+   @file memory_pool.h
+
+   @section Caching allocator used by the device and pinned memory
+   pools.  Memory is obtained from the underlying allocator in large
+   slabs, which are split into blocks to serve the requests, and freed
+   blocks are coalesced with their free neighbours in the slab.  A
+   request is served by the smallest free block that fits (best fit),
+   which is split if it would otherwise waste more than the maximum
+   waste ratio of the request.  The pool itself is plain host code,
+   and is independent of the memory space it manages.
+ */
+
+namespace quda
+{
+
+  /**
+     Statistics of a memory pool.  Live bytes are those of the blocks
+     handed out, including the rounding of the requests, cached bytes
+     are those of the free blocks held by the pool, and the reserved
+     bytes, which are their sum, are those obtained from the
+     underlying allocator.
+   */
+  struct MemoryPoolStats {
+    size_t live_bytes = 0;            /** bytes in blocks handed out */
+    size_t requested_bytes = 0;       /** bytes requested of the blocks handed out */
+    size_t cached_bytes = 0;          /** bytes in free blocks */
+    size_t reserved_bytes = 0;        /** bytes obtained from the underlying allocator */
+    size_t peak_live_bytes = 0;       /** peak of the live bytes */
+    size_t peak_reserved_bytes = 0;   /** peak of the reserved bytes */
+    size_t largest_free_block = 0;    /** size of the largest free block */
+    size_t peak_fragmented_bytes = 0; /** peak of the cached bytes outside the largest free block */
+    size_t n_live = 0;                /** number of blocks handed out */
+    size_t n_free = 0;                /** number of free blocks */
+    size_t n_slab = 0;                /** number of slabs held */
+    size_t n_alloc = 0;               /** number of requests served */
+    size_t n_hit = 0;                 /** number of requests served from cached blocks */
+    size_t n_split = 0;               /** number of blocks split */
+    size_t n_slab_alloc = 0;          /** number of calls to the underlying allocator */
+    size_t n_slab_free = 0;           /** number of calls to the underlying deallocator */
+
+    /**
+       @brief The fraction of the cached bytes that cannot be used by
+       a request of their total size, since they are split across
+       several blocks (external fragmentation)
+     */
+    double fragmentation() const
+    {
+      return cached_bytes > 0 ? 1.0 - static_cast<double>(largest_free_block) / cached_bytes : 0.0;
+    }
+
+    /**
+       @brief The fraction of the live bytes that exceed what was
+       requested (internal fragmentation)
+     */
+    double waste() const { return live_bytes > 0 ? 1.0 - static_cast<double>(requested_bytes) / live_bytes : 0.0; }
+  };
+
+  class MemoryPool
+  {
+
+  public:
+    /** Underlying allocator, called with the call site of the request that requires a new slab */
+    using allocator_t = std::function<void *(const char *func, const char *file, int line, size_t bytes)>;
+    /** Underlying deallocator */
+    using deallocator_t = std::function<void(const char *func, const char *file, int line, void *ptr)>;
+
+    /** Granularity (and alignment relative to the slab) of the blocks */
+    static constexpr size_t granularity = 512;
+
+  private:
+    struct block_t {
+      char *ptr;
+      size_t bytes;
+      size_t requested; /** bytes requested, if handed out */
+      bool free;
+      block_t *prev;    /** neighbouring block at lower address in the same slab */
+      block_t *next;    /** neighbouring block at higher address in the same slab */
+      char *slab;       /** base of the slab this block belongs to */
+    };
+
+    struct block_comp {
+      bool operator()(const block_t *a, const block_t *b) const
+      {
+        return a->bytes != b->bytes ? a->bytes < b->bytes : a->ptr < b->ptr;
+      }
+    };
+
+    const std::string name;
+    allocator_t allocator;
+    deallocator_t deallocator;
+    size_t slab_bytes;
+    double max_waste;
+
+    std::set<block_t *, block_comp> free_blocks; /** free blocks ordered by size */
+    std::map<void *, block_t *> live_blocks;     /** blocks handed out */
+    std::map<char *, size_t> slabs;              /** slabs obtained from the underlying allocator */
+
+    MemoryPoolStats stats;
+
+    /**
+       @brief Insert a free block, coalescing it with its free
+       neighbours in the slab
+     */
+    void insert_free(block_t *block);
+
+    /**
+       @brief Return the slabs that are entirely free to the underlying allocator
+     */
+    void release_free_slabs();
+
+    /**
+       @brief Update the derived statistics after the blocks have changed
+     */
+    void update_stats();
+
+  public:
+    /**
+       @brief Constructor for the memory pool
+       @param[in] name Name of the pool used when reporting
+       @param[in] allocator The underlying allocator
+       @param[in] deallocator The underlying deallocator
+       @param[in] slab_bytes Minimum size of the slabs obtained from the underlying allocator
+       @param[in] max_waste The maximum fraction of a request by which
+       a block handed out for it may be larger, before it is split
+     */
+    MemoryPool(const std::string &name, allocator_t allocator, deallocator_t deallocator, size_t slab_bytes,
+               double max_waste);
+
+    MemoryPool(const MemoryPool &) = delete;
+    MemoryPool &operator=(const MemoryPool &) = delete;
+
+    /**
+       @brief The destructor does not return the slabs, since the
+       underlying allocator may no longer be usable at this point, so
+       flush should be called first.
+     */
+    ~MemoryPool();
+
+    /**
+       @brief Allocate a block
+       @param[in] func Function of the call site
+       @param[in] file File of the call site
+       @param[in] line Line of the call site
+       @param[in] bytes Size of the request
+       @return Pointer to the block
+     */
+    void *allocate(const char *func, const char *file, int line, size_t bytes);
+
+    /**
+       @brief Return a block to the pool
+       @param[in] ptr Pointer to the block, which must have been returned by allocate
+     */
+    void free(void *ptr);
+
+    /**
+       @brief Whether the pointer is a block handed out by this pool
+     */
+    bool owns(void *ptr) const { return live_blocks.count(ptr) > 0; }
+
+    /**
+       @brief Return all slabs that have no live blocks to the underlying allocator
+     */
+    void flush();
+
+    /**
+       @brief Return the statistics of the pool
+     */
+    const MemoryPoolStats &get_stats() const { return stats; }
+
+    /**
+       @brief Print the statistics of the pool
+     */
+    void print_stats() const;
+  };
+
+} // namespace quda
@@ -193,6 +193,9 @@ namespace quda {
       transfer_type(param.transfer_type[level]),
       use_mma(param.use_mma == QUDA_BOOLEAN_TRUE)
     {
+      // the multigrid solvers are nested within the outer solver, so never checkpoint
+      checkpoint_file.clear();
+
       // set the block size
       for (int i = 0; i < QUDA_MAX_DIM; i++) geoBlockSize[i] = param.geo_block_size[level][i];
 
@@ -435,9 +435,39 @@ extern "C" {
     /** The index to indicate which chrono history we are augmenting */
     int chrono_index;
 
-    /** Precision to store the chronological basis in */
+    /** Precision to store the chronological basis in.  Any precision
+        up to cuda_prec is supported: the basis is kept orthonormal, so
+        half or quarter precision (with per-site norms) allow for a
+        longer history in the same memory */
     QudaPrecision chrono_precision;
 
+    /** The maximum dimension of the recycled subspace kept resident by the GCRO-DR solver */
+    int recycle_max_dim;
+
+    /** The index of the resident recycled subspace used by the GCRO-DR solver */
+    int recycle_index;
+
+    /** File to checkpoint the solver state to, and to resume it from
+        (an empty string disables checkpointing).  Supported by the CG,
+        GCR (including MG-preconditioned GCR) and BiCGstab solvers */
+    char checkpoint_file[256];
+
+    /** Minimum number of iterations between checkpoints, which are
+        taken at the next reliable update or restart (0 to only
+        checkpoint on checkpoint_signal) */
+    int checkpoint_interval;
+
+    /** Signal that requests a checkpoint at the next reliable update
+        or restart, e.g., SIGUSR1 sent by the batch system ahead of
+        the wall-clock limit (0 disables) */
+    int checkpoint_signal;
+
+    /** Whether to resume the solve from checkpoint_file, if it holds
+        a checkpoint of the same system.  This is cleared once a
+        checkpoint is resumed (or none is found), and the checkpoint
+        is removed once the solve converges */
+    QudaBoolean checkpoint_resume;
+
     /** Which external library to use in the linear solvers (Eigen) */
     QudaExtLibType extlib_type;
 
@@ -953,6 +983,35 @@ extern "C" {
 
   void initCommsGridQuda(int nDim, const int *dims, QudaCommsMap func, void *fdata);
 
+  /**
+   * Select the grid mapping automatically for a given lattice, for
+   * use with initCommsGridQuda().  The decomposition and the mapping
+   * of grid coordinates to ranks are chosen to minimize the halo
+   * traffic between nodes, and then the total halo traffic, where
+   * ranks with the same host name are taken to share a node.  This
+   * should be called after MPI (or QMP) has been initialized and
+   * before initCommsGridQuda(), e.g.,
+   *
+   *   selectCommsGridQuda(4, X, dims, &func, &fdata);
+   *   initCommsGridQuda(4, dims, func, fdata);
+   *
+   * @param nDim   Number of grid dimensions.  "4" is the only supported
+   *               value currently.
+   *
+   * @param X      Global lattice dimensions
+   *
+   * @param dims   Returned array of grid dimensions
+   *
+   * @param func   Returned mapping from grid coordinates to ranks
+   *
+   * @param fdata  Returned data for "func", which is owned by QUDA and
+   *               is valid until the next call
+   *
+   * @see initCommsGridQuda
+   */
+
+  void selectCommsGridQuda(int nDim, const int *X, int *dims, QudaCommsMap *func, void **fdata);
+
   /**
    * Initialize the library.  This is a low-level interface that is
    * called by initQuda.  Calling initQudaDevice requires that the
@@ -1182,6 +1241,8 @@ extern "C" {
    * is larger than 1, in which case gauge field is not required to be loaded beforehand; otherwise
    * this interface would just work as @invertQuda, which requires gauge field to be loaded beforehand,
    * and the gauge field pointer and gauge_param are not used.
+   * If inv_type is QUDA_BLOCK_CG_INVERTER, the rhs' of each sub-partition are solved together
+   * with block CG, which shares the Krylov space between them.
    * @param _hp_x       Array of solution spinor fields
    * @param _hp_b       Array of source spinor fields
    * @param param       Contains all metadata regarding host and device storage and solver parameters
@@ -1724,6 +1785,12 @@ extern "C" {
    */
   void flushChronoQuda(int index);
 
+  /**
+   * @brief Flush the recycled subspace of the GCRO-DR solver for the given index
+   * @param[in] index Index for which we are flushing
+   */
+  void flushRecycleQuda(int index);
+
 
   /**
   * Create deflation solver resources.
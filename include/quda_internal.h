@@ -7,12 +7,12 @@
 #include <complex>
 #include <vector>
 
-#if ((defined(QMP_COMMS) || defined(MPI_COMMS)) && !defined(MULTI_GPU))
-#error "MULTI_GPU must be enabled to use MPI or QMP"
+#if ((defined(QMP_COMMS) || defined(MPI_COMMS) || defined(SHM_COMMS)) && !defined(MULTI_GPU))
+#error "MULTI_GPU must be enabled to use MPI, QMP or shared-memory communications"
 #endif
 
-#if (!defined(QMP_COMMS) && !defined(MPI_COMMS) && defined(MULTI_GPU))
-#error "MPI or QMP must be enabled to use MULTI_GPU"
+#if (!defined(QMP_COMMS) && !defined(MPI_COMMS) && !defined(SHM_COMMS) && defined(MULTI_GPU))
+#error "MPI, QMP or shared-memory communications must be enabled to use MULTI_GPU"
 #endif
 
 #ifdef QMP_COMMS
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <cmath>
+#include <complex>
+#include <cstring>
+#include <vector>
+#include <quda_internal.h>
+
+/**
+   @file FFT_Plans.h
+
+   @section Host FFT for the CPU target.  This provides the same batched
+   complex-to-complex interface as the cuFFT/hipFFT wrappers of the GPU
+   targets, with the same data layout: the batches are contiguous, and
+   within a batch the last dimension of the plan runs fastest.  As
+   with cuFFT, the transforms are unnormalized.  Power-of-two lengths
+   use an iterative radix-2 transform, while other lengths fall back
+   to a direct DFT.
+ */
+
+#define FFT_FORWARD -1
+#define FFT_INVERSE 1
+
+namespace quda
+{
+
+  /**
+     The plan records the geometry of the batched transform
+   */
+  struct FFTPlanHandle {
+    int rank = 0;     /** rank of the transform (1, 2 or 3) */
+    int n[3] = {};    /** length of each dimension, outer-most first */
+    int batch = 0;    /** number of transforms */
+    QudaPrecision precision = QUDA_INVALID_PRECISION;
+  };
+
+  namespace fft
+  {
+
+    /**
+       @brief In-place 1-d transform of a contiguous line
+       @param[in,out] x The line being transformed
+       @param[in,out] tmp Scratch space for the direct DFT
+       @param[in] direction The transform direction (FFT_FORWARD or FFT_INVERSE)
+     */
+    template <typename T> void transform_line(std::vector<std::complex<T>> &x, std::vector<std::complex<T>> &tmp,
+                                              int direction)
+    {
+      const int n = x.size();
+      if (n <= 1) return;
+      const double sign = direction;
+
+      if ((n & (n - 1)) == 0) {
+        // bit-reversal permutation
+        for (int i = 1, j = 0; i < n; i++) {
+          int bit = n >> 1;
+          for (; j & bit; bit >>= 1) j ^= bit;
+          j ^= bit;
+          if (i < j) std::swap(x[i], x[j]);
+        }
+        // iterative Cooley-Tukey butterflies, with the twiddles computed in double precision
+        for (int len = 2; len <= n; len <<= 1) {
+          const double theta = sign * 2.0 * M_PI / len;
+          for (int k = 0; k < len / 2; k++) {
+            const std::complex<T> w(std::cos(theta * k), std::sin(theta * k));
+            for (int i = 0; i < n; i += len) {
+              auto u = x[i + k];
+              auto v = x[i + k + len / 2] * w;
+              x[i + k] = u + v;
+              x[i + k + len / 2] = u - v;
+            }
+          }
+        }
+      } else {
+        tmp.resize(n);
+        for (int k = 0; k < n; k++) {
+          std::complex<double> sum = 0.0;
+          for (int j = 0; j < n; j++) {
+            const double theta = sign * 2.0 * M_PI * ((static_cast<int64_t>(j) * k) % n) / n;
+            sum += std::complex<double>(x[j]) * std::complex<double>(std::cos(theta), std::sin(theta));
+          }
+          tmp[k] = std::complex<T>(sum);
+        }
+        x = tmp;
+      }
+    }
+
+    /**
+       @brief Apply the batched transform described by the plan in place
+       @param[in] plan The FFT plan
+       @param[in,out] data The data being transformed
+       @param[in] direction The transform direction (FFT_FORWARD or FFT_INVERSE)
+     */
+    template <typename T> void transform(const FFTPlanHandle &plan, std::complex<T> *data, int direction)
+    {
+      int64_t volume = 1;
+      for (int d = 0; d < plan.rank; d++) volume *= plan.n[d];
+
+      // transform along each dimension in turn; stride is the distance between elements of a line
+      int64_t stride = 1;
+      for (int d = plan.rank - 1; d >= 0; d--) {
+        const int n = plan.n[d];
+        const int64_t n_line = volume / n; // lines per batch
+        const int64_t n_total = n_line * plan.batch;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+          std::vector<std::complex<T>> line(n), tmp;
+#ifdef _OPENMP
+#pragma omp for
+#endif
+          for (int64_t l = 0; l < n_total; l++) {
+            const int64_t b = l / n_line;
+            const int64_t r = l % n_line;
+            // line r of batch b: split r into the indices slower and faster than dimension d
+            const int64_t offset = b * volume + (r / stride) * stride * n + r % stride;
+            line.resize(n);
+            for (int i = 0; i < n; i++) line[i] = data[offset + i * stride];
+            transform_line(line, tmp, direction);
+            for (int i = 0; i < n; i++) data[offset + i * stride] = line[i];
+          }
+        }
+        stride *= n;
+      }
+    }
+
+    /**
+       @brief Copy the input to the output (if out of place) and apply the transform
+     */
+    template <typename T, typename V>
+    void apply(const FFTPlanHandle &plan, V *data_in, V *data_out, int direction, QudaPrecision precision)
+    {
+      if (plan.precision != precision)
+        errorQuda("FFT plan precision %d does not match data precision %d", plan.precision, precision);
+      int64_t volume = plan.batch;
+      for (int d = 0; d < plan.rank; d++) volume *= plan.n[d];
+      if (data_in != data_out) memcpy(data_out, data_in, volume * sizeof(V));
+      transform(plan, reinterpret_cast<std::complex<T> *>(data_out), direction);
+    }
+
+    /**
+       @brief Initialize a plan
+     */
+    inline void set_plan(FFTPlanHandle &plan, int rank, const int *n, int batch, QudaPrecision precision)
+    {
+      plan.rank = rank;
+      for (int d = 0; d < rank; d++) plan.n[d] = n[d];
+      plan.batch = batch;
+      plan.precision = precision;
+    }
+
+  } // namespace fft
+
+  /**
+   * @brief Perform a single-precision complex-to-complex transform
+   * plan in the transform direction as specified by direction
+   * parameter
+   * @param[in] plan FFT plan
+   * @param[in] data_in, pointer to the complex input data to transform
+   * @param[out] data_out, pointer to the complex output data
+   * @param[in] direction, the transform direction: FFT_FORWARD or FFT_INVERSE
+   */
+  inline void ApplyFFT(FFTPlanHandle &plan, float2 *data_in, float2 *data_out, int direction)
+  {
+    fft::apply<float>(plan, data_in, data_out, direction, QUDA_SINGLE_PRECISION);
+  }
+
+  /**
+   * @brief Perform a double-precision complex-to-complex transform
+   * plan in the transform direction as specified by direction
+   * parameter
+   * @param[in] plan FFT plan
+   * @param[in] data_in, pointer to the complex input data to transform
+   * @param[out] data_out, pointer to the complex output data
+   * @param[in] direction, the transform direction: FFT_FORWARD or FFT_INVERSE
+   */
+  inline void ApplyFFT(FFTPlanHandle &plan, double2 *data_in, double2 *data_out, int direction)
+  {
+    fft::apply<double>(plan, data_in, data_out, direction, QUDA_DOUBLE_PRECISION);
+  }
+
+  /**
+   * @brief Creates a FFT plan supporting 4D (1D+3D) data layouts for complex-to-complex
+   * @param[out] plan, FFT plan
+   * @param[in] size, int4 with lattice size dimensions, (.x,.y,.z,.w) -> (Nx, Ny, Nz, Nt)
+   * @param[in] dim, 1 for 1D plan along the temporal direction with batch size Nx*Ny*Nz, 3 for 3D plan along Nx, Ny and
+   * Nz with batch size Nt
+   * @param[in] precision The precision of the computation
+   */
+  inline void SetPlanFFTMany(FFTPlanHandle &plan, int4 size, int dim, QudaPrecision precision)
+  {
+    switch (dim) {
+    case 1: {
+      int n[1] = {size.w};
+      fft::set_plan(plan, 1, n, size.x * size.y * size.z, precision);
+    } break;
+    case 3: {
+      int n[3] = {size.x, size.y, size.z};
+      fft::set_plan(plan, 3, n, size.w, precision);
+    } break;
+    }
+  }
+
+  /**
+   * @brief Creates a FFT plan supporting 4D (2D+2D) data layouts for complex-to-complex
+   * @param[out] plan, FFT plan
+   * @param[in] size, int4 with lattice size dimensions, (.x,.y,.z,.w) -> (Nx, Ny, Nz, Nt)
+   * @param[in] dim, 0 for 2D plan in Z-T planes with batch size Nx*Ny, 1 for 2D plan in X-Y planes with batch size Nz*Nt
+   * @param[in] precision The precision of the computation
+   */
+  inline void SetPlanFFT2DMany(FFTPlanHandle &plan, int4 size, int dim, QudaPrecision precision)
+  {
+    switch (dim) {
+    case 0: {
+      int n[2] = {size.w, size.z}; // outer-most dimension is first
+      fft::set_plan(plan, 2, n, size.x * size.y, precision);
+    } break;
+    case 1: {
+      int n[2] = {size.y, size.x}; // outer-most dimension is first
+      fft::set_plan(plan, 2, n, size.z * size.w, precision);
+    } break;
+    }
+  }
+
+  inline void FFTDestroyPlan(FFTPlanHandle &plan) { plan = FFTPlanHandle(); }
+
+} // namespace quda
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <algorithm>
+#include <array.h>
+
+/**
+   @file atomic_helper.h
+
+   @section Provides definitions of atomic functions that are used in
+   QUDA.  On the CPU target the blocks of the launch grid are
+   executed concurrently by the host threads, so these are
+   implemented with OpenMP atomics.
+ */
+
+namespace quda
+{
+
+  /**
+     @brief atomic_fetch_add function performs similarly as atomic_ref::fetch_add
+     @param[in,out] addr The memory address of the variable we are
+     updating atomically
+     @param[in] val The value we summing to the value at addr
+  */
+  template <typename T> inline void atomic_fetch_add(T *addr, T val)
+  {
+#pragma omp atomic update
+    *addr += val;
+  }
+
+  template <typename T> inline void atomic_fetch_add(complex<T> *addr, complex<T> val)
+  {
+    atomic_fetch_add(reinterpret_cast<T *>(addr) + 0, val.real());
+    atomic_fetch_add(reinterpret_cast<T *>(addr) + 1, val.imag());
+  }
+
+  template <typename T, int n> inline void atomic_fetch_add(array<T, n> *addr, array<T, n> val)
+  {
+    for (int i = 0; i < n; i++) atomic_fetch_add(&(*addr)[i], val[i]);
+  }
+
+  /**
+     @brief atomic_fetch_max function that does an atomic max.
+     @param[in,out] addr The memory address of the variable we are
+     updating atomically
+     @param[in] val The value we are comparing against.  Must be
+     positive valued else result is undefined.
+  */
+  template <typename T> inline void atomic_fetch_abs_max(T *addr, T val)
+  {
+#pragma omp critical(atomic_fetch_abs_max)
+    *addr = std::max(*addr, val);
+  }
+
+} // namespace quda
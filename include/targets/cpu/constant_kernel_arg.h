@@ -0,0 +1,16 @@
+#pragma once
+
+#include <target_device.h>
+
+/**
+   @file constant_kernel_arg.h
+
+   This file should be included in the kernel files for which we wish
+   to utilize __constant__ memory for the kernel parameter struct.
+   There is no constant memory on the CPU target, and the host
+   launcher always passes the parameter struct by reference (see
+   device::use_kernel_arg), so here we only set the preprocessor flag.
+ */
+
+// set a preprocessor flag that we have included constant_kernel_arg.h
+#define QUDA_USE_CONSTANT_MEMORY
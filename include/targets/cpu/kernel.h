@@ -0,0 +1,97 @@
+#pragma once
+#include <kernel_helper.h>
+#include <target_device.h>
+
+/**
+   @file kernel.h
+
+   @section Kernel entry points for the CPU target.  Each entry point
+   is a host function that executes a single thread of the launch
+   grid: the host launcher (qudaLaunchKernel) sets the emulated thread
+   and block indices of the calling host thread and then calls the
+   entry point once per thread, with the address of the parameter
+   struct as argument.
+ */
+
+namespace quda
+{
+
+  template <template <typename> class Functor, typename Arg, bool grid_stride = false>
+  __forceinline__ void Kernel1D_impl(const Arg &arg)
+  {
+    Functor<Arg> f(arg);
+
+    auto i = threadIdx.x + blockIdx.x * blockDim.x;
+
+    while (i < arg.threads.x) {
+      f(i);
+      if (grid_stride)
+        i += gridDim.x * blockDim.x;
+      else
+        break;
+    }
+  }
+
+  template <template <typename> class Functor, typename Arg, bool grid_stride = false>
+  void Kernel1D(const void *arg)
+  {
+    Kernel1D_impl<Functor, Arg, grid_stride>(*static_cast<const Arg *>(arg));
+  }
+
+  template <template <typename> class Functor, typename Arg, bool grid_stride = false>
+  __forceinline__ void Kernel2D_impl(const Arg &arg)
+  {
+    Functor<Arg> f(arg);
+
+    auto i = threadIdx.x + blockIdx.x * blockDim.x;
+    auto j = threadIdx.y + blockIdx.y * blockDim.y;
+    if (j >= arg.threads.y) return;
+
+    while (i < arg.threads.x) {
+      f(i, j);
+      if (grid_stride)
+        i += gridDim.x * blockDim.x;
+      else
+        break;
+    }
+  }
+
+  template <template <typename> class Functor, typename Arg, bool grid_stride = false>
+  void Kernel2D(const void *arg)
+  {
+    Kernel2D_impl<Functor, Arg, grid_stride>(*static_cast<const Arg *>(arg));
+  }
+
+  template <template <typename> class Functor, typename Arg, bool grid_stride = false>
+  __forceinline__ void Kernel3D_impl(const Arg &arg)
+  {
+    Functor<Arg> f(arg);
+
+    auto i = threadIdx.x + blockIdx.x * blockDim.x;
+    auto j = threadIdx.y + blockIdx.y * blockDim.y;
+    auto k = threadIdx.z + blockIdx.z * blockDim.z;
+    if (j >= arg.threads.y) return;
+    if (k >= arg.threads.z) return;
+
+    while (i < arg.threads.x) {
+      f(i, j, k);
+      if (grid_stride)
+        i += gridDim.x * blockDim.x;
+      else
+        break;
+    }
+  }
+
+  template <template <typename> class Functor, typename Arg, bool grid_stride = false>
+  void Kernel3D(const void *arg)
+  {
+    Kernel3D_impl<Functor, Arg, grid_stride>(*static_cast<const Arg *>(arg));
+  }
+
+  template <template <typename> class Functor, typename Arg, bool grid_stride = false> void raw_kernel(const void *arg)
+  {
+    Functor<Arg> f(*static_cast<const Arg *>(arg));
+    f();
+  }
+
+} // namespace quda
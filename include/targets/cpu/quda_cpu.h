@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+
+/**
+   @file quda_cpu.h
+
+   @section Compatibility layer for the CPU (host-only) target.  The
+   library is written in CUDA C++, so here we provide the function
+   qualifiers, vector types and intrinsics that the target-agnostic
+   code relies on, mapped onto plain C++.  With this target every
+   "device" is the host: kernels are run by the host launcher (see
+   kernel.h), which emulates the launch grid, and device memory is
+   ordinary host memory.
+ */
+
+#define __host__
+#define __device__
+#define __global__
+#define __shared__
+#define __constant__
+#define __forceinline__ inline __attribute__((always_inline))
+#define __launch_bounds__(...)
+
+/**
+   The CUDA built-in vector types, with the same size and alignment
+   as their CUDA counterparts so that the field accessors can be used
+   unmodified.
+ */
+#define QUDA_CPU_VECTOR_TYPE2(T, name, align)                                                                          \
+  struct alignas(align) name {                                                                                         \
+    T x, y;                                                                                                            \
+  };                                                                                                                   \
+  inline constexpr name make_##name(T x, T y) { return {x, y}; }
+
+#define QUDA_CPU_VECTOR_TYPE3(T, name)                                                                                 \
+  struct name {                                                                                                        \
+    T x, y, z;                                                                                                         \
+  };                                                                                                                   \
+  inline constexpr name make_##name(T x, T y, T z) { return {x, y, z}; }
+
+#define QUDA_CPU_VECTOR_TYPE4(T, name, align)                                                                          \
+  struct alignas(align) name {                                                                                         \
+    T x, y, z, w;                                                                                                      \
+  };                                                                                                                   \
+  inline constexpr name make_##name(T x, T y, T z, T w) { return {x, y, z, w}; }
+
+QUDA_CPU_VECTOR_TYPE2(char, char2, 2)
+QUDA_CPU_VECTOR_TYPE3(char, char3)
+QUDA_CPU_VECTOR_TYPE4(char, char4, 4)
+QUDA_CPU_VECTOR_TYPE2(short, short2, 4)
+QUDA_CPU_VECTOR_TYPE3(short, short3)
+QUDA_CPU_VECTOR_TYPE4(short, short4, 8)
+QUDA_CPU_VECTOR_TYPE2(int, int2, 8)
+QUDA_CPU_VECTOR_TYPE3(int, int3)
+QUDA_CPU_VECTOR_TYPE4(int, int4, 16)
+QUDA_CPU_VECTOR_TYPE2(unsigned int, uint2, 8)
+QUDA_CPU_VECTOR_TYPE3(unsigned int, uint3)
+QUDA_CPU_VECTOR_TYPE4(unsigned int, uint4, 16)
+QUDA_CPU_VECTOR_TYPE2(float, float2, 8)
+QUDA_CPU_VECTOR_TYPE3(float, float3)
+QUDA_CPU_VECTOR_TYPE4(float, float4, 16)
+QUDA_CPU_VECTOR_TYPE2(double, double2, 16)
+QUDA_CPU_VECTOR_TYPE3(double, double3)
+QUDA_CPU_VECTOR_TYPE4(double, double4, 16)
+
+#undef QUDA_CPU_VECTOR_TYPE2
+#undef QUDA_CPU_VECTOR_TYPE3
+#undef QUDA_CPU_VECTOR_TYPE4
+
+struct dim3 {
+  unsigned int x, y, z;
+  constexpr dim3(unsigned int x = 1, unsigned int y = 1, unsigned int z = 1) : x(x), y(y), z(z) { }
+  constexpr dim3(uint3 v) : x(v.x), y(v.y), z(v.z) { }
+  constexpr operator uint3() const { return {x, y, z}; }
+};
+
+/**
+   The thread, block and grid indices of the emulated launch grid.
+   These forward to the target helpers in target_device.h, which
+   return the coordinates that the host launcher has assigned to the
+   calling host thread.
+ */
+#define threadIdx (::quda::target::thread_idx())
+#define blockIdx (::quda::target::block_idx())
+#define blockDim (::quda::target::block_dim())
+#define gridDim (::quda::target::grid_dim())
+
+/**
+   Every emulated thread block consists of a single thread, so block
+   synchronization is trivially satisfied.
+ */
+inline void __syncthreads() { }
+
+/**
+   @brief Ensure that the writes of the calling thread are visible to
+   every other host thread before any subsequent write
+ */
+inline void __threadfence() { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+
+/**
+   @brief Atomic increment with wrap-around, with the same semantics
+   as the CUDA intrinsic: ((old >= val) ? 0 : (old + 1)) is stored
+   and the old value is returned
+ */
+inline unsigned int atomicInc(unsigned int *address, unsigned int val)
+{
+  unsigned int old = __atomic_load_n(address, __ATOMIC_SEQ_CST);
+  while (!__atomic_compare_exchange_n(address, &old, old >= val ? 0 : old + 1, false, __ATOMIC_SEQ_CST,
+                                      __ATOMIC_SEQ_CST)) { }
+  return old;
+}
+
+inline unsigned int __float_as_uint(float x)
+{
+  unsigned int u;
+  __builtin_memcpy(&u, &x, sizeof(u));
+  return u;
+}
+
+inline float __uint_as_float(unsigned int u)
+{
+  float x;
+  __builtin_memcpy(&x, &u, sizeof(x));
+  return x;
+}
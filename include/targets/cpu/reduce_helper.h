@@ -0,0 +1,12 @@
+#pragma once
+
+#include <quda_internal.h>
+// the CPU target uses the generic reduction, with the inter-block
+// reduction done by the last host thread to complete its block.  The
+// last-block flag is written by thread 0 of the block and read by all
+// of its threads after __syncthreads(), which g++ cannot follow when
+// __shared__ arrays are thread-local.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include "../generic/reduce_helper.h"
+#pragma GCC diagnostic pop
@@ -0,0 +1,125 @@
+#pragma once
+#include <target_device.h>
+#include <reduce_helper.h>
+
+namespace quda
+{
+
+  /**
+     @brief Reduction2D_impl is the implementation of the generic 2-d
+     reduction kernel.  Functors that utilize this kernel have two
+     parallelization dimensions.  The y thread dimenion is constrained
+     to remain inside the thread block and this dimension is
+     contracted in the reduction.  Since the CPU target uses
+     single-thread blocks, the y dimension is contracted within the
+     thread.
+
+     @tparam Transformer Kernel functor that defines the kernel
+     @tparam Arg Kernel argument struct that set any required meta
+     data for the kernel
+     @tparam grid_stride Whether the kernel does multiple computations
+     per thread (in the x dimension)
+     @param[in] arg Kernel argument
+   */
+  template <template <typename> class Transformer, typename Arg, bool grid_stride = true>
+  __forceinline__ void Reduction2D_impl(const Arg &arg)
+  {
+    using reduce_t = typename Transformer<Arg>::reduce_t;
+    using reducer_t = typename Transformer<Arg>::reducer_t;
+    Transformer<Arg> t(arg);
+
+    auto idx = threadIdx.x + blockIdx.x * blockDim.x;
+
+    reduce_t value = reducer_t::init();
+
+    while (idx < arg.threads.x) {
+      for (auto j = threadIdx.y; j < arg.threads.y; j += blockDim.y) value = t(value, idx, j);
+      if (grid_stride)
+        idx += blockDim.x * gridDim.x;
+      else
+        break;
+    }
+
+    // perform final inter-block reduction and write out result
+    reduce(arg, t, value);
+  }
+
+  /**
+     @brief Reduction2D is the entry point of the generic 2-d
+     reduction kernel.  On the CPU target this is a host function that
+     executes a single thread of the launch grid (see kernel.h).
+
+     @tparam Functor Kernel functor that defines the kernel
+     @tparam Arg Kernel argument struct that set any required meta
+     data for the kernel
+     @tparam grid_stride Whether the kernel does multiple computations
+     per thread (in the x dimension)
+     @param[in] arg Host address of the kernel argument
+   */
+  template <template <typename> class Functor, typename Arg, bool grid_stride = true>
+  void Reduction2D(const void *arg)
+  {
+    Reduction2D_impl<Functor, Arg, grid_stride>(*static_cast<const Arg *>(arg));
+  }
+
+  /**
+     @brief MultiReduction_impl is the implementation of the generic
+     multi-reduction kernel.  Functors that utilize this kernel have
+     three parallelization dimensions.  The y thread dimension is
+     constrained to remain inside the thread block and this dimension
+     is contracted in the reduction (within the thread on the CPU
+     target).  The z thread dimension is a batch dimension that is
+     not contracted in the reduction.
+
+     @tparam Functor Kernel functor that defines the kernel
+     @tparam Arg Kernel argument struct that set any required meta
+     data for the kernel
+     @tparam grid_stride Whether the kernel does multiple computations
+     per thread (in the x dimension)
+     @param[in] arg Kernel argument
+   */
+  template <template <typename> class Functor, typename Arg, bool grid_stride = true>
+  __forceinline__ void MultiReduction_impl(const Arg &arg)
+  {
+    using reduce_t = typename Functor<Arg>::reduce_t;
+    using reducer_t = typename Functor<Arg>::reducer_t;
+    Functor<Arg> t(arg);
+
+    auto idx = threadIdx.x + blockIdx.x * blockDim.x;
+    auto j = threadIdx.z + blockIdx.z * blockDim.z;
+
+    if (j >= arg.threads.z) return;
+
+    reduce_t value = reducer_t::init();
+
+    while (idx < arg.threads.x) {
+      for (auto k = threadIdx.y; k < arg.threads.y; k += blockDim.y) value = t(value, idx, k, j);
+      if (grid_stride)
+        idx += blockDim.x * gridDim.x;
+      else
+        break;
+    }
+
+    // perform final inter-block reduction and write out result
+    reduce(arg, t, value, j);
+  }
+
+  /**
+     @brief MultiReduction is the entry point of the generic
+     multi-reduction kernel.  On the CPU target this is a host function
+     that executes a single thread of the launch grid (see kernel.h).
+
+     @tparam Functor Kernel functor that defines the kernel
+     @tparam Arg Kernel argument struct that set any required meta
+     data for the kernel
+     @tparam grid_stride Whether the kernel does multiple computations
+     per thread (in the x dimension)
+     @param[in] arg Host address of the kernel argument
+   */
+  template <template <typename> class Functor, typename Arg, bool grid_stride = true>
+  void MultiReduction(const void *arg)
+  {
+    MultiReduction_impl<Functor, Arg, grid_stride>(*static_cast<const Arg *>(arg));
+  }
+
+} // namespace quda
@@ -0,0 +1,210 @@
+#pragma once
+#include <quda_arch.h>
+#include <quda_api.h>
+#include <algorithm>
+
+namespace quda
+{
+
+  namespace target
+  {
+
+    /**
+       @brief With the CPU target there is no device compilation
+       pass, so we always dispatch the host variant
+    */
+    template <template <bool, typename...> class f, typename... Args> auto dispatch(Args &&...args)
+    {
+      return f<false>()(args...);
+    }
+
+    /**
+       @brief Helper function that returns if the current execution
+       region is on the device
+    */
+    constexpr bool is_device() { return false; }
+
+    /**
+       @brief Helper function that returns if the current execution
+       region is on the host
+    */
+    constexpr bool is_host() { return true; }
+
+    namespace cpu
+    {
+
+      /**
+         The coordinates of the emulated launch grid assigned to the
+         calling host thread.  These are set by the host launcher
+         (see kernel.h) for the duration of a kernel, and otherwise
+         describe a single-thread grid, matching what the host code
+         paths of the other targets observe.
+       */
+      struct grid_state {
+        dim3 block_dim = {1, 1, 1};
+        dim3 grid_dim = {1, 1, 1};
+        dim3 block_idx = {0, 0, 0};
+        dim3 thread_idx = {0, 0, 0};
+      };
+
+      inline thread_local grid_state state;
+
+      /**
+         The size of the emulated shared memory available to each
+         thread block.  Each host thread owns an arena of this size,
+         which backs the dynamic shared memory of the block it is
+         executing.
+       */
+      constexpr unsigned int shared_memory_bytes = 65536;
+
+      /**
+         @brief Return the shared memory arena of the calling host thread
+       */
+      inline char *shared_memory()
+      {
+        alignas(16) static thread_local char arena[shared_memory_bytes];
+        return arena;
+      }
+
+    } // namespace cpu
+
+    /**
+       @brief Helper function that returns the thread block
+       dimensions of the emulated launch grid.
+    */
+    inline dim3 block_dim() { return cpu::state.block_dim; }
+
+    /**
+       @brief Helper function that returns the grid dimensions of the
+       emulated launch grid.
+    */
+    inline dim3 grid_dim() { return cpu::state.grid_dim; }
+
+    /**
+       @brief Helper function that returns the block indices of the
+       calling host thread in the emulated launch grid.
+    */
+    inline dim3 block_idx() { return cpu::state.block_idx; }
+
+    /**
+       @brief Helper function that returns the thread indices within
+       the thread block of the calling host thread in the emulated
+       launch grid.
+    */
+    inline dim3 thread_idx() { return cpu::state.thread_idx; }
+
+    /**
+       @brief Helper function that returns a linear thread index within a thread block.
+    */
+    template <int dim> inline auto thread_idx_linear()
+    {
+      switch (dim) {
+      case 1: return thread_idx().x;
+      case 2: return thread_idx().y * block_dim().x + thread_idx().x;
+      case 3:
+      default: return (thread_idx().z * block_dim().y + thread_idx().y) * block_dim().x + thread_idx().x;
+      }
+    }
+
+    /**
+       @brief Helper function that returns the total number thread in a thread block
+    */
+    template <int dim> inline auto block_size()
+    {
+      switch (dim) {
+      case 1: return block_dim().x;
+      case 2: return block_dim().y * block_dim().x;
+      case 3:
+      default: return block_dim().z * block_dim().y * block_dim().x;
+      }
+    }
+
+  } // namespace target
+
+  namespace device
+  {
+
+    /**
+       @brief Helper function that returns the warp-size of the
+       architecture we are running on.  Each host thread is its own
+       warp.
+    */
+    constexpr int warp_size() { return 1; }
+
+    /**
+       @brief Return the thread mask for a converged warp.
+    */
+    constexpr unsigned int warp_converged_mask() { return 0x1; }
+
+    /**
+       @brief Helper function that returns the maximum number of threads
+       in a block in the x dimension.  Thread blocks are emulated with
+       a single host thread.
+    */
+    template <int block_size_y = 1, int block_size_z = 1> constexpr unsigned int max_block_size() { return 1; }
+
+    /**
+       @brief Helper function that returns the maximum size of a
+       __constant__ buffer on the target architecture.  There is no
+       constant memory on the host, and parameter structs are always
+       passed by reference, so this is just a nominal limit.
+    */
+    constexpr size_t max_constant_size() { return 32768; }
+
+    /**
+       @brief Helper function that returns the maximum static size of
+       the kernel arguments passed to a kernel on the target
+       architecture.  The host launcher passes the parameter struct
+       by reference, so this is not a hard limit, but it is used to
+       size the statically allocated parameter structs (e.g., of the
+       multi-blas kernels), so we use the size of constant memory.
+    */
+    constexpr size_t max_kernel_arg_size() { return max_constant_size(); }
+
+    /**
+       @brief Helper function that returns true if we are to pass the
+       kernel parameter struct to the kernel as an explicit kernel
+       argument.  This is always the case for the host launcher.
+    */
+    template <typename Arg> constexpr bool use_kernel_arg() { return true; }
+
+    /**
+       @brief Helper function that returns kernel argument from
+       __constant__ memory.  Note this is the dummy implementation,
+       and is present only to keep the compiler happy.
+     */
+    template <typename Arg> constexpr std::enable_if_t<use_kernel_arg<Arg>(), const Arg &> get_arg()
+    {
+      return reinterpret_cast<Arg &>(nullptr);
+    }
+
+    /**
+       @brief Helper function that returns a pointer to the
+       __constant__ memory buffer.  Note this is the dummy
+       implementation, and is present only to keep the compiler happy.
+     */
+    template <typename Arg> constexpr std::enable_if_t<use_kernel_arg<Arg>(), void *> get_constant_buffer()
+    {
+      return nullptr;
+    }
+
+    /**
+       @brief Return the default launch bounds for the kernels.  These
+       have no meaning on the host, and are present for interface
+       compatibility with the other targets.
+    */
+    template <typename Tag> constexpr int get_default_kernel1D_launch_bounds() { return 1; }
+    template <typename Tag> constexpr int get_default_kernel2D_launch_bounds() { return 1; }
+    template <typename Tag> constexpr int get_default_kernel3D_launch_bounds() { return 1; }
+    template <typename Tag> constexpr int get_default_reduction_launch_bounds() { return 1; }
+    template <typename Tag> constexpr int get_default_multireduction_launch_bounds() { return 1; }
+
+    /**
+     @brief Return the maximum number of threads per block for block
+     ortho routines.
+    */
+    template <typename Tag> constexpr int get_max_ortho_block_size() { return 1; }
+
+  } // namespace device
+
+} // namespace quda
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <array.h>
+
+namespace quda
+{
+
+  /**
+     @brief Class that provides indexable per-thread storage.  On the
+     CPU target every thread has its own stack, so this is simply an
+     array.
+   */
+  template <typename T, int n> struct thread_array : array<T, n> {
+  };
+
+} // namespace quda
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <tune_quda.h>
+#include <target_device.h>
+#include <lattice_field.h>
+#include <kernel_helper.h>
+#include <kernel.h>
+
+namespace quda
+{
+
+  /**
+     @brief Launch a kernel with the CPU target host launcher.  Each
+     block of the grid is executed by a host thread, which runs the
+     kernel entry point for each thread of the block.
+     @param[in] func Kernel entry point
+     @param[in] tp TuneParam containing the launch parameters
+     @param[in] arg Host address of argument struct
+     @param[in] stream Stream identifier
+  */
+  qudaError_t qudaLaunchKernel(const void *func, const TuneParam &tp, const qudaStream_t &stream, const void *arg);
+
+  /**
+     @brief This helper function indicates if the present
+     compilation unit has explicit constant memory usage enabled.
+  */
+  [[maybe_unused]] static bool use_constant_memory()
+  {
+#ifdef QUDA_USE_CONSTANT_MEMORY
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  class TunableKernel : public Tunable
+  {
+
+  protected:
+    QudaFieldLocation location;
+
+    template <template <typename> class Functor, bool grid_stride, typename Arg>
+    qudaError_t launch_device(const kernel_t &kernel, const TuneParam &tp, const qudaStream_t &stream, const Arg &arg)
+    {
+      const bool timed = startLaunchStats(stream);
+      launch_error = qudaLaunchKernel(kernel.func, tp, stream, static_cast<const void *>(&arg));
+      if (timed) stopLaunchStats(stream);
+      return launch_error;
+    }
+
+  public:
+    /**
+       @brief Special kernel launcher used for raw CUDA kernels with no
+       assumption made about shape of parallelism.  Kernels launched
+       using this must take responsibility of bounds checking and
+       assignment of threads.
+     */
+    template <template <typename> class Functor, typename Arg>
+    void launch_cuda(const TuneParam &tp, const qudaStream_t &stream, const Arg &arg) const
+    {
+      constexpr bool grid_stride = false;
+      const_cast<TunableKernel *>(this)->launch_device<Functor, grid_stride>(KERNEL(raw_kernel), tp, stream, arg);
+    }
+
+    /**
+       Since the "device" is the host on this target, the tuned
+       parameters of both locations depend on the number of host
+       threads, which is therefore always included in the key.
+     */
+    TunableKernel(const LatticeField &field, QudaFieldLocation location = QUDA_INVALID_FIELD_LOCATION) :
+      location(location != QUDA_INVALID_FIELD_LOCATION ? location : field.Location())
+    {
+      strcpy(vol, field.VolString().c_str());
+      strcpy(aux, compile_type_str(field, location));
+      strcat(aux, getOmpThreadStr());
+      strcat(aux, field.AuxString().c_str());
+    }
+
+    TunableKernel(size_t n_items, QudaFieldLocation location = QUDA_INVALID_FIELD_LOCATION) : location(location)
+    {
+      u64toa(vol, n_items);
+      strcpy(aux, compile_type_str(location));
+      strcat(aux, getOmpThreadStr());
+    }
+
+    virtual bool advanceTuneParam(TuneParam &param) const override
+    {
+      return location == QUDA_CPU_FIELD_LOCATION ? false : Tunable::advanceTuneParam(param);
+    }
+
+    bool hostLaunch() const override { return location == QUDA_CPU_FIELD_LOCATION; }
+
+    TuneKey tuneKey() const override { return TuneKey(vol, typeid(*this).name(), aux); }
+  };
+
+} // namespace quda
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <target_device.h>
+
+namespace quda
+{
+
+  /**
+     @brief Combine the partial results held by the threads of a
+     split warp.  The CPU target has single-thread warps, so the warp
+     is never split and this is the identity.
+   */
+  template <int warp_split, typename T> inline T warp_combine(T &x) { return x; }
+
+} // namespace quda
@@ -73,7 +73,7 @@ namespace quda
   template <bool is_device> struct atomic_fetch_abs_max_impl {
     template <typename T> inline void operator()(T *addr, T val)
     {
-#pragma omp atomic update
+#pragma omp critical(atomic_fetch_abs_max)
       *addr = std::max(*addr, val);
     }
   };
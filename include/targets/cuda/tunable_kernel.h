@@ -45,11 +45,13 @@ namespace quda
     std::enable_if_t<device::use_kernel_arg<Arg>(), qudaError_t>
     launch_device(const kernel_t &kernel, const TuneParam &tp, const qudaStream_t &stream, const Arg &arg)
     {
+      const bool timed = startLaunchStats(stream);
 #ifdef JITIFY
       launch_error = launch_jitify<Functor, grid_stride, Arg>(kernel.name, tp, stream, arg);
 #else
       launch_error = qudaLaunchKernel(kernel.func, tp, stream, static_cast<const void *>(&arg));
 #endif
+      if (timed) stopLaunchStats(stream);
       return launch_error;
     }
 
@@ -64,12 +66,15 @@ namespace quda
     {
 #ifdef JITIFY
       // note we do the copy to constant memory after the kernel has been compiled in launch_jitify
+      const bool timed = startLaunchStats(stream);
       launch_error = launch_jitify<Functor, grid_stride, Arg>(kernel.name, tp, stream, arg);
 #else
       check_arg_size(arg);
       qudaMemcpyAsync(device::get_constant_buffer<Arg>(), &arg, sizeof(Arg), qudaMemcpyHostToDevice, stream);
+      const bool timed = startLaunchStats(stream);
       launch_error = qudaLaunchKernel(kernel.func, tp, stream, static_cast<const void *>(&arg));
 #endif
+      if (timed) stopLaunchStats(stream);
       return launch_error;
     }
 
@@ -110,6 +115,8 @@ namespace quda
       return location == QUDA_CPU_FIELD_LOCATION ? false : Tunable::advanceTuneParam(param);
     }
 
+    bool hostLaunch() const override { return location == QUDA_CPU_FIELD_LOCATION; }
+
     TuneKey tuneKey() const override { return TuneKey(vol, typeid(*this).name(), aux); }
   };
 
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <complex_quda.h>
+#include <array.h>
+#include <host_thread_helper.h>
+
+/**
+   @file blas_host_simd.h
+
+   @section Vectorized host implementations of the most common BLAS
+   kernels.  These are used in place of the generic functor path by
+   the blas and reduce tunables when operating on host fields that are
+   stored in single or double precision in space-spin-color order,
+   where each parity of the field is a contiguous array of real
+   numbers.  The kernels are compiled for each supported instruction
+   set (AVX-512, AVX2+FMA and a scalar fallback) and the best one
+   supported by the CPU is selected at run time.  All arithmetic is
+   carried out in double precision.  The arrays are split into
+   fixed-size chunks that are distributed among the host threads, with
+   reductions combining the per-chunk partial sums with a fixed-shape
+   tree, so results do not depend on the number of threads.
+ */
+
+namespace quda
+{
+
+  namespace blas
+  {
+
+    namespace simd
+    {
+
+      /**
+         Instruction sets for which the vectorized host kernels are compiled
+       */
+      enum class isa_t { scalar, avx2, avx512 };
+
+      /**
+         @brief Return whether the vectorized host kernels are
+         enabled.  This is the default, and can be disabled by setting
+         the environment variable QUDA_HOST_SIMD=off, in which case the
+         generic functor path is used.
+         @return Whether the vectorized host kernels are enabled
+       */
+      bool enabled();
+
+      /**
+         @brief Return the instruction set used by the vectorized host
+         kernels.  This defaults to the widest instruction set that is
+         both compiled in and supported by the CPU, and can be
+         overridden with the environment variable QUDA_HOST_SIMD
+         (scalar, avx2 or avx512).
+         @return The instruction set in use
+       */
+      isa_t isa();
+
+      /**
+         @brief Perform z = a * x + b * y
+         @param[in] a Scalar coefficient of x
+         @param[in] x Input array
+         @param[in] b Scalar coefficient of y
+         @param[in] y Input array
+         @param[out] z Output array (may alias x or y)
+         @param[in] n Length of the arrays in real numbers (must be even)
+         @param[in] param Host launch parameters
+       */
+      template <typename real>
+      void axpbyz(real a, const real *x, real b, const real *y, real *z, size_t n, const host::launch_param &param);
+
+      /**
+         @brief Perform y += a * x where x and y are interleaved complex arrays
+         @param[in] a Complex coefficient of x
+         @param[in] x Input array
+         @param[in,out] y Input/output array
+         @param[in] n Length of the arrays in real numbers (must be even)
+         @param[in] param Host launch parameters
+       */
+      template <typename real>
+      void caxpy(const complex<real> &a, const real *x, real *y, size_t n, const host::launch_param &param);
+
+      /**
+         @brief Perform y += a * x and then x = z + b * x
+         @param[in] a Scalar coefficient of x in the update of y
+         @param[in,out] x Input/output array
+         @param[in,out] y Input/output array
+         @param[in] z Input array
+         @param[in] b Scalar coefficient of x in the update of x
+         @param[in] n Length of the arrays in real numbers (must be even)
+         @param[in] param Host launch parameters
+       */
+      template <typename real>
+      void axpyZpbx(real a, real *x, real *y, const real *z, real b, size_t n, const host::launch_param &param);
+
+      /**
+         @brief Compute the squared norm of x
+         @param[in] x Input array
+         @param[in] n Length of the array in real numbers (must be even)
+         @param[in] param Host launch parameters
+         @return The squared norm of x
+       */
+      template <typename real> double norm2(const real *x, size_t n, const host::launch_param &param);
+
+      /**
+         @brief Compute the complex dot product (x, y) = sum conj(x) * y
+         where x and y are interleaved complex arrays
+         @param[in] x Input array
+         @param[in] y Input array
+         @param[in] n Length of the arrays in real numbers (must be even)
+         @param[in] param Host launch parameters
+         @return The real and imaginary parts of the dot product
+       */
+      template <typename real>
+      array<double, 2> cDotProduct(const real *x, const real *y, size_t n, const host::launch_param &param);
+
+      /**
+         @brief Perform z = a * x + b * y and compute the squared norm of z
+         @param[in] a Scalar coefficient of x
+         @param[in] x Input array
+         @param[in] b Scalar coefficient of y
+         @param[in] y Input array
+         @param[out] z Output array (may alias x or y)
+         @param[in] n Length of the arrays in real numbers (must be even)
+         @param[in] param Host launch parameters
+         @return The squared norm of z
+       */
+      template <typename real>
+      double axpbyzNorm(real a, const real *x, real b, const real *y, real *z, size_t n, const host::launch_param &param);
+
+    } // namespace simd
+
+  } // namespace blas
+
+} // namespace quda
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <host_thread_helper.h>
+
+/**
+   @file dslash_host.h
+
+   @section Host engine for the dslash stencils.  Rather than visiting
+   the checkerboard sites in a single lexicographic sweep, the
+   lattice is split into spatial tiles made up of complete x rows,
+   which are extended in y, then z, then t until they reach the
+   requested number of sites.  Each tile is swept row by row so that
+   the gauge and spinor accesses are unit-stride runs that the
+   hardware prefetcher can follow, while the neighbouring rows in y
+   and z that the stencil reads are still cache resident from the
+   previous rows of the same tile.  The tiles (together with the
+   parity and fifth-dimension indices) are distributed among the host
+   threads.
+ */
+
+namespace quda
+{
+
+  namespace host
+  {
+
+    /**
+       The default number of checkerboard sites per tile, used when
+       the chunk extent is left automatic
+     */
+    constexpr unsigned int dslash_tile_sites = 4096;
+
+    /**
+       Extents of a dslash tile in the y, z and t dimensions.  A tile
+       always spans complete rows in x.
+     */
+    struct dslash_tile {
+      int y;
+      int z;
+      int t;
+
+      /**
+         @brief Construct the tile that holds at least the requested
+         number of sites, growing from a single row in y, then z and
+         then t
+         @param[in] X0h The length of a checkerboard row in x
+         @param[in] X The local lattice dimensions (only y, z and t are used)
+         @param[in] sites The requested number of sites per tile (0 for the default)
+       */
+      template <typename I> dslash_tile(int X0h, const I &X, unsigned int sites)
+      {
+        const int64_t n = sites > 0 ? sites : dslash_tile_sites;
+        const int X1 = X[1], X2 = X[2], X3 = X[3];
+        int64_t plane = X0h;
+        y = static_cast<int>(std::min<int64_t>(X1, std::max<int64_t>(1, n / plane)));
+        plane *= y;
+        z = y < X1 ? 1 : static_cast<int>(std::min<int64_t>(X2, std::max<int64_t>(1, n / plane)));
+        plane *= z;
+        t = z < X2 ? 1 : static_cast<int>(std::min<int64_t>(X3, std::max<int64_t>(1, n / plane)));
+      }
+    };
+
+  } // namespace host
+
+  /**
+     @brief Apply the interior dslash stencil on the host.  Only
+     single-process (or non-partitioned) 4-d checkerboarded
+     operators are supported, since there is no halo exchange on the
+     host.
+     @tparam D The dslash operator class
+     @tparam nParity The number of parities being applied
+     @tparam dagger Whether this is the dagger operator
+     @tparam xpay Whether we are doing xpay or not
+     @param[in] arg The dslash argument struct
+     @param[in] param The host launch parameters, where chunk.x sets
+     the number of sites per tile
+   */
+  template <template <int, bool, bool, KernelType, typename> class D, int nParity, bool dagger, bool xpay, typename Arg>
+  void dslash_host(const Arg &arg, const host::launch_param &param)
+  {
+    using Dslash = D<nParity, dagger, xpay, INTERIOR_KERNEL, Arg>;
+    if (Dslash(arg).pc_type() != QUDA_4D_PC) errorQuda("Host dslash only supports 4-d preconditioned operators");
+
+    const int X0h = arg.X0h;
+    const int X1 = arg.dim[1], X2 = arg.dim[2], X3 = arg.dim[3];
+    const int Ls = arg.dc.Ls;
+    const host::dslash_tile tile(X0h, arg.dim, param.chunk.x);
+
+    const int n_tile_y = (X1 + tile.y - 1) / tile.y;
+    const int n_tile_z = (X2 + tile.z - 1) / tile.z;
+    const int n_tile_t = (X3 + tile.t - 1) / tile.t;
+    const int64_t n_tile = static_cast<int64_t>(n_tile_y) * n_tile_z * n_tile_t;
+    const int64_t n_item = n_tile * Ls * nParity;
+
+    auto compute_tile = [&](Dslash &dslash, int64_t item) {
+      const int64_t tile_idx = item % n_tile;
+      const int s = (item / n_tile) % Ls;
+      const int parity = nParity == 2 ? static_cast<int>(item / (n_tile * Ls)) : arg.parity;
+
+      const int y0 = (tile_idx % n_tile_y) * tile.y;
+      const int z0 = ((tile_idx / n_tile_y) % n_tile_z) * tile.z;
+      const int t0 = (tile_idx / (static_cast<int64_t>(n_tile_y) * n_tile_z)) * tile.t;
+
+      for (int t = t0; t < std::min(t0 + tile.t, X3); t++) {
+        for (int z = z0; z < std::min(z0 + tile.z, X2); z++) {
+          for (int y = y0; y < std::min(y0 + tile.y, X1); y++) {
+            const int row = ((t * X2 + z) * X1 + y) * X0h;
+            for (int x = 0; x < X0h; x++) dslash.template operator()<INTERIOR_KERNEL>(row + x, s, parity);
+          }
+        }
+      }
+    };
+
+#ifdef _OPENMP
+    const int n_threads = static_cast<int>(std::max(std::min(static_cast<int64_t>(param.threads), n_item), int64_t(1)));
+#pragma omp parallel num_threads(n_threads) if (n_threads > 1)
+    {
+      Dslash dslash(arg);
+      if (param.dynamic) {
+#pragma omp for schedule(dynamic, 1)
+        for (int64_t i = 0; i < n_item; i++) compute_tile(dslash, i);
+      } else {
+#pragma omp for schedule(static)
+        for (int64_t i = 0; i < n_item; i++) compute_tile(dslash, i);
+      }
+    }
+#else
+    Dslash dslash(arg);
+    for (int64_t i = 0; i < n_item; i++) compute_tile(dslash, i);
+#endif
+  }
+
+} // namespace quda
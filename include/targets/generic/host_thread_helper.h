@@ -0,0 +1,202 @@
+#pragma once
+
+#include <cstdint>
+#include <algorithm>
+#include <quda_arch.h>
+#include <tune_quda.h>
+
+/**
+   @file host_thread_helper.h
+
+   @section Run-time configuration and work partitioning for the
+   multi-threaded host execution engine that sits behind the generic
+   host kernel launchers (Kernel1D_host, Kernel2D_host, etc.).
+ */
+
+namespace quda
+{
+
+  namespace host
+  {
+
+    /**
+       @brief Return the number of threads used for host kernels.  This
+       defaults to omp_get_max_threads() (or one if OpenMP is not
+       enabled) and can be overridden with the QUDA_HOST_THREADS
+       environment variable or with set_max_threads.
+       @return The number of host threads
+     */
+    int max_threads();
+
+    /**
+       @brief Set the number of threads used for host kernels.  A
+       value less than one restores the default.
+       @param[in] n_threads The number of host threads
+     */
+    void set_max_threads(int n_threads);
+
+    /**
+       @brief Return the requested chunk shape used to partition the
+       x/y/z index space of host kernels.  A zero extent in any
+       dimension means that dimension is chosen automatically: the x
+       dimension is split to give each thread a few chunks to balance
+       the load, while the y and z dimensions are not split.  The
+       default is (0,0,0) and can be overridden with the
+       QUDA_HOST_CHUNK environment variable, e.g.,
+       QUDA_HOST_CHUNK=1024,1,1, or with set_chunk.
+       @return The requested chunk shape
+     */
+    dim3 chunk();
+
+    /**
+       @brief Set the chunk shape used to partition host kernels
+       @param[in] chunk The requested chunk shape (zero extents are automatic)
+     */
+    void set_chunk(const dim3 &chunk);
+
+    /**
+       @brief Launch parameters of the host execution engine.  These
+       are autotuned along with device kernels: see
+       get_launch_param and set_launch_param for how they are stored
+       in a TuneParam.
+     */
+    struct launch_param {
+      int threads;  /** Number of threads to use */
+      bool dynamic; /** Whether chunks are scheduled dynamically (else statically) */
+      dim3 chunk;   /** Requested chunk shape (zero extents are automatic) */
+
+      /**
+         @brief The default launch parameters, which are used when
+         tuning is disabled: all threads, dynamic scheduling and the
+         chunk shape returned by host::chunk()
+       */
+      launch_param() : threads(max_threads()), dynamic(true), chunk(host::chunk()) { }
+    };
+
+    /**
+       @brief Store host launch parameters in a TuneParam.  The chunk
+       shape is stored in block, while grid holds the thread count and
+       schedule.  Since a device grid is never zero in any dimension,
+       grid.z = 0 marks the TuneParam as holding host launch
+       parameters.  The shared_bytes and aux fields are left to the
+       tunable.
+       @param[out] tp The TuneParam we are writing to
+       @param[in] param The host launch parameters
+     */
+    inline void set_launch_param(TuneParam &tp, const launch_param &param)
+    {
+      tp.block = param.chunk;
+      tp.grid = dim3(param.threads, param.dynamic ? 1 : 0, 0);
+    }
+
+    /**
+       @brief Extract the host launch parameters from a TuneParam.  If
+       the TuneParam does not hold host launch parameters (e.g., it was
+       tuned prior to host autotuning) the defaults are returned.
+       @param[in] tp The TuneParam we are reading
+       @return The host launch parameters
+     */
+    inline launch_param get_launch_param(const TuneParam &tp)
+    {
+      launch_param param;
+      if (tp.grid.z != 0) return param;
+      param.threads = std::max(std::min(static_cast<int>(tp.grid.x), max_threads()), 1);
+      param.dynamic = tp.grid.y != 0;
+      param.chunk = tp.block;
+      return param;
+    }
+
+    /**
+       @brief Set the host launch parameters to the start of the
+       autotuning search space
+       @param[out] tp The TuneParam we are initializing
+       @param[in] chunk_dim The number of dimensions over which the
+       chunk shape is tuned (zero if it is not tuned)
+     */
+    void init_tune_param(TuneParam &tp, int chunk_dim);
+
+    /**
+       @brief Advance the host launch parameters to the next point in
+       the autotuning search space.  The thread count is swept over
+       powers of two up to max_threads(), followed by the schedule,
+       followed by the chunk shape in each of the tuned dimensions.
+       @param[in,out] tp The TuneParam we are advancing
+       @param[in] chunk_dim The number of dimensions over which the
+       chunk shape is tuned (zero if it is not tuned)
+       @return Whether there is a further point in the search space
+     */
+    bool advance_tune_param(TuneParam &tp, int chunk_dim);
+
+    /**
+       @brief Helper that partitions a three-dimensional index space
+       [0,extent.x) x [0,extent.y) x [0,extent.z) into rectangular
+       chunks that are handed out to the host threads.  Chunks are
+       enumerated with x running fastest.
+     */
+    struct chunk_partition {
+      /** Minimum automatically chosen chunk size in the x dimension */
+      static constexpr unsigned int min_chunk_x = 32;
+      /** Number of chunks per thread targeted by the automatic chunk size */
+      static constexpr unsigned int chunks_per_thread = 4;
+
+      dim3 extent; /** Extent of the index space */
+      dim3 shape;  /** Shape of each chunk */
+      dim3 n;      /** Number of chunks in each dimension */
+      int n_threads; /** Number of threads that will partake */
+
+      /**
+         @brief Constructor for the partitioning
+         @param[in] extent The extent of the index space
+         @param[in] requested The requested chunk shape (zero extents are automatic)
+         @param[in] max_threads The maximum number of threads to use
+       */
+      chunk_partition(const dim3 &extent, const dim3 &requested = host::chunk(), int max_threads = host::max_threads()) :
+        extent(extent)
+      {
+        shape.y = requested.y > 0 ? std::min(requested.y, std::max(extent.y, 1u)) : std::max(extent.y, 1u);
+        shape.z = requested.z > 0 ? std::min(requested.z, std::max(extent.z, 1u)) : std::max(extent.z, 1u);
+        n.y = (extent.y + shape.y - 1) / shape.y;
+        n.z = (extent.z + shape.z - 1) / shape.z;
+
+        if (requested.x > 0) {
+          shape.x = requested.x;
+        } else {
+          // aim for a few chunks per thread across the full index space
+          const uint64_t n_yz = std::max(static_cast<uint64_t>(n.y) * n.z, uint64_t(1));
+          const uint64_t target = static_cast<uint64_t>(std::max(max_threads, 1)) * chunks_per_thread;
+          const uint64_t n_x = std::max((target + n_yz - 1) / n_yz, uint64_t(1));
+          shape.x = std::max(static_cast<unsigned int>((extent.x + n_x - 1) / n_x), min_chunk_x);
+        }
+        shape.x = std::max(shape.x, 1u);
+        n.x = (extent.x + shape.x - 1) / shape.x;
+
+        n_threads = static_cast<int>(std::min(static_cast<uint64_t>(std::max(max_threads, 1)), size()));
+        n_threads = std::max(n_threads, 1);
+      }
+
+      /**
+         @return The total number of chunks
+       */
+      uint64_t size() const { return static_cast<uint64_t>(n.x) * n.y * n.z; }
+
+      /**
+         @brief Return the lower (inclusive) and upper (exclusive)
+         bounds of a given chunk
+         @param[in] c Chunk index
+         @param[out] lo Lower bound
+         @param[out] hi Upper bound
+       */
+      void bounds(uint64_t c, dim3 &lo, dim3 &hi) const
+      {
+        const unsigned int cx = c % n.x;
+        const unsigned int cy = (c / n.x) % n.y;
+        const unsigned int cz = c / (static_cast<uint64_t>(n.x) * n.y);
+        lo = dim3(cx * shape.x, cy * shape.y, cz * shape.z);
+        hi = dim3(std::min(lo.x + shape.x, extent.x), std::min(lo.y + shape.y, extent.y),
+                  std::min(lo.z + shape.z, extent.z));
+      }
+    };
+
+  } // namespace host
+
+} // namespace quda
@@ -1,30 +1,77 @@
 #pragma once
 
+#include <host_thread_helper.h>
+
 namespace quda
 {
 
-  template <template <typename> class Functor, typename Arg> void Kernel1D_host(const Arg &arg)
+  /**
+     @brief Multi-threaded host execution engine that partners the
+     host kernel launchers.  The x/y/z index space is split into
+     chunks (see host::chunk_partition) which are distributed among
+     the host threads.  Each thread constructs its own instance of the
+     functor, mirroring what each device thread does.
+     @tparam Functor The functor that defines the operation
+     @param[in] arg Kernel argument struct
+     @param[in] extent The extent of the index space
+     @param[in] param The host launch parameters
+     @param[in] body Callable invoked as body(f, i, j, k) for every
+     point in the index space, where f is the thread-local functor
+   */
+  template <template <typename> class Functor, typename Arg, typename Body>
+  void host_parallel_for(const Arg &arg, const dim3 &extent, const host::launch_param &param, Body body)
   {
-    Functor<Arg> f(const_cast<Arg &>(arg));
-    for (int i = 0; i < static_cast<int>(arg.threads.x); i++) { f(i); }
+    const host::chunk_partition partition(extent, param.chunk, param.threads);
+    const int64_t n_chunk = partition.size();
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(partition.n_threads) if (partition.n_threads > 1)
+#endif
+    {
+      Functor<Arg> f(const_cast<Arg &>(arg));
+      auto compute_chunk = [&](int64_t c) {
+        dim3 lo, hi;
+        partition.bounds(c, lo, hi);
+        for (unsigned int i = lo.x; i < hi.x; i++) {
+          for (unsigned int j = lo.y; j < hi.y; j++) {
+            for (unsigned int k = lo.z; k < hi.z; k++) { body(f, i, j, k); }
+          }
+        }
+      };
+
+#ifdef _OPENMP
+      if (param.dynamic) {
+#pragma omp for schedule(dynamic, 1)
+        for (int64_t c = 0; c < n_chunk; c++) compute_chunk(c);
+      } else {
+#pragma omp for schedule(static)
+        for (int64_t c = 0; c < n_chunk; c++) compute_chunk(c);
+      }
+#else
+      for (int64_t c = 0; c < n_chunk; c++) compute_chunk(c);
+#endif
+    }
   }
 
-  template <template <typename> class Functor, typename Arg> void Kernel2D_host(const Arg &arg)
+  template <template <typename> class Functor, typename Arg>
+  void Kernel1D_host(const Arg &arg, const host::launch_param &param = host::launch_param())
   {
-    Functor<Arg> f(const_cast<Arg &>(arg));
-    for (int i = 0; i < static_cast<int>(arg.threads.x); i++) {
-      for (int j = 0; j < static_cast<int>(arg.threads.y); j++) { f(i, j); }
-    }
+    host_parallel_for<Functor>(arg, dim3(arg.threads.x, 1, 1), param,
+                               [](Functor<Arg> &f, int i, int, int) { f(i); });
   }
 
-  template <template <typename> class Functor, typename Arg> void Kernel3D_host(const Arg &arg)
+  template <template <typename> class Functor, typename Arg>
+  void Kernel2D_host(const Arg &arg, const host::launch_param &param = host::launch_param())
   {
-    Functor<Arg> f(const_cast<Arg &>(arg));
-    for (int i = 0; i < static_cast<int>(arg.threads.x); i++) {
-      for (int j = 0; j < static_cast<int>(arg.threads.y); j++) {
-        for (int k = 0; k < static_cast<int>(arg.threads.z); k++) { f(i, j, k); }
-      }
-    }
+    host_parallel_for<Functor>(arg, dim3(arg.threads.x, arg.threads.y, 1), param,
+                               [](Functor<Arg> &f, int i, int j, int) { f(i, j); });
+  }
+
+  template <template <typename> class Functor, typename Arg>
+  void Kernel3D_host(const Arg &arg, const host::launch_param &param = host::launch_param())
+  {
+    host_parallel_for<Functor>(arg, dim3(arg.threads.x, arg.threads.y, arg.threads.z), param,
+                               [](Functor<Arg> &f, int i, int j, int k) { f(i, j, k); });
   }
 
 } // namespace quda
@@ -1,39 +1,127 @@
 #pragma once
 
 #include <vector>
+#include <host_thread_helper.h>
 
 namespace quda
 {
 
-  template <template <typename> class Functor, typename Arg> auto Reduction2D_host(const Arg &arg)
+  namespace host
   {
-    using reduce_t = typename Functor<Arg>::reduce_t;
-    Functor<Arg> t(arg);
 
-    reduce_t value = t.init();
+    /**
+       The number of x indices that are reduced serially into each
+       partial sum.  This is deliberately independent of the number
+       of host threads, since this ensures the shape of the reduction,
+       and hence the result, is bitwise reproducible regardless of the
+       thread count.
+     */
+    constexpr unsigned int reduction_chunk = 1024;
 
-    for (int j = 0; j < static_cast<int>(arg.threads.y); j++) {
-      for (int i = 0; i < static_cast<int>(arg.threads.x); i++) { value = t(value, i, j); }
+    /**
+       @brief Reduce an array of partial sums using a fixed-shape
+       pairwise tree.  The input array is overwritten.
+       @param[in] r The reducer used to combine partial sums
+       @param[in,out] v The array of partial sums
+       @param[in] n The number of partial sums
+       @return The reduced value
+     */
+    template <typename Reducer, typename T> T tree_reduce(const Reducer &r, T *v, uint64_t n)
+    {
+      if (n == 0) return r.init();
+      for (uint64_t stride = 1; stride < n; stride *= 2) {
+        for (uint64_t i = 0; i + stride < n; i += 2 * stride) v[i] = r(v[i], v[i + stride]);
+      }
+      return v[0];
     }
 
-    return value;
-  }
+  } // namespace host
 
-  template <template <typename> class Functor, typename Arg> auto MultiReduction_host(const Arg &arg)
+  /**
+     @brief Parallel deterministic host reduction engine that partners
+     the host reduction launchers.  The x dimension is split into
+     fixed-size chunks, and every (x-chunk, y, z) triplet computes an
+     independent partial sum.  These are distributed among the host
+     threads, with each thread using a private copy of the argument
+     struct (reducers may carry per-thread scratch state), after which
+     the partials for each z index are combined with a fixed-shape
+     tree.  The y dimension is contracted, the z dimension is a batch
+     dimension.
+     @tparam Functor The functor that defines the reduction
+     @param[in] arg Kernel argument struct
+     @param[in] extent The extent of the index space
+     @param[in] param The host launch parameters (the chunk shape is
+     ignored since the partial sums have a fixed shape)
+     @param[in] body Callable invoked as body(t, value, i, j, k), returning the updated partial sum
+     @return Vector of length extent.z holding the reduced values
+   */
+  template <template <typename> class Functor, typename Arg, typename Body>
+  auto host_parallel_reduce(const Arg &arg, const dim3 &extent, const host::launch_param &param, Body body)
   {
     using reduce_t = typename Functor<Arg>::reduce_t;
-    Functor<Arg> t(arg);
 
-    std::vector<reduce_t> value(arg.threads.z);
-    for (int k = 0; k < static_cast<int>(arg.threads.z); k++) {
-      value[k] = t.init();
+    const uint64_t n_chunk_x = (extent.x + host::reduction_chunk - 1) / host::reduction_chunk;
+    const uint64_t n_partial = n_chunk_x * extent.y; // partials per batch index
+    const int64_t n_chunk = n_partial * extent.z;
+    std::vector<reduce_t> partial(n_chunk);
+
+    const int n_threads = static_cast<int>(std::max(std::min(static_cast<int64_t>(param.threads), n_chunk), int64_t(1)));
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(n_threads) if (n_threads > 1)
+#endif
+    {
+      Arg arg_local(arg);
+      Functor<Arg> t(arg_local);
+      auto compute_partial = [&](int64_t c) {
+        const unsigned int cx = c % n_chunk_x;
+        const unsigned int j = (c / n_chunk_x) % extent.y;
+        const unsigned int k = c / n_partial;
+        const unsigned int begin = cx * host::reduction_chunk;
+        const unsigned int end = std::min(begin + host::reduction_chunk, extent.x);
 
-      for (int j = 0; j < static_cast<int>(arg.threads.y); j++) {
-        for (int i = 0; i < static_cast<int>(arg.threads.x); i++) { value[j] = t(value[j], i, j, k); }
+        reduce_t value = t.init();
+        for (unsigned int i = begin; i < end; i++) value = body(t, value, i, j, k);
+        partial[c] = value;
+      };
+
+#ifdef _OPENMP
+      if (param.dynamic) {
+#pragma omp for schedule(dynamic, 1)
+        for (int64_t c = 0; c < n_chunk; c++) compute_partial(c);
+      } else {
+#pragma omp for schedule(static)
+        for (int64_t c = 0; c < n_chunk; c++) compute_partial(c);
       }
+#else
+      for (int64_t c = 0; c < n_chunk; c++) compute_partial(c);
+#endif
     }
 
+    Functor<Arg> t(arg);
+    std::vector<reduce_t> value(extent.z);
+    for (unsigned int k = 0; k < extent.z; k++) value[k] = host::tree_reduce(t, partial.data() + k * n_partial, n_partial);
+
     return value;
   }
 
+  template <template <typename> class Functor, typename Arg>
+  auto Reduction2D_host(const Arg &arg, const host::launch_param &param = host::launch_param())
+  {
+    using reduce_t = typename Functor<Arg>::reduce_t;
+    auto value = host_parallel_reduce<Functor>(
+      arg, dim3(arg.threads.x, arg.threads.y, 1), param,
+      [](Functor<Arg> &t, reduce_t &value, int i, int j, int) { return t(value, i, j); });
+    return value[0];
+  }
+
+  template <template <typename> class Functor, typename Arg>
+  auto MultiReduction_host(const Arg &arg, const host::launch_param &param = host::launch_param())
+  {
+    using reduce_t = typename Functor<Arg>::reduce_t;
+    return host_parallel_reduce<Functor>(
+      arg, dim3(arg.threads.x, arg.threads.y, arg.threads.z), param,
+      [](Functor<Arg> &t, reduce_t &value, int i, int j, int k) { return t(value, i, j, k); });
+  }
+
 } // namespace quda
@@ -42,7 +42,9 @@ namespace quda
     std::enable_if_t<device::use_kernel_arg<Arg>(), qudaError_t>
     launch_device(const kernel_t &kernel, const TuneParam &tp, const qudaStream_t &stream, const Arg &arg)
     {
+      const bool timed = startLaunchStats(stream);
       launch_error = qudaLaunchKernel(kernel.func, tp, stream, static_cast<const void *>(&arg));
+      if (timed) stopLaunchStats(stream);
       return launch_error;
     }
 
@@ -52,7 +54,9 @@ namespace quda
     {
       static_assert(sizeof(Arg) <= device::max_constant_size(), "Parameter struct is greater than max constant size");
       qudaMemcpyAsync(device::get_constant_buffer<Arg>(), &arg, sizeof(Arg), qudaMemcpyHostToDevice, stream);
+      const bool timed = startLaunchStats(stream);
       launch_error = qudaLaunchKernel(kernel.func, tp, stream, static_cast<const void *>(&arg));
+      if (timed) stopLaunchStats(stream);
       return launch_error;
     }
 
@@ -93,6 +97,8 @@ namespace quda
       return location == QUDA_CPU_FIELD_LOCATION ? false : Tunable::advanceTuneParam(param);
     }
 
+    bool hostLaunch() const override { return location == QUDA_CPU_FIELD_LOCATION; }
+
     TuneKey tuneKey() const override { return TuneKey(vol, typeid(*this).name(), aux); }
   };
 
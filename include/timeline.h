@@ -0,0 +1,68 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+   @file timeline.h
+
+   @section Timeline of the host-side activity of each process, which
+   is exported in the Chrome trace event format that can be viewed
+   with chrome://tracing or Perfetto.  This is enabled by setting the
+   environment variable QUDA_ENABLE_TIMELINE=1, in which case each
+   process records the kernel launches of tuneLaunch, the phases of
+   each TimeProfile and the communication calls, with timestamps
+   relative to a common epoch.  Each process writes its own timeline,
+   and the timelines of all processes can be merged into a single view.
+ */
+
+namespace quda
+{
+
+  namespace timeline
+  {
+
+    using args_t = std::vector<std::pair<const char *, std::string>>;
+
+    /**
+       @brief Whether the timeline is recorded, which is set with the
+       QUDA_ENABLE_TIMELINE environment variable
+     */
+    bool enabled();
+
+    /**
+       @brief Return the time in microseconds since the epoch of the timeline
+     */
+    double now();
+
+    /**
+       @brief Record an event of the timeline
+       @param[in] name Name of the event
+       @param[in] category Category of the event, which determines the track it is displayed on
+       @param[in] start Start time in microseconds since the epoch
+       @param[in] duration Duration in microseconds
+       @param[in] args Additional key-value pairs shown with the event
+     */
+    void record(const std::string &name, const char *category, double start, double duration,
+                const args_t &args = args_t());
+
+    /**
+       @brief Write the timeline of this process to a file
+       @param[in] path The file to write
+       @param[in] rank The rank of this process
+     */
+    void save(const std::string &path, int rank);
+
+    /**
+       @brief Merge the timelines of several processes into a single
+       timeline, where each process is shown separately, and their
+       times are aligned to the earliest epoch
+       @param[in] inputs The timelines to merge
+       @param[in] output The merged timeline to write
+     */
+    void merge(const std::vector<std::string> &inputs, const std::string &output);
+
+  } // namespace timeline
+
+} // namespace quda
@@ -9,6 +9,7 @@
 #include <quda_internal.h>
 #include <util_quda.h>
 #include <device.h>
+#include <timeline.h>
 
 namespace quda {
 
@@ -273,6 +274,10 @@ namespace quda {
     void Stop_(const char *func, const char *file, int line, QudaProfileType idx) {
       profile[idx].stop(func, file, line);
       POP_RANGE
+      if (timeline::enabled()) {
+        const double last = 1e6 * profile[idx].last_interval;
+        timeline::record(pname[idx], fname.c_str(), timeline::now() - last, last);
+      }
 
       // switch off total timer if we need to
       if (switchOff && idx != QUDA_PROFILE_TOTAL) {
@@ -35,6 +35,13 @@ namespace quda
     */
     bool tuneGridDim() const { return grid_stride; }
 
+    /**
+       @brief The host block reduction kernel is launched with the
+       device launch geometry, and so is not tuned over the host
+       launch parameters
+    */
+    bool hostLaunch() const override { return false; }
+
     /**
        @brief Launch the block reduction kernel with a given block
        size on the device performing the block reduction defined in
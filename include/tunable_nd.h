@@ -47,9 +47,9 @@ namespace quda
        @param[in] arg Kernel argument struct
      */
     template <template <typename> class Functor, typename Arg>
-    void launch_host(const TuneParam &, const qudaStream_t &, const Arg &arg)
+    void launch_host(const TuneParam &tp, const qudaStream_t &, const Arg &arg)
     {
-      Kernel1D_host<Functor, Arg>(arg);
+      Kernel1D_host<Functor, Arg>(arg, host::get_launch_param(tp));
     }
 
     /**
@@ -171,6 +171,11 @@ namespace quda
     mutable unsigned int step_y;
     bool tune_block_x;
 
+    /**
+       @brief Host launches tune the chunk shape in both x and y
+    */
+    int hostChunkDim() const override { return 2; }
+
     /**
        @brief Launch kernel on the device performing the operation
        defined in the functor.
@@ -195,10 +200,10 @@ namespace quda
        @param[in] arg Kernel argument struct
      */
     template <template <typename> class Functor, typename Arg>
-    void launch_host(const TuneParam &, const qudaStream_t &, const Arg &arg)
+    void launch_host(const TuneParam &tp, const qudaStream_t &, const Arg &arg)
     {
       const_cast<Arg &>(arg).threads.y = vector_length_y;
-      Kernel2D_host<Functor, Arg>(arg);
+      Kernel2D_host<Functor, Arg>(arg, host::get_launch_param(tp));
     }
 
     /**
@@ -416,6 +421,11 @@ namespace quda
     mutable unsigned step_z;
     bool tune_block_y;
 
+    /**
+       @brief Host launches tune the chunk shape in x, y and z
+    */
+    int hostChunkDim() const override { return 3; }
+
     /**
        @brief Launch kernel on the device performing the operation
        defined in the functor.
@@ -441,11 +451,11 @@ namespace quda
        @param[in] arg Kernel argument struct
      */
     template <template <typename> class Functor, typename Arg>
-    void launch_host(const TuneParam &, const qudaStream_t &, const Arg &arg)
+    void launch_host(const TuneParam &tp, const qudaStream_t &, const Arg &arg)
     {
       const_cast<Arg &>(arg).threads.y = vector_length_y;
       const_cast<Arg &>(arg).threads.z = vector_length_z;
-      Kernel3D_host<Functor, Arg>(arg);
+      Kernel3D_host<Functor, Arg>(arg, host::get_launch_param(tp));
     }
 
     /**
@@ -27,7 +27,9 @@ namespace quda
     const size_t n_items;
 
     /**
-       Number of threads in y thread block
+       Number of threads in y thread block.  This is clamped to the
+       largest y block dimension of the target, in which case each
+       thread strides over the y dimension.
      */
     const unsigned int block_size_y;
 
@@ -38,6 +40,12 @@ namespace quda
     */
     bool tuneGridDim() const final { return grid_stride; }
 
+    /**
+       @brief Host reductions use a fixed partitioning to ensure
+       reproducibility, so the chunk shape is not tuned
+    */
+    int hostChunkDim() const override { return 0; }
+
     virtual unsigned int minGridSize() const { return std::max(maxGridSize() / 32, 1u); }
 
     virtual unsigned int maxGridSize() const
@@ -96,12 +104,12 @@ namespace quda
        @param[in] arg Kernel argument struct
      */
     template <template <typename> class Functor, typename T, typename Arg>
-    void launch_host(T &result, const TuneParam &, const qudaStream_t &, Arg &arg)
+    void launch_host(T &result, const TuneParam &tp, const qudaStream_t &, Arg &arg)
     {
       if (arg.threads.y != block_size_y)
         errorQuda("Unexected y threads: received %d, expected %d", arg.threads.y, block_size_y);
       std::vector<T> result_(1);
-      result_[0] = Reduction2D_host<Functor, Arg>(arg);
+      result_[0] = Reduction2D_host<Functor, Arg>(arg, host::get_launch_param(tp));
       if (!activeTuning() && commGlobalReduction()) Functor<Arg>::comm_reduce(result_);
       result = result_[0];
     }
@@ -165,7 +173,7 @@ namespace quda
     virtual void initTuneParam(TuneParam &param) const
     {
       TunableKernel::initTuneParam(param);
-      param.block.y = block_size_y;
+      param.block.y = std::min(block_size_y, device::max_threads_per_block_dim(1));
     }
 
     /**
@@ -175,7 +183,7 @@ namespace quda
     virtual void defaultTuneParam(TuneParam &param) const
     {
       TunableKernel::defaultTuneParam(param);
-      param.block.y = block_size_y;
+      param.block.y = std::min(block_size_y, device::max_threads_per_block_dim(1));
     }
   };
 
@@ -243,12 +251,12 @@ namespace quda
        @param[in] arg Kernel argument struct
      */
     template <template <typename> class Functor, typename T, typename Arg>
-    void launch_host(std::vector<T> &result, const TuneParam &, const qudaStream_t &, Arg &arg)
+    void launch_host(std::vector<T> &result, const TuneParam &tp, const qudaStream_t &, Arg &arg)
     {
       if (n_batch_block_max > Arg::max_n_batch_block)
         errorQuda("n_batch_block_max = %u greater than maximum supported %u", n_batch_block_max, Arg::max_n_batch_block);
 
-      auto value = MultiReduction_host<Functor, Arg>(arg);
+      auto value = MultiReduction_host<Functor, Arg>(arg, host::get_launch_param(tp));
       for (int j = 0; j < (int)arg.threads.z; j++) result[j] = value[j];
       if (!activeTuning() && commGlobalReduction()) Functor<Arg>::comm_reduce(result);
     }
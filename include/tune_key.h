@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <cstring>
+#include <initializer_list>
 #include <ostream>
 
 namespace quda {
@@ -14,6 +16,14 @@ namespace quda {
     char name[name_n];
     char aux[aux_n];
 
+    /**
+       64-bit hash of the key strings, used to index the tunecache.
+       Since the strings are often appended to after construction
+       (e.g., in tuneKey()), this is only set when rehash() is called
+       once the key is complete.
+    */
+    uint64_t hash = 0;
+
     TuneKey() { }
     TuneKey(const char v[], const char n[], const char a[]="type=default") {
       strcpy(volume, v);
@@ -26,6 +36,30 @@ namespace quda {
     TuneKey &operator=(const TuneKey &) = default;
     TuneKey &operator=(TuneKey &&) = default;
 
+    /**
+       @brief Compute the hash of the key strings (FNV-1a), with a
+       separator between the strings so that the boundaries are
+       significant.
+    */
+    void rehash()
+    {
+      uint64_t h = 0xcbf29ce484222325ull;
+      for (const char *s : {volume, name, aux}) {
+        for (; *s; s++) h = (h ^ static_cast<unsigned char>(*s)) * 0x100000001b3ull;
+        h = (h ^ 0xff) * 0x100000001b3ull;
+      }
+      hash = h;
+    }
+
+    /**
+       @brief Key equality, which requires both keys to have been hashed
+    */
+    bool operator==(const TuneKey &other) const
+    {
+      return hash == other.hash && std::strcmp(volume, other.volume) == 0 && std::strcmp(name, other.name) == 0
+        && std::strcmp(aux, other.aux) == 0;
+    }
+
     bool operator<(const TuneKey &other) const {
       int vc = std::strcmp(volume, other.volume);
       if (vc < 0) {
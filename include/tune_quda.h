@@ -9,6 +9,8 @@
 #include <iomanip>
 #include <typeinfo>
 #include <map>
+#include <deque>
+#include <vector>
 
 #include <tune_key.h>
 #include <quda_internal.h>
@@ -46,13 +48,250 @@ namespace quda {
   };
 
   /**
-   * @brief Returns a reference to the tunecache map
+     @brief The tunecache, which maps each TuneKey to its TuneParam.
+     This is an open-addressing hash table with linear probing,
+     indexed by the hash carried by the key (see TuneKey::rehash), so
+     a lookup is typically a single key comparison.  The entries are
+     held in insertion order in a deque, so that references to them
+     remain valid as the table grows; only clear() invalidates them,
+     which is signalled by a change in generation().  Each entry also
+     carries a dirty flag, recording whether it has changed since the
+     cache was last saved.
+   */
+  class TuneCache
+  {
+  public:
+    using entry_t = std::pair<TuneKey, TuneParam>;
+
+  private:
+    static constexpr size_t empty_slot = SIZE_MAX;
+
+    struct slot_t {
+      uint64_t hash;
+      size_t index;
+    };
+
+    std::deque<entry_t> entries;
+    std::vector<bool> dirty_; // whether each entry has changed since it was last saved
+    size_t num_dirty_ = 0;
+    std::vector<slot_t> table;
+    uint64_t generation_ = 1;
+
+    /**
+       @brief Return the slot holding the key, or else the empty slot
+       at which it would be inserted
+    */
+    size_t probe(const TuneKey &key) const
+    {
+      const size_t mask = table.size() - 1;
+      for (size_t i = key.hash & mask;; i = (i + 1) & mask) {
+        const slot_t &slot = table[i];
+        if (slot.index == empty_slot || (slot.hash == key.hash && entries[slot.index].first == key)) return i;
+      }
+    }
+
+    /**
+       @brief Double the table size (which is always a power of two),
+       keeping the load factor at most one half
+    */
+    void grow()
+    {
+      std::vector<slot_t> old(table.empty() ? 256 : 2 * table.size(), slot_t {0, empty_slot});
+      std::swap(table, old);
+      const size_t mask = table.size() - 1;
+      for (const auto &slot : old) {
+        if (slot.index == empty_slot) continue;
+        size_t i = slot.hash & mask;
+        while (table[i].index != empty_slot) i = (i + 1) & mask;
+        table[i] = slot;
+      }
+    }
+
+  public:
+    /**
+       @brief Find the parameters for a key
+       @param[in] key The (hashed) key
+       @return Pointer to the parameters, or nullptr if not present
+    */
+    TuneParam *find(const TuneKey &key)
+    {
+      entry_t *entry = find_entry(key);
+      return entry ? &entry->second : nullptr;
+    }
+
+    /**
+       @brief Find the entry (key and parameters) for a key
+       @param[in] key The (hashed) key
+       @return Pointer to the entry, or nullptr if not present
+    */
+    entry_t *find_entry(const TuneKey &key)
+    {
+      if (table.empty()) return nullptr;
+      const slot_t &slot = table[probe(key)];
+      return slot.index == empty_slot ? nullptr : &entries[slot.index];
+    }
+
+    const TuneParam *find(const TuneKey &key) const { return const_cast<TuneCache *>(this)->find(key); }
+
+    /**
+       @brief Return the parameters for a key, inserting default
+       parameters if it is not present
+       @param[in] key The (hashed) key
+    */
+    TuneParam &operator[](const TuneKey &key)
+    {
+      if (2 * (entries.size() + 1) > table.size()) grow();
+      slot_t &slot = table[probe(key)];
+      if (slot.index == empty_slot) {
+        slot = {key.hash, entries.size()};
+        entries.emplace_back(key, TuneParam());
+        dirty_.push_back(true);
+        num_dirty_++;
+      }
+      return entries[slot.index].second;
+    }
+
+    /**
+       @brief Flag the entry of a key as changed since the cache was
+       last saved.  Newly inserted entries are flagged automatically.
+       @param[in] key The (hashed) key, which must be present
+    */
+    void set_dirty(const TuneKey &key)
+    {
+      if (table.empty()) return;
+      const slot_t &slot = table[probe(key)];
+      if (slot.index == empty_slot || dirty_[slot.index]) return;
+      dirty_[slot.index] = true;
+      num_dirty_++;
+    }
+
+    /**
+       @brief Whether the i-th entry (in insertion order) has changed
+       since the cache was last saved
+    */
+    bool dirty(size_t i) const { return dirty_[i]; }
+
+    /** @brief The number of entries that have changed since the cache was last saved */
+    size_t num_dirty() const { return num_dirty_; }
+
+    /** @brief Flag all entries as saved */
+    void clear_dirty()
+    {
+      std::fill(dirty_.begin(), dirty_.end(), false);
+      num_dirty_ = 0;
+    }
+
+    size_t size() const { return entries.size(); }
+    bool empty() const { return entries.empty(); }
+
+    /**
+       @brief Counter that changes whenever references to the entries
+       are invalidated
+    */
+    uint64_t generation() const { return generation_; }
+
+    void clear()
+    {
+      entries.clear();
+      dirty_.clear();
+      num_dirty_ = 0;
+      table.clear();
+      generation_++;
+    }
+
+    /** Iteration is over the entries in insertion order */
+    auto begin() { return entries.begin(); }
+    auto end() { return entries.end(); }
+    auto begin() const { return entries.begin(); }
+    auto end() const { return entries.end(); }
+
+    /**
+       @brief Return the entries ordered by key, for deterministic
+       output
+    */
+    std::vector<const entry_t *> sorted() const;
+  };
+
+  /**
+   * @brief Returns a reference to the tunecache
    * @return tunecache reference
    */
-  const std::map<TuneKey, TuneParam> &getTuneCache();
+  const TuneCache &getTuneCache();
+
+  /**
+     The strategy used by the autotuner to search the launch
+     parameters of a kernel
+   */
+  enum class TuneSearch {
+    EXHAUSTIVE, /** time every candidate, then refine the fastest */
+    DESCENT,    /** coordinate descent from the parameters of the nearest tuned volume */
+    HALVING     /** sweep abandoning clearly slower candidates, then refine the fastest by successive halving */
+  };
+
+  /**
+     @brief Return the default search strategy of the autotuner, set
+     with the QUDA_TUNE_SEARCH environment variable (exhaustive,
+     descent or halving), with exhaustive the default
+   */
+  TuneSearch getTuneSearch();
+
+  /**
+     @brief Return the default time budget in seconds for tuning a
+     kernel, set with the QUDA_TUNE_BUDGET environment variable, with
+     zero (the default) meaning no limit
+   */
+  double getTuneBudget();
+
+  /**
+     @brief Whether the duration of every kernel launch is measured
+     and accumulated into per-kernel statistics, which are written
+     with the profile.  This is enabled by setting the environment
+     variable QUDA_ENABLE_LAUNCH_STATS=1.
+   */
+  bool launchStatsEnabled();
+
+  struct LaunchStats;
+
+  /**
+     @brief Start timing a kernel launch on the given stream
+     @param[in,out] stats The statistics of the kernel being launched
+     @param[in] stream The stream the kernel is launched on
+     @param[in] flops The number of flops of the launch
+     @param[in] bytes The number of bytes of the launch
+   */
+  void recordLaunchStart(LaunchStats &stats, const qudaStream_t &stream, long long flops, long long bytes);
+
+  /**
+     @brief Stop timing the kernel launch started by recordLaunchStart.
+     The duration is accumulated once the launch has completed.
+     @param[in] stream The stream the kernel is launched on
+   */
+  void recordLaunchStop(const qudaStream_t &stream);
+
+  class Tunable;
+  TuneParam tuneLaunch(Tunable &tunable, QudaTune enabled, QudaVerbosity verbosity);
 
   class Tunable {
 
+    friend TuneParam tuneLaunch(Tunable &, QudaTune, QudaVerbosity);
+
+    /**
+       Memoized result of the last tunecache lookup of this instance,
+       which tuneLaunch reuses for as long as the key and the cache
+       generation are unchanged, skipping the lookup on repeated
+       launches.  The key is that of the cached entry, and is compared
+       in full on a hit since distinct keys may share a hash.
+     */
+    struct {
+      const TuneKey *key = nullptr;
+      uint64_t generation = 0;
+      TuneParam *param = nullptr;
+      LaunchStats *stats = nullptr;
+    } tune_memo;
+
+    /** The launch statistics to record the next launch into, set by tuneLaunch if enabled */
+    LaunchStats *launch_stats = nullptr;
+
   protected:
     virtual long long flops() const { return 0; }
     virtual long long bytes() const { return 0; }
@@ -221,6 +460,27 @@ namespace quda {
         configuration */
     qudaError_t launch_error;
 
+    /**
+       @brief Start timing a kernel launch of this instance, if the
+       launch statistics are enabled.  This should immediately precede
+       the launch, and be paired with stopLaunchStats.
+       @param[in] stream The stream the kernel is launched on
+       @return Whether the launch is being timed
+     */
+    bool startLaunchStats(const qudaStream_t &stream)
+    {
+      if (!launch_stats) return false;
+      recordLaunchStart(*launch_stats, stream, flops(), bytes());
+      launch_stats = nullptr; // only the first launch following tuneLaunch is attributed to it
+      return true;
+    }
+
+    /**
+       @brief Stop timing a kernel launch started with startLaunchStats
+       @param[in] stream The stream the kernel is launched on
+     */
+    void stopLaunchStats(const qudaStream_t &stream) { recordLaunchStop(stream); }
+
     /**
        @brief Whether the present instance has already been tuned or not
        @return True if tuned, false if not
@@ -232,8 +492,9 @@ namespace quda {
 
       TuneKey key = tuneKey();
       if (use_managed_memory()) strcat(key.aux, ",managed");
+      key.rehash();
       // if key is present in cache then already tuned
-      return getTuneCache().find(key) != getTuneCache().end();
+      return getTuneCache().find(key) != nullptr;
     }
 
   public:
@@ -258,6 +519,23 @@ namespace quda {
      */
     virtual size_t num_candidates() const { return 10; }
 
+    /**
+     * @brief Whether this instance is launched on the host, in which
+     * case the host launch parameters (thread count, schedule and
+     * chunk shape) are tuned instead of the device launch geometry
+     *
+     * @return true if this is a host launch
+     */
+    virtual bool hostLaunch() const { return false; }
+
+    /**
+     * @brief Number of dimensions of the index space over which the
+     * chunk shape of a host launch is tuned
+     *
+     * @return number of chunk dimensions (zero if the chunk shape is not tunable)
+     */
+    virtual int hostChunkDim() const { return 1; }
+
     /**
      * @brief Parameter to control the number of iteration used in the 2nd phase of tuning, i.e. for the candidates.
      *
@@ -273,6 +551,20 @@ namespace quda {
      */
     virtual float min_tune_time() const { return 1e-3; }
 
+    /**
+     * @brief The strategy used to search the launch parameters of this kernel.
+     *
+     * @return search strategy
+     */
+    virtual TuneSearch tune_search() const { return getTuneSearch(); }
+
+    /**
+     * @brief Time budget for tuning this kernel.  Once exceeded, no further candidates are timed in the 1st phase.
+     *
+     * @return budget in seconds (zero for no limit)
+     */
+    virtual double max_tune_time() const { return getTuneBudget(); }
+
     virtual std::string paramString(const TuneParam &param) const
     {
       std::stringstream ps;
@@ -333,6 +625,12 @@ namespace quda {
      */
     void checkLaunchParam(TuneParam &tp)
     {
+      if (tuneAuxDim() && tp.aux.x == -1 && tp.aux.y == -1 && tp.aux.z == -1 && tp.aux.w == -1)
+        errorQuda("aux tuning enabled but param.aux is not initialized");
+
+      // host launches store their parameters in block and grid, so device limits do not apply
+      if (hostLaunch()) return;
+
       if (tp.block.x * tp.block.y * tp.block.z > device::max_threads_per_block())
         errorQuda("Requested block size %dx%dx%d=%d greater than max %d", tp.block.x, tp.block.y, tp.block.z,
                   tp.block.x * tp.block.y * tp.block.z, device::max_threads_per_block());
@@ -357,9 +655,6 @@ namespace quda {
 
       if (tp.grid.z > device::max_grid_size(2))
         errorQuda("Requested Z-dimension grid size %d greater than max %d", tp.grid.z, device::max_grid_size(2));
-
-      if (tuneAuxDim() && tp.aux.x == -1 && tp.aux.y == -1 && tp.aux.z == -1 && tp.aux.w == -1)
-        errorQuda("aux tuning enabled but param.aux is not initialized");
     }
 
     qudaError_t launchError() const { return launch_error; }
@@ -375,6 +670,16 @@ namespace quda {
   void loadTuneCache();
   void saveTuneCache(bool error = false);
 
+  /**
+     @brief Convert a tunecache file between the binary format
+     (tunecache.bin) and the text format (tunecache.tsv).  The format
+     of the input is detected from its contents, and the output is
+     written in the other format, retaining the version of the input.
+     @param[in] in_path Path of the tunecache to read
+     @param[in] out_path Path of the tunecache to write
+  */
+  void convertTuneCache(const std::string &in_path, const std::string &out_path);
+
   /**
    * @brief Save profile to disk.
    */
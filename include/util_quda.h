@@ -61,9 +61,10 @@ bool getRankVerbosity();
 char *getPrintBuffer();
 
 /**
-   @brief Returns a string of the form
-   ",omp_threads=$OMP_NUM_THREADS", which can be used for storing the
-   number of OMP threads for CPU functions recorded in the tune cache.
+   @brief Returns a string of the form "omp_threads=n,", where n is
+   the number of host threads (see host::max_threads), which can be
+   used for storing the number of OMP threads for CPU functions
+   recorded in the tune cache.
    @return Returns the string
 */
 char* getOmpThreadStr();
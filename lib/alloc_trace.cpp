@@ -0,0 +1,333 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <vector>
+#include <alloc_trace.h>
+#include <timeline.h>
+#include <util_quda.h>
+
+namespace quda
+{
+
+  namespace alloc_trace
+  {
+
+    /** index of the host and device memory usage */
+    enum space_t { HOST, DEVICE, N_SPACE };
+
+    struct usage_t {
+      size_t live = 0;    /** bytes currently allocated */
+      size_t peak = 0;    /** high-water mark of the live bytes */
+      size_t n_alloc = 0; /** number of allocations */
+      size_t total = 0;   /** bytes allocated in total */
+
+      void alloc(size_t bytes)
+      {
+        live += bytes;
+        peak = std::max(peak, live);
+        n_alloc++;
+        total += bytes;
+      }
+
+      void free(size_t bytes) { live -= bytes; }
+    };
+
+    struct site_t {
+      std::string func;
+      std::string file;
+      int line;
+      const char *kind;
+      bool device;
+      usage_t usage;
+    };
+
+    struct category_t {
+      std::string name;
+      int type;                      /** the category of the innermost scope, e.g., spinor */
+      usage_t usage[N_SPACE];
+      size_t device_at_peak = 0;     /** device bytes held at the peak of the total device bytes */
+    };
+
+    struct record_t {
+      size_t bytes;
+      bool device;
+      const char *kind;
+      int site;
+      int category;
+    };
+
+    struct event_t {
+      double time;
+      bool alloc;
+      const char *kind;
+      size_t bytes;
+      int site;
+      int category;
+      size_t live[N_SPACE];
+    };
+
+    static std::mutex trace_mutex;
+
+    static std::vector<site_t> sites;
+    static std::map<std::string, int> site_index;
+    static std::vector<category_t> categories; /** the nested categories, e.g., MG level 1/transfer/spinor */
+    static std::vector<category_t> types;      /** the innermost categories, e.g., spinor */
+    static std::map<std::string, int> category_index;
+    static std::map<std::string, int> type_index;
+    static std::map<void *, record_t> records;
+
+    static usage_t total[N_SPACE];
+    static std::vector<event_t> events;
+    static size_t dropped = 0;
+
+    /** the stack of the nested categories of this thread */
+    static thread_local std::vector<std::string> category_stack;
+
+    bool enabled()
+    {
+      static bool init = false;
+      static bool enable = false;
+
+      if (!init) {
+        char *enable_trace_env = getenv("QUDA_ENABLE_ALLOC_TRACE");
+        if (enable_trace_env && strcmp(enable_trace_env, "1") == 0) enable = true;
+        init = true;
+      }
+      return enable;
+    }
+
+    /**
+       @brief The maximum number of events recorded, which is set with
+       the QUDA_ALLOC_TRACE_MAX_EVENTS environment variable (default
+       1000000), after which further events are dropped, while the
+       aggregates remain exact
+     */
+    static size_t max_events()
+    {
+      static bool init = false;
+      static size_t max = 1000000;
+
+      if (!init) {
+        char *max_events_env = getenv("QUDA_ALLOC_TRACE_MAX_EVENTS");
+        if (max_events_env) max = std::strtoull(max_events_env, nullptr, 10);
+        init = true;
+      }
+      return max;
+    }
+
+    /**
+       @brief Whether a category is the innermost category of this thread
+     */
+    static bool is_current(const std::string &name)
+    {
+      if (category_stack.empty()) return false;
+      const auto &path = category_stack.back();
+      return path == name
+        || (path.size() > name.size() && path.compare(path.size() - name.size(), name.size(), name) == 0
+            && path[path.size() - name.size() - 1] == '/');
+    }
+
+    category_scope::category_scope(const std::string &name) : active(enabled() && !is_current(name))
+    {
+      if (active) category_stack.push_back(category_stack.empty() ? name : category_stack.back() + "/" + name);
+    }
+
+    category_scope::~category_scope()
+    {
+      if (active) category_stack.pop_back();
+    }
+
+    static int get_index(std::map<std::string, int> &index, std::vector<category_t> &list, const std::string &name)
+    {
+      auto it = index.find(name);
+      if (it != index.end()) return it->second;
+      list.push_back(category_t());
+      list.back().name = name;
+      list.back().type = -1;
+      return index[name] = list.size() - 1;
+    }
+
+    /**
+       @brief Return the index of the current category of this thread
+     */
+    static int current_category()
+    {
+      const std::string name = category_stack.empty() ? "uncategorized" : category_stack.back();
+      int c = get_index(category_index, categories, name);
+      if (categories[c].type < 0) {
+        auto leaf = name.rfind('/');
+        categories[c].type = get_index(type_index, types, leaf == std::string::npos ? name : name.substr(leaf + 1));
+      }
+      return c;
+    }
+
+    static int get_site(const char *kind, bool device, const char *func, const char *file, int line)
+    {
+      std::string key = std::string(file) + ":" + std::to_string(line) + " " + func + " " + kind;
+      auto it = site_index.find(key);
+      if (it != site_index.end()) return it->second;
+      sites.push_back({func, file, line, kind, device, usage_t()});
+      return site_index[key] = sites.size() - 1;
+    }
+
+    static void record_event(bool alloc, const record_t &record)
+    {
+      const double time = timeline::now();
+      if (events.size() < max_events()) {
+        events.push_back({time, alloc, record.kind, record.bytes, record.site, record.category,
+                          {total[HOST].live, total[DEVICE].live}});
+      } else {
+        dropped++;
+      }
+
+      if (timeline::enabled()) {
+        const auto &site = sites[record.site];
+        timeline::record(std::string(alloc ? "alloc " : "free ") + record.kind, "memory", time, 0.0,
+                         {{"bytes", std::to_string(record.bytes)},
+                          {"category", categories[record.category].name},
+                          {"site", site.file + ":" + std::to_string(site.line) + " " + site.func},
+                          {"device live", std::to_string(total[DEVICE].live)},
+                          {"host live", std::to_string(total[HOST].live)}});
+      }
+    }
+
+    void record_alloc(const char *kind, bool device, void *ptr, size_t bytes, const char *func, const char *file,
+                      int line)
+    {
+      if (!ptr) return;
+      std::lock_guard<std::mutex> lock(trace_mutex);
+
+      const int space = device ? DEVICE : HOST;
+      record_t record = {bytes, device, kind, get_site(kind, device, func, file, line), current_category()};
+      records[ptr] = record;
+
+      auto &category = categories[record.category];
+      sites[record.site].usage.alloc(bytes);
+      category.usage[space].alloc(bytes);
+      types[category.type].usage[space].alloc(bytes);
+      total[space].alloc(bytes);
+
+      // snapshot the composition of the device memory at its peak
+      if (device && total[DEVICE].live == total[DEVICE].peak) {
+        for (auto &c : categories) c.device_at_peak = c.usage[DEVICE].live;
+        for (auto &t : types) t.device_at_peak = t.usage[DEVICE].live;
+      }
+
+      record_event(true, record);
+    }
+
+    void record_free(void *ptr)
+    {
+      std::lock_guard<std::mutex> lock(trace_mutex);
+      auto it = records.find(ptr);
+      if (it == records.end()) return;
+      const record_t record = it->second;
+      records.erase(it);
+
+      const int space = record.device ? DEVICE : HOST;
+      auto &category = categories[record.category];
+      sites[record.site].usage.free(record.bytes);
+      category.usage[space].free(record.bytes);
+      types[category.type].usage[space].free(record.bytes);
+      total[space].free(record.bytes);
+
+      record_event(false, record);
+    }
+
+    /**
+       @brief Return the categories ordered by their peak device
+       bytes, followed by their peak host bytes
+     */
+    static std::vector<const category_t *> sorted(const std::vector<category_t> &list)
+    {
+      std::vector<const category_t *> order;
+      for (auto &c : list) order.push_back(&c);
+      std::stable_sort(order.begin(), order.end(), [](const category_t *a, const category_t *b) {
+        return a->usage[DEVICE].peak != b->usage[DEVICE].peak ? a->usage[DEVICE].peak > b->usage[DEVICE].peak :
+                                                                a->usage[HOST].peak > b->usage[HOST].peak;
+      });
+      return order;
+    }
+
+    static void print_categories(const char *title, const std::vector<category_t> &list)
+    {
+      constexpr double MiB = 1 << 20;
+      printfQuda("%-48s %12s %12s %12s %12s %12s\n", title, "device live", "device peak", "at peak", "host live",
+                 "host peak");
+      for (auto c : sorted(list)) {
+        printfQuda("%-48s %12.1f %12.1f %12.1f %12.1f %12.1f\n", c->name.c_str(), c->usage[DEVICE].live / MiB,
+                   c->usage[DEVICE].peak / MiB, c->device_at_peak / MiB, c->usage[HOST].live / MiB,
+                   c->usage[HOST].peak / MiB);
+      }
+    }
+
+    void print_summary(int n_site)
+    {
+      if (!enabled()) return;
+      std::lock_guard<std::mutex> lock(trace_mutex);
+      constexpr double MiB = 1 << 20;
+
+      printfQuda("Allocation trace: device live = %.1f MiB (peak %.1f MiB), host live = %.1f MiB (peak %.1f MiB)\n",
+                 total[DEVICE].live / MiB, total[DEVICE].peak / MiB, total[HOST].live / MiB, total[HOST].peak / MiB);
+      print_categories("Type (MiB)", types);
+      print_categories("Category (MiB)", categories);
+
+      std::vector<const site_t *> order;
+      for (auto &s : sites) order.push_back(&s);
+      std::stable_sort(order.begin(), order.end(), [](const site_t *a, const site_t *b) {
+        return a->device != b->device ? a->device : a->usage.peak > b->usage.peak;
+      });
+      if (order.size() > static_cast<size_t>(n_site)) order.resize(n_site);
+
+      printfQuda("%-14s %12s %12s %10s  %s\n", "Site (MiB)", "live", "peak", "count", "location");
+      for (auto s : order) {
+        printfQuda("%-14s %12.1f %12.1f %10lu  %s(), %s:%d\n", s->kind, s->usage.live / MiB, s->usage.peak / MiB,
+                   s->usage.n_alloc, s->func.c_str(), s->file.c_str(), s->line);
+      }
+    }
+
+    void save(const std::string &prefix, int rank)
+    {
+      if (!enabled()) return;
+      std::lock_guard<std::mutex> lock(trace_mutex);
+
+      std::ofstream sites_file(prefix + "alloc_sites_" + std::to_string(rank) + ".tsv");
+      if (!sites_file) {
+        warningQuda("Unable to write the allocation trace with prefix %s", prefix.c_str());
+        return;
+      }
+      sites_file << "kind\tlive\tpeak\tcount\ttotal\tfunction\tlocation" << std::endl;
+      for (auto &s : sites)
+        sites_file << s.kind << "\t" << s.usage.live << "\t" << s.usage.peak << "\t" << s.usage.n_alloc << "\t"
+                   << s.usage.total << "\t" << s.func << "\t" << s.file << ":" << s.line << std::endl;
+
+      std::ofstream categories_file(prefix + "alloc_categories_" + std::to_string(rank) + ".tsv");
+      categories_file << "category\ttype\tdevice_live\tdevice_peak\tdevice_at_peak\tdevice_count\t"
+                      << "host_live\thost_peak\thost_count" << std::endl;
+      for (auto c : sorted(categories))
+        categories_file << c->name << "\t" << types[c->type].name << "\t" << c->usage[DEVICE].live << "\t"
+                        << c->usage[DEVICE].peak << "\t" << c->device_at_peak << "\t" << c->usage[DEVICE].n_alloc
+                        << "\t" << c->usage[HOST].live << "\t" << c->usage[HOST].peak << "\t"
+                        << c->usage[HOST].n_alloc << std::endl;
+
+      std::ofstream trace_file(prefix + "alloc_trace_" + std::to_string(rank) + ".tsv");
+      trace_file << "time_us\tevent\tkind\tbytes\tdevice_live\thost_live\tcategory\tsite" << std::endl;
+      trace_file << std::fixed << std::setprecision(3);
+      for (auto &e : events) {
+        const auto &site = sites[e.site];
+        trace_file << e.time << "\t" << (e.alloc ? "alloc" : "free") << "\t" << e.kind << "\t" << e.bytes << "\t"
+                   << e.live[DEVICE] << "\t" << e.live[HOST] << "\t" << categories[e.category].name << "\t"
+                   << site.func << " " << site.file << ":" << site.line << std::endl;
+      }
+
+      if (dropped > 0)
+        warningQuda("%lu allocation events were dropped, increase QUDA_ALLOC_TRACE_MAX_EVENTS to record them", dropped);
+    }
+
+  } // namespace alloc_trace
+
+} // namespace quda
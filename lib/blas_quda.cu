@@ -2,6 +2,7 @@
 #include <color_spinor_field.h>
 #include <tunable_nd.h>
 #include <kernels/blas_core.cuh>
+#include <blas_host_simd.h>
 
 namespace quda {
 
@@ -10,6 +11,42 @@ namespace quda {
     unsigned long long flops;
     unsigned long long bytes;
 
+    /**
+       @brief Apply the vectorized host kernel that matches the functor,
+       if there is one.  The field arguments point to the start of a
+       contiguous array of n real numbers.
+       @return Whether a vectorized kernel was applied
+     */
+    template <typename real>
+    bool host_simd(const axpbyz_<real> &f, real *x, real *y, real *, real *, real *v, size_t n,
+                   const host::launch_param &param)
+    {
+      simd::axpbyz(f.a, x, f.b, y, v, n, param);
+      return true;
+    }
+
+    template <typename real>
+    bool host_simd(const caxpy_<real> &f, real *x, real *y, real *, real *, real *, size_t n,
+                   const host::launch_param &param)
+    {
+      simd::caxpy(f.a, x, y, n, param);
+      return true;
+    }
+
+    template <typename real>
+    bool host_simd(const axpyZpbx_<real> &f, real *x, real *y, real *z, real *, real *, size_t n,
+                   const host::launch_param &param)
+    {
+      simd::axpyZpbx(f.a, x, y, z, f.b, n, param);
+      return true;
+    }
+
+    template <typename Functor, typename real>
+    bool host_simd(const Functor &, real *, real *, real *, real *, real *, size_t, const host::launch_param &)
+    {
+      return false;
+    }
+
     template <template <typename real> class Functor, typename store_t, typename y_store_t,
               int nSpin, typename coeff_t>
     class Blas : public TunableGridStrideKernel2D
@@ -103,6 +140,23 @@ namespace quda {
           const int threads = x.Length() / (nParity * M);
 
           TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+
+          // single and double precision fields are contiguous arrays of reals per parity, so use the vectorized path if possible
+          if constexpr (std::is_same<host_store_t, host_y_store_t>::value && !isFixed<host_store_t>::value) {
+            if (simd::enabled() && !x.IsComposite()) {
+              auto param = host::get_launch_param(tp);
+              auto parity_ptr = [](ColorSpinorField &f, int parity) {
+                return static_cast<host_store_t *>(f.V()) + parity * (f.Bytes() / (2 * sizeof(host_store_t)));
+              };
+              bool applied = true;
+              for (int parity = 0; parity < nParity && applied; parity++) {
+                applied = host_simd(f_, parity_ptr(x, parity), parity_ptr(y, parity), parity_ptr(z, parity),
+                                    parity_ptr(w, parity), parity_ptr(v, parity), threads * M, param);
+              }
+              if (applied) return;
+            }
+          }
+
           BlasArg<host_real_t, M, host_store_t, N, host_y_store_t, Ny, decltype(f_)> arg(x, y, z, w, v, f_, threads, nParity);
 
           launch_host<Blas_>(tp, stream, arg);
@@ -225,6 +279,12 @@ namespace quda {
       instantiate<tripleCGUpdate_, Blas, true>(a, b, 0.0, x, y, z, w, y);
     }
 
+    void pipeCGUpdate(double a, double b, const ColorSpinorField &x, ColorSpinorField &y, ColorSpinorField &z,
+                      ColorSpinorField &w)
+    {
+      instantiate<pipeCGUpdate_, Blas, false>(a, b, 0.0, x, y, z, w, y);
+    }
+
   } // namespace blas
 
 } // namespace quda
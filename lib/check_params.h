@@ -703,6 +703,28 @@ void printQudaInvertParam(QudaInvertParam *param) {
   if (param->chrono_precision == QUDA_INVALID_PRECISION) param->chrono_precision = param->cuda_prec;
 #endif
 
+#if defined INIT_PARAM
+  P(recycle_max_dim, 0);
+  P(recycle_index, 0);
+#else
+  P(recycle_max_dim, INVALID_INT);
+  P(recycle_index, INVALID_INT);
+#endif
+
+#ifdef INIT_PARAM
+  P(checkpoint_file[0], '\0');
+#endif
+
+#if defined INIT_PARAM
+  P(checkpoint_interval, 0);
+  P(checkpoint_signal, 0);
+  P(checkpoint_resume, QUDA_BOOLEAN_FALSE);
+#else
+  P(checkpoint_interval, INVALID_INT);
+  P(checkpoint_signal, INVALID_INT);
+  P(checkpoint_resume, QUDA_BOOLEAN_INVALID);
+#endif
+
 #if defined INIT_PARAM
   P(extlib_type, QUDA_EIGEN_EXTLIB);
 #else
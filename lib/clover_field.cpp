@@ -9,6 +9,7 @@
 #include <gauge_field.h>
 #include <color_spinor_field.h>
 #include <blas_quda.h>
+#include <alloc_trace.h>
 
 namespace quda {
 
@@ -52,6 +53,8 @@ namespace quda {
     create(param.create),
     trlog {0, 0}
   {
+    alloc_trace::category_scope category("clover");
+
     if (siteSubset != QUDA_FULL_SITE_SUBSET) errorQuda("Unexpected siteSubset %d", siteSubset);
     if (nDim != 4) errorQuda("Number of dimensions must be 4, not %d", nDim);
     if (!isNative() && precision < QUDA_SINGLE_PRECISION)
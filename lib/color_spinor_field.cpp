@@ -1,11 +1,13 @@
 #include <string.h>
 #include <iostream>
 #include <typeinfo>
+#include <utility>
 
 #include <color_spinor_field.h>
 #include <dslash_quda.h>
 #include <field_cache.h>
 #include <uint_to_char.h>
+#include <alloc_trace.h>
 
 static bool zeroCopy = false;
 
@@ -98,6 +100,8 @@ namespace quda
 
   void ColorSpinorField::create(const ColorSpinorParam &param)
   {
+    alloc_trace::category_scope category("spinor");
+
     if (param.create == QUDA_INVALID_FIELD_CREATE) errorQuda("Invalid create type");
 
     siteOrder = param.siteOrder;
@@ -846,13 +850,10 @@ namespace quda
     param.create = QUDA_GHOST_FIELD_CREATE;
 
     // we use a custom cache key for ghost-only fields
-    FieldKey<ColorSpinorField> key;
-    key.volume = v[0].VolString();
-    key.aux = v[0].AuxString();
     char aux[32];
     strcpy(aux, ",ghost_batch=");
     u32toa(aux + 13, v.size());
-    key.aux += aux;
+    FieldKey<ColorSpinorField> key(v[0].VolString(), v[0].AuxString() + aux);
 
     return FieldTmp<ColorSpinorField>(key, param);
   }
@@ -1137,6 +1138,7 @@ namespace quda
     if (!commDimPartitioned(dim)) return;
     if (gdr && !comm_gdr_enabled()) errorQuda("Requesting GDR comms but GDR is not enabled");
 
+    haloPlanClear(dim, 1 - dir, false);
     if (comm_peer2peer_enabled(1 - dir, dim)) {
       comm_start(mh_recv_p2p[bufferIndex][dim][1 - dir]);
     } else if (gdr) {
@@ -1157,6 +1159,7 @@ namespace quda
     if (!commDimPartitioned(dim)) return;
     if (gdr && !comm_gdr_enabled()) errorQuda("Requesting GDR comms but GDR is not enabled");
 
+    haloPlanClear(dim, dir, true);
     if (!comm_peer2peer_enabled(dir, dim)) {
       if (gdr)
         comm_start(mh_send_rdma[bufferIndex][dim][dir]);
@@ -1180,6 +1183,38 @@ namespace quda
     }
   }
 
+  void ColorSpinorField::recvStartAll(const int *comm_dim, bool gdr)
+  {
+    if (Location() == QUDA_CPU_FIELD_LOCATION) errorQuda("Host field not supported");
+    if (gdr && !comm_gdr_enabled()) errorQuda("Requesting GDR comms but GDR is not enabled");
+
+    int mask = 0;
+    for (int dim = 0; dim < nDimComms; dim++) {
+      if (!comm_dim[dim] || !commDimPartitioned(dim)) continue;
+      for (int dir = 0; dir < 2; dir++) {
+        if (comm_peer2peer_enabled(dir, dim))
+          comm_start(mh_recv_p2p[bufferIndex][dim][dir]);
+        else
+          mask |= 1 << (2 * dim + dir);
+      }
+    }
+    haloPlanStart(mask, false, gdr);
+  }
+
+  void ColorSpinorField::sendStartAll(const int *comm_dim, bool gdr)
+  {
+    if (Location() == QUDA_CPU_FIELD_LOCATION) errorQuda("Host field not supported");
+    if (gdr && !comm_gdr_enabled()) errorQuda("Requesting GDR comms but GDR is not enabled");
+
+    int mask = 0;
+    for (int dim = 0; dim < nDimComms; dim++) {
+      if (!comm_dim[dim] || !commDimPartitioned(dim)) continue;
+      for (int dir = 0; dir < 2; dir++)
+        if (!comm_peer2peer_enabled(dir, dim)) mask |= 1 << (2 * dim + dir);
+    }
+    haloPlanStart(mask, true, gdr);
+  }
+
   void ColorSpinorField::commsStart(int dir, const qudaStream_t &stream, bool gdr_send, bool gdr_recv)
   {
     recvStart(dir, stream, gdr_recv);
@@ -1204,21 +1239,21 @@ namespace quda
     // first query send to backwards
     if (comm_peer2peer_enabled(dir, dim)) {
       if (!complete_send[dim][dir]) complete_send[dim][dir] = comm_query(mh_send_p2p[bufferIndex][dim][dir]);
-    } else if (gdr_send) {
-      if (!complete_send[dim][dir]) complete_send[dim][dir] = comm_query(mh_send_rdma[bufferIndex][dim][dir]);
-    } else {
-      if (!complete_send[dim][dir]) complete_send[dim][dir] = comm_query(mh_send[bufferIndex][dim][dir]);
+    } else if (!complete_send[dim][dir]) {
+      int query = haloPlanQuery(dim, dir, true, gdr_send);
+      if (query < 0) query = comm_query(gdr_send ? mh_send_rdma[bufferIndex][dim][dir] : mh_send[bufferIndex][dim][dir]);
+      complete_send[dim][dir] = query;
     }
 
     // second query receive from forwards
     if (comm_peer2peer_enabled(1 - dir, dim)) {
       if (!complete_recv[dim][1 - dir])
         complete_recv[dim][1 - dir] = comm_query(mh_recv_p2p[bufferIndex][dim][1 - dir]);
-    } else if (gdr_recv) {
-      if (!complete_recv[dim][1 - dir])
-        complete_recv[dim][1 - dir] = comm_query(mh_recv_rdma[bufferIndex][dim][1 - dir]);
-    } else {
-      if (!complete_recv[dim][1 - dir]) complete_recv[dim][1 - dir] = comm_query(mh_recv[bufferIndex][dim][1 - dir]);
+    } else if (!complete_recv[dim][1 - dir]) {
+      int query = haloPlanQuery(dim, 1 - dir, false, gdr_recv);
+      if (query < 0)
+        query = comm_query(gdr_recv ? mh_recv_rdma[bufferIndex][dim][1 - dir] : mh_recv[bufferIndex][dim][1 - dir]);
+      complete_recv[dim][1 - dir] = query;
     }
 
     if (complete_recv[dim][1 - dir] && complete_send[dim][dir]) {
@@ -0,0 +1,155 @@
+#include <array>
+#include <limits>
+#include <map>
+
+#include <quda_internal.h>
+#include <comm_quda.h>
+
+/**
+   @file comm_grid.cpp
+
+   @brief Automatic selection of the process grid.  The grid is the
+   product of a grid of nodes and an intra-node grid of the ranks of
+   each node.  We enumerate all such pairs of factorizations, and
+   choose the one that minimizes the halo traffic leaving a node, and
+   then the total halo traffic.  Since a dimension whose faces are
+   large is expensive to cut between nodes, this places the intra-node
+   neighbors along the busiest dimensions.
+ */
+
+namespace quda
+{
+
+  /**
+     @brief All ordered factorizations of n into ndim factors
+   */
+  static void factorize(int n, int ndim, std::vector<std::array<int, QUDA_MAX_DIM>> &factors,
+                        std::array<int, QUDA_MAX_DIM> &f, int d = 0)
+  {
+    if (d == ndim - 1) {
+      f[d] = n;
+      factors.push_back(f);
+      return;
+    }
+    for (int k = 1; k <= n; k++) {
+      if (n % k) continue;
+      f[d] = k;
+      factorize(n / k, ndim, factors, f, d + 1);
+    }
+  }
+
+  static std::vector<std::array<int, QUDA_MAX_DIM>> factorize(int n, int ndim)
+  {
+    std::vector<std::array<int, QUDA_MAX_DIM>> factors;
+    std::array<int, QUDA_MAX_DIM> f;
+    f.fill(1);
+    factorize(n, ndim, factors, f);
+    return factors;
+  }
+
+  /**
+     @brief Lexicographical index with the last dimension running fastest
+   */
+  static int lex_index(int ndim, const int *dims, const int *x)
+  {
+    int idx = x[0];
+    for (int d = 1; d < ndim; d++) idx = dims[d] * idx + x[d];
+    return idx;
+  }
+
+  void comm_select_grid(int ndim, const int *X, const std::vector<int> &node, int *dims, std::vector<int> &rank_map)
+  {
+    if (ndim > QUDA_MAX_DIM) errorQuda("ndim exceeds QUDA_MAX_DIM");
+    const int size = node.size();
+    if (size == 0) errorQuda("No ranks to map");
+
+    // group the ranks by node, in order of their first appearance
+    std::map<int, int> node_index;
+    std::vector<std::vector<int>> node_ranks;
+    for (int r = 0; r < size; r++) {
+      auto it = node_index.find(node[r]);
+      if (it == node_index.end()) {
+        it = node_index.emplace(node[r], node_ranks.size()).first;
+        node_ranks.emplace_back();
+      }
+      node_ranks[it->second].push_back(r);
+    }
+
+    // the intra-node grid must be the same on every node
+    bool uniform = true;
+    for (auto &ranks : node_ranks) uniform = uniform && ranks.size() == node_ranks[0].size();
+    if (!uniform) {
+      warningQuda("Ranks are not evenly distributed over the nodes, ignoring the node boundaries");
+      node_ranks.clear();
+      for (int r = 0; r < size; r++) node_ranks.push_back({r});
+    }
+    const int n_node = node_ranks.size();
+    const int n_local = node_ranks[0].size();
+
+    double best_off_node = std::numeric_limits<double>::max();
+    double best_total = std::numeric_limits<double>::max();
+    std::array<int, QUDA_MAX_DIM> best_node, best_local;
+    bool found = false;
+
+    auto node_grids = factorize(n_node, ndim);
+    auto local_grids = factorize(n_local, ndim);
+    for (auto &n : node_grids) {
+      for (auto &l : local_grids) {
+        int g[QUDA_MAX_DIM];
+        double local_volume = 1.0;
+        bool valid = true;
+        for (int d = 0; d < ndim; d++) {
+          g[d] = n[d] * l[d];
+          // the local lattice must be even for the checkerboarding
+          if (X[d] % g[d] != 0 || (g[d] > 1 && (X[d] / g[d]) % 2 != 0)) valid = false;
+          local_volume *= static_cast<double>(X[d]) / g[d];
+        }
+        if (!valid) continue;
+
+        // halo volume per node, both directions, of the faces that cross a node boundary, and of all faces
+        double off_node = 0.0, total = 0.0;
+        for (int d = 0; d < ndim; d++) {
+          if (g[d] == 1) continue;
+          double face = local_volume / (X[d] / g[d]);
+          total += 2 * face * n_local;
+          if (n[d] > 1) off_node += 2 * face * (n_local / l[d]);
+        }
+
+        // ties are broken in favor of the first candidate, which partitions the last dimensions the most
+        if (off_node < best_off_node || (off_node == best_off_node && total < best_total)) {
+          best_off_node = off_node;
+          best_total = total;
+          best_node = n;
+          best_local = l;
+          found = true;
+        }
+      }
+    }
+
+    if (!found) {
+      errorQuda("No process grid of %d ranks divides the lattice %d x %d x %d x %d into even local extents", size,
+                X[0], ndim > 1 ? X[1] : 1, ndim > 2 ? X[2] : 1, ndim > 3 ? X[3] : 1);
+    }
+
+    for (int d = 0; d < ndim; d++) dims[d] = best_node[d] * best_local[d];
+
+    // coordinate x is on node x / l and is the (x % l)-th rank on that node
+    rank_map.resize(size);
+    int x[QUDA_MAX_DIM] = {};
+    for (int i = 0; i < size; i++) {
+      int nx[QUDA_MAX_DIM] = {}, lx[QUDA_MAX_DIM] = {};
+      for (int d = 0; d < ndim; d++) {
+        nx[d] = x[d] / best_local[d];
+        lx[d] = x[d] % best_local[d];
+      }
+      rank_map[lex_index(ndim, dims, x)]
+        = node_ranks[lex_index(ndim, best_node.data(), nx)][lex_index(ndim, best_local.data(), lx)];
+
+      for (int d = ndim - 1; d >= 0; d--) {
+        if (++x[d] < dims[d]) break;
+        x[d] = 0;
+      }
+    }
+  }
+
+} // namespace quda
@@ -35,6 +35,24 @@ namespace quda
     bool custom;
   };
 
+  struct MsgPlan_s {
+    /**
+       Copies of the persistent requests of the messages, which are
+       contiguous such that they can be started and tested together.
+     */
+    std::vector<MPI_Request> request;
+
+    /**
+       Whether each message has completed since the set was started
+     */
+    std::vector<int> complete;
+
+    /**
+       The indices of the messages completed by MPI_Testsome
+     */
+    std::vector<int> index;
+  };
+
   Communicator::Communicator(int nDim, const int *commDims, QudaCommsMap rank_from_coords, void *map_data,
                              bool user_set_comm_handle_, void *user_comm)
   {
@@ -271,6 +289,47 @@ namespace quda
     return query;
   }
 
+  MsgPlan *Communicator::comm_declare_plan(MsgHandle *const *mh, int n)
+  {
+    auto *plan = new MsgPlan;
+    for (int i = 0; i < n; i++) plan->request.push_back(mh[i]->request);
+    plan->complete.resize(n, 1);
+    plan->index.resize(n);
+    return plan;
+  }
+
+  void Communicator::comm_free_plan(MsgPlan *&plan)
+  {
+    // the requests are owned by the message handles
+    delete plan;
+    plan = nullptr;
+  }
+
+  void Communicator::comm_start_plan(MsgPlan *plan)
+  {
+    MPI_CHECK(MPI_Startall(plan->request.size(), plan->request.data()));
+    std::fill(plan->complete.begin(), plan->complete.end(), 0);
+  }
+
+  void Communicator::comm_wait_plan(MsgPlan *plan)
+  {
+    MPI_CHECK(MPI_Waitall(plan->request.size(), plan->request.data(), MPI_STATUSES_IGNORE));
+    std::fill(plan->complete.begin(), plan->complete.end(), 1);
+  }
+
+  int Communicator::comm_query_plan(MsgPlan *plan, int i)
+  {
+    if (!plan->complete[i]) {
+      int count;
+      MPI_CHECK(MPI_Testsome(plan->request.size(), plan->request.data(), &count, plan->index.data(),
+                             MPI_STATUSES_IGNORE));
+      // inactive requests, e.g., those that have been waited on individually, are ignored
+      if (count == MPI_UNDEFINED) std::fill(plan->complete.begin(), plan->complete.end(), 1);
+      for (int j = 0; j < count && count != MPI_UNDEFINED; j++) plan->complete[plan->index[j]] = 1;
+    }
+    return plan->complete[i];
+  }
+
   void Communicator::comm_allreduce_sum_array(double *data, size_t size)
   {
     if (!comm_deterministic_reduce()) {
@@ -291,6 +350,22 @@ namespace quda
     }
   }
 
+  void Communicator::comm_allreduce_sum_start(double *data, size_t size)
+  {
+    if (reduce_request != MPI_REQUEST_NULL) errorQuda("Non-blocking reduction already in flight");
+    if (!comm_deterministic_reduce()) {
+      MPI_CHECK(MPI_Iallreduce(MPI_IN_PLACE, data, size, MPI_DOUBLE, MPI_SUM, MPI_COMM_HANDLE, &reduce_request));
+    } else {
+      // the deterministic reduction gathers and sorts all contributions, so is done here
+      comm_allreduce_sum_array(data, size);
+    }
+  }
+
+  void Communicator::comm_allreduce_sum_wait()
+  {
+    if (reduce_request != MPI_REQUEST_NULL) MPI_CHECK(MPI_Wait(&reduce_request, MPI_STATUS_IGNORE));
+  }
+
   void Communicator::comm_allreduce_max_array(deviation_t<double> *data, size_t size)
   {
     size_t n = comm_size();
@@ -36,6 +36,15 @@ namespace quda
     QMP_msghandle_t handle;
   };
 
+  /**
+     QMP handles cannot be regrouped once declared, so a set of
+     messages is started and tested one message at a time.
+   */
+  struct MsgPlan_s {
+    std::vector<MsgHandle *> mh;
+    std::vector<int> complete;
+  };
+
   Communicator::Communicator(int nDim, const int *commDims, QudaCommsMap rank_from_coords, void *map_data,
                              bool user_set_comm_handle_, void *user_comm)
   {
@@ -299,6 +308,42 @@ void Communicator::comm_wait(MsgHandle *mh) { QMP_CHECK(QMP_wait(mh->handle)); }
 
 int Communicator::comm_query(MsgHandle *mh) { return (QMP_is_complete(mh->handle) == QMP_TRUE); }
 
+MsgPlan *Communicator::comm_declare_plan(MsgHandle *const *mh, int n)
+{
+  auto *plan = new MsgPlan;
+  plan->mh.assign(mh, mh + n);
+  plan->complete.resize(n, 1);
+  return plan;
+}
+
+void Communicator::comm_free_plan(MsgPlan *&plan)
+{
+  delete plan;
+  plan = nullptr;
+}
+
+void Communicator::comm_start_plan(MsgPlan *plan)
+{
+  for (auto mh : plan->mh) comm_start(mh);
+  std::fill(plan->complete.begin(), plan->complete.end(), 0);
+}
+
+void Communicator::comm_wait_plan(MsgPlan *plan)
+{
+  for (size_t i = 0; i < plan->mh.size(); i++)
+    if (!plan->complete[i]) comm_wait(plan->mh[i]);
+  std::fill(plan->complete.begin(), plan->complete.end(), 1);
+}
+
+int Communicator::comm_query_plan(MsgPlan *plan, int i)
+{
+  if (!plan->complete[i]) {
+    for (size_t j = 0; j < plan->mh.size(); j++)
+      if (!plan->complete[j]) plan->complete[j] = comm_query(plan->mh[j]);
+  }
+  return plan->complete[i];
+}
+
 void Communicator::comm_allreduce_sum_array(double *data, size_t size)
 {
   if (!comm_deterministic_reduce()) {
@@ -318,6 +363,11 @@ void Communicator::comm_allreduce_sum_array(double *data, size_t size)
   }
 }
 
+// QMP has no non-blocking collectives, so the reduction is completed when it is started
+void Communicator::comm_allreduce_sum_start(double *data, size_t size) { comm_allreduce_sum_array(data, size); }
+
+void Communicator::comm_allreduce_sum_wait() { }
+
 void Communicator::comm_allreduce_max_array(deviation_t<double> *data, size_t size)
 {
   size_t n = comm_size();
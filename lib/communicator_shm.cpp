@@ -0,0 +1,827 @@
+/**
+ * Intra-node shared-memory communications layer.  The ranks are
+ * processes on a single node, which exchange their messages through
+ * POSIX shared-memory segments and synchronize with atomic counters,
+ * sleeping on futexes when their peers are not ready.  The processes
+ * are started with the shm_launch utility, which sets the environment
+ * variables QUDA_SHM_RANK, QUDA_SHM_SIZE and QUDA_SHM_JOB.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
+#include <communicator_quda.h>
+
+namespace quda
+{
+
+  namespace shm
+  {
+
+    /** size of the per-rank slots through which the collectives are staged */
+    constexpr size_t slot_bytes = 64 << 10;
+
+    /** the number of messages that can be in flight on each channel, which must be a power of two */
+    constexpr uint32_t depth = 2;
+    static_assert((depth & (depth - 1)) == 0, "channel depth must be a power of two");
+
+    /** alignment of the shared structures, which keeps the counters written by different ranks apart */
+    constexpr size_t align = 128;
+
+    /**
+       The control block at the start of the segment of each
+       communicator, which is followed by the doorbell and the slot of
+       each rank.
+     */
+    struct control_t {
+      alignas(align) std::atomic<uint32_t> arrived; /** number of ranks that have arrived at the barrier */
+      std::atomic<uint32_t> generation;             /** number of completed barriers */
+      std::atomic<uint32_t> waiters;                /** number of ranks sleeping in the barrier */
+      alignas(align) std::atomic<uint32_t> abort;   /** set when a rank aborts */
+      int status;                                   /** the exit status of the aborting rank */
+    };
+
+    /**
+       The doorbell of a rank, which is rung whenever a peer writes or
+       reads a message on one of its channels, such that a rank waiting
+       for a message sleeps on a single counter however many channels
+       it has in flight.
+     */
+    struct bell_t {
+      alignas(align) std::atomic<uint32_t> count; /** number of times the rank was notified */
+      std::atomic<uint32_t> waiters;              /** number of processes sleeping on the count */
+    };
+
+    /**
+       The header of a point-to-point channel, which is followed by
+       the message slots.  The produced counter is only written by the
+       sender and the consumed counter only by the receiver.
+     */
+    struct channel_header_t {
+      alignas(align) std::atomic<uint32_t> produced; /** number of messages written by the sender */
+      alignas(align) std::atomic<uint32_t> consumed; /** number of messages read by the receiver */
+    };
+
+    /**
+       The process-local state of a communicator
+     */
+    struct segment_t {
+      std::string name;                /** name of the shared segment */
+      control_t *control;              /** the control block */
+      bell_t *bells;                   /** the per-rank doorbells */
+      char *slots;                     /** the per-rank slots */
+      size_t bytes;                    /** size of the mapping */
+      std::set<std::string> channels;  /** the channels opened with this communicator */
+    };
+
+    /**
+       The process-local state of a point-to-point channel, which is
+       shared by all message handles with the same peers, tag and size
+     */
+    struct channel_t {
+      std::string name;
+      segment_t *segment;      /** the communicator, which is reset when it is destroyed */
+      int src;                 /** rank of the sender */
+      int dst;                 /** rank of the receiver */
+      channel_header_t *header;
+      char *data;              /** the message slots */
+      size_t bytes;            /** size of each message */
+      size_t stride;           /** distance between the message slots */
+      size_t map_bytes;        /** size of the mapping */
+      int count;               /** number of message handles using this channel */
+      uint32_t produced;       /** messages written by this process */
+      uint32_t consumed;       /** messages read by this process */
+      std::deque<MsgHandle *> sends; /** started sends that are waiting for a free slot */
+      std::deque<MsgHandle *> recvs; /** posted receives that are waiting for their message */
+    };
+
+    struct config_t {
+      int rank = 0;
+      int size = 1;
+      std::string job;
+      int spin = 4096; /** number of polls before sleeping */
+    };
+
+    static const config_t &config()
+    {
+      static bool init = false;
+      static config_t config;
+
+      if (!init) {
+        char *rank_env = getenv("QUDA_SHM_RANK");
+        char *size_env = getenv("QUDA_SHM_SIZE");
+        char *job_env = getenv("QUDA_SHM_JOB");
+        char *spin_env = getenv("QUDA_SHM_SPIN");
+        if (rank_env) config.rank = atoi(rank_env);
+        if (size_env) config.size = atoi(size_env);
+        config.job = job_env ? job_env : std::to_string(getpid());
+        if (spin_env) config.spin = atoi(spin_env);
+        init = true;
+
+        if (config.size < 1 || config.rank < 0 || config.rank >= config.size)
+          errorQuda("Invalid QUDA_SHM_RANK=%d and QUDA_SHM_SIZE=%d", config.rank, config.size);
+        if (config.job.empty() || config.job.find('/') != std::string::npos)
+          errorQuda("Invalid QUDA_SHM_JOB=%s", config.job.c_str());
+      }
+      return config;
+    }
+
+    /** the control block of the default communicator, which carries the abort flag */
+    static control_t *world = nullptr;
+
+    /** the open channels by name */
+    static std::map<std::string, channel_t *> channels;
+
+    /** all open channels, including those of communicators that have been destroyed */
+    static std::set<channel_t *> open_channels;
+
+    static void check_abort()
+    {
+      if (world && world->abort.load()) exit(world->status);
+    }
+
+    static void futex_wait(std::atomic<uint32_t> &word, uint32_t value)
+    {
+#ifdef __linux__
+      // time out regularly, such that we make progress on the other channels and notice an abort
+      timespec timeout = {0, 1000000};
+      syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT, value, &timeout, nullptr, 0);
+#else
+      (void)word;
+      (void)value;
+      sched_yield();
+#endif
+    }
+
+    static void futex_wake(std::atomic<uint32_t> &word)
+    {
+#ifdef __linux__
+      syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#else
+      (void)word;
+#endif
+    }
+
+    /**
+       @brief Wait until a counter changes from a value, polling
+       before sleeping on its futex, or until a timeout expires
+       @param[in] word The counter
+       @param[in] value The value to wait on
+       @param[in] waiters The number of processes sleeping on the counter
+     */
+    static void wait(std::atomic<uint32_t> &word, uint32_t value, std::atomic<uint32_t> &waiters)
+    {
+      for (int i = 0; i < config().spin; i++)
+        if (word.load(std::memory_order_acquire) != value) return;
+      check_abort();
+      waiters.fetch_add(1);
+      if (word.load() == value) futex_wait(word, value);
+      waiters.fetch_sub(1);
+    }
+
+    /**
+       @brief Wake the processes sleeping on a counter, which must be
+       called after the counter is updated
+     */
+    static void notify(std::atomic<uint32_t> &word, std::atomic<uint32_t> &waiters)
+    {
+      if (waiters.load() > 0) futex_wake(word);
+    }
+
+    /**
+       @brief Map a shared-memory object, creating it if it does not
+       exist, in which case it is zero initialized
+     */
+    static void *map_object(const std::string &name, size_t bytes)
+    {
+      int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+      if (fd < 0) errorQuda("shm_open of %s failed: %s", name.c_str(), strerror(errno));
+      if (ftruncate(fd, bytes) != 0) errorQuda("ftruncate of %s failed: %s", name.c_str(), strerror(errno));
+      void *ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      close(fd);
+      if (ptr == MAP_FAILED) errorQuda("mmap of %s failed: %s", name.c_str(), strerror(errno));
+      return ptr;
+    }
+
+    static void barrier(segment_t &segment, int size)
+    {
+      auto &control = *segment.control;
+      const uint32_t generation = control.generation.load(std::memory_order_acquire);
+      if (control.arrived.fetch_add(1) + 1 == static_cast<uint32_t>(size)) {
+        control.arrived.store(0);
+        control.generation.fetch_add(1);
+        notify(control.generation, control.waiters);
+      } else {
+        while (control.generation.load(std::memory_order_acquire) == generation)
+          wait(control.generation, generation, control.waiters);
+      }
+    }
+
+    /**
+       @brief Attach to the segment of a communicator, which all of
+       its ranks must call
+     */
+    static segment_t *attach(const std::string &name, int rank, int size)
+    {
+      auto *segment = new segment_t;
+      segment->name = name;
+      segment->bytes = sizeof(control_t) + size * (sizeof(bell_t) + slot_bytes);
+      char *base = static_cast<char *>(map_object(name, segment->bytes));
+      segment->control = reinterpret_cast<control_t *>(base);
+      segment->bells = reinterpret_cast<bell_t *>(base + sizeof(control_t));
+      segment->slots = base + sizeof(control_t) + size * sizeof(bell_t);
+
+      barrier(*segment, size);
+      // once all ranks are attached the name is no longer needed
+      if (rank == 0) shm_unlink(name.c_str());
+      return segment;
+    }
+
+    static void detach(segment_t *segment, int size)
+    {
+      barrier(*segment, size);
+
+      for (auto channel : open_channels)
+        if (channel->segment == segment) channel->segment = nullptr;
+
+      // remove the names of the channels, and prevent their reuse by later communicators of the same name
+      for (auto &name : segment->channels) {
+        shm_unlink(name.c_str());
+        channels.erase(name);
+      }
+      barrier(*segment, size);
+
+      if (world == segment->control) world = nullptr;
+      munmap(segment->control, segment->bytes);
+      delete segment;
+    }
+
+    /**
+       @brief Gather an equal number of bytes from every rank, staged
+       through the slots in chunks
+     */
+    static void allgather(segment_t &segment, int rank, int size, const void *send, void *recv, size_t bytes)
+    {
+      for (size_t offset = 0; offset < bytes; offset += slot_bytes) {
+        const size_t chunk = std::min(slot_bytes, bytes - offset);
+        memcpy(segment.slots + rank * slot_bytes, static_cast<const char *>(send) + offset, chunk);
+        barrier(segment, size);
+        for (int r = 0; r < size; r++)
+          memcpy(static_cast<char *>(recv) + r * bytes + offset, segment.slots + r * slot_bytes, chunk);
+        barrier(segment, size);
+      }
+    }
+
+    static void broadcast(segment_t &segment, int rank, int size, void *data, size_t bytes)
+    {
+      for (size_t offset = 0; offset < bytes; offset += slot_bytes) {
+        const size_t chunk = std::min(slot_bytes, bytes - offset);
+        if (rank == 0) memcpy(segment.slots, static_cast<char *>(data) + offset, chunk);
+        barrier(segment, size);
+        if (rank != 0) memcpy(static_cast<char *>(data) + offset, segment.slots, chunk);
+        barrier(segment, size);
+      }
+    }
+
+    static channel_t *open_channel(segment_t &segment, int src, int dst, int tag, size_t bytes)
+    {
+      const std::string name = segment.name + "_" + std::to_string(src) + "_" + std::to_string(dst) + "_"
+        + std::to_string(tag) + "_" + std::to_string(bytes);
+      segment.channels.insert(name);
+
+      auto it = channels.find(name);
+      if (it != channels.end()) {
+        it->second->count++;
+        return it->second;
+      }
+
+      auto *channel = new channel_t;
+      channel->name = name;
+      channel->segment = &segment;
+      channel->src = src;
+      channel->dst = dst;
+      channel->bytes = bytes;
+      channel->stride = (bytes + align - 1) / align * align;
+      channel->map_bytes = sizeof(channel_header_t) + depth * channel->stride;
+      char *base = static_cast<char *>(map_object(name, channel->map_bytes));
+      channel->header = reinterpret_cast<channel_header_t *>(base);
+      channel->data = base + sizeof(channel_header_t);
+      channel->count = 1;
+      // the channel may have been used by earlier handles of this process
+      channel->produced = channel->header->produced.load();
+      channel->consumed = channel->header->consumed.load();
+
+      channels[name] = channel;
+      open_channels.insert(channel);
+      return channel;
+    }
+
+    static void close_channel(channel_t *channel)
+    {
+      if (--channel->count > 0) return;
+      auto it = channels.find(channel->name);
+      if (it != channels.end() && it->second == channel) channels.erase(it);
+      open_channels.erase(channel);
+      munmap(channel->header, channel->map_bytes);
+      delete channel;
+    }
+
+  } // namespace shm
+
+  struct MsgHandle_s {
+    /**
+       The channel to or from the peer
+     */
+    shm::channel_t *channel;
+
+    /**
+       Whether this is a send, else a receive
+     */
+    bool send;
+
+    /**
+       The user buffer, which is accessed in nblocks blocks of blksize
+       bytes, separated by stride bytes
+     */
+    char *buffer;
+    size_t blksize;
+    int nblocks;
+    size_t stride;
+
+    /**
+       Whether the message has been started and not yet completed
+     */
+    bool active;
+
+    /**
+       The sequence number of the message on its channel
+     */
+    uint32_t seq;
+  };
+
+  struct MsgPlan_s {
+    /**
+       The message handles of the set
+     */
+    std::vector<MsgHandle *> mh;
+
+    /**
+       Whether each message has completed since the set was started
+     */
+    std::vector<int> complete;
+  };
+
+  namespace shm
+  {
+
+    /**
+       @brief Notify a rank of progress on one of its channels
+     */
+    static void ring(channel_t &channel, int rank)
+    {
+      if (!channel.segment) return;
+      auto &bell = channel.segment->bells[rank];
+      bell.count.fetch_add(1);
+      notify(bell.count, bell.waiters);
+    }
+
+    /**
+       @brief Whether a message has been copied to or from its channel
+     */
+    static bool complete(const MsgHandle *mh)
+    {
+      const uint32_t done = mh->send ? mh->channel->produced : mh->channel->consumed;
+      return static_cast<int32_t>(done - mh->seq) > 0;
+    }
+
+    /**
+       @brief Copy the started sends into the free slots of a channel,
+       and the available messages into the posted receives, in order
+     */
+    static void progress(channel_t &channel)
+    {
+      auto &header = *channel.header;
+
+      while (!channel.sends.empty()) {
+        if (channel.produced - header.consumed.load(std::memory_order_acquire) >= depth) break;
+        MsgHandle *mh = channel.sends.front();
+        char *slot = channel.data + (channel.produced % depth) * channel.stride;
+        for (int b = 0; b < mh->nblocks; b++) memcpy(slot + b * mh->blksize, mh->buffer + b * mh->stride, mh->blksize);
+        header.produced.store(++channel.produced, std::memory_order_release);
+        ring(channel, channel.dst);
+        channel.sends.pop_front();
+      }
+
+      while (!channel.recvs.empty()) {
+        if (header.produced.load(std::memory_order_acquire) == channel.consumed) break;
+        MsgHandle *mh = channel.recvs.front();
+        const char *slot = channel.data + (channel.consumed % depth) * channel.stride;
+        for (int b = 0; b < mh->nblocks; b++) memcpy(mh->buffer + b * mh->stride, slot + b * mh->blksize, mh->blksize);
+        header.consumed.store(++channel.consumed, std::memory_order_release);
+        ring(channel, channel.src);
+        channel.recvs.pop_front();
+      }
+    }
+
+    /**
+       @brief Make progress on all channels of this process, such
+       that sends that are waiting for a free slot cannot deadlock
+       with receives from the same peer
+     */
+    static void progress_all()
+    {
+      for (auto channel : open_channels)
+        if (!channel->sends.empty() || !channel->recvs.empty()) progress(*channel);
+    }
+
+    static MsgHandle *declare(segment_t &segment, bool send, void *buffer, int src, int dst, int tag, size_t blksize,
+                              int nblocks, size_t stride)
+    {
+      MsgHandle *mh = (MsgHandle *)safe_malloc(sizeof(MsgHandle));
+      mh->channel = open_channel(segment, src, dst, tag, blksize * nblocks);
+      mh->send = send;
+      mh->buffer = static_cast<char *>(buffer);
+      mh->blksize = blksize;
+      mh->nblocks = nblocks;
+      mh->stride = stride;
+      mh->active = false;
+      mh->seq = 0;
+      return mh;
+    }
+
+    /**
+       @brief The tag of a message to a displaced rank, which matches
+       that of the MPI backend
+     */
+    static int tag_displaced(const int displacement[], int ndim, bool send)
+    {
+      int tag = 0;
+      for (int i = ndim - 1; i >= 0; i--)
+        tag = tag * 4 * max_displacement + (send ? displacement[i] : -displacement[i]) + max_displacement;
+      return tag >= 0 ? tag : 2 * pow(4 * max_displacement, ndim) + tag;
+    }
+
+  } // namespace shm
+
+  Communicator::Communicator(int nDim, const int *commDims, QudaCommsMap rank_from_coords, void *map_data, bool, void *)
+  {
+    user_set_comm_handle = false;
+
+    rank = shm::config().rank;
+    size = shm::config().size;
+    shm_segment = shm::attach("/quda_shm_" + shm::config().job, rank, size);
+    shm::world = shm_segment->control;
+
+    comm_init(nDim, commDims, rank_from_coords, map_data);
+    globalReduce.push(true);
+  }
+
+  Communicator::Communicator(Communicator &other, const int *comm_split) : globalReduce(other.globalReduce)
+  {
+    user_set_comm_handle = false;
+
+    constexpr int nDim = 4;
+
+    CommKey comm_dims_split;
+    CommKey comm_key_split;
+    CommKey comm_color_split;
+
+    for (int d = 0; d < nDim; d++) {
+      assert(other.comm_dim(d) % comm_split[d] == 0);
+      comm_dims_split[d] = other.comm_dim(d) / comm_split[d];
+      comm_key_split[d] = other.comm_coord(d) % comm_dims_split[d];
+      comm_color_split[d] = other.comm_coord(d) / comm_dims_split[d];
+    }
+
+    int key = index(nDim, comm_dims_split.data(), comm_key_split.data());
+    int color = index(nDim, comm_split, comm_color_split.data());
+
+    // the ranks of each color attach to a segment of their own, with the rank given by the key
+    rank = key;
+    size = comm_dims_split[0] * comm_dims_split[1] * comm_dims_split[2] * comm_dims_split[3];
+    std::string name = other.shm_segment->name + "_s";
+    for (int d = 0; d < nDim; d++) name += std::to_string(comm_split[d]) + (d < nDim - 1 ? "x" : "");
+    shm_segment = shm::attach(name + "_c" + std::to_string(color), rank, size);
+
+    QudaCommsMap func = lex_rank_from_coords_dim_t;
+    comm_init(nDim, comm_dims_split.data(), func, comm_dims_split.data());
+  }
+
+  Communicator::~Communicator()
+  {
+    comm_finalize();
+    if (shm_segment) shm::detach(shm_segment, size);
+    shm_segment = nullptr;
+  }
+
+  void Communicator::comm_gather_hostname(char *hostname_recv_buf)
+  {
+    shm::allgather(*shm_segment, rank, size, comm_hostname(), hostname_recv_buf, QUDA_MAX_HOSTNAME_STRING);
+  }
+
+  void Communicator::comm_gather_gpuid(int *gpuid_recv_buf)
+  {
+    int gpuid = comm_gpuid();
+    shm::allgather(*shm_segment, rank, size, &gpuid, gpuid_recv_buf, sizeof(int));
+  }
+
+  void Communicator::comm_init(int ndim, const int *dims, QudaCommsMap rank_from_coords, void *map_data)
+  {
+    int grid_size = 1;
+    for (int i = 0; i < ndim; i++) { grid_size *= dims[i]; }
+    if (grid_size != size) {
+      errorQuda("Communication grid size declared via initCommsGridQuda() does not match"
+                " total number of shared-memory ranks (%d != %d)",
+                grid_size, size);
+    }
+
+    comm_init_common(ndim, dims, rank_from_coords, map_data);
+  }
+
+  int Communicator::comm_rank(void) { return rank; }
+
+  size_t Communicator::comm_size(void) { return size; }
+
+  /**
+   * Declare a message handle for sending `nbytes` to the `rank` with `tag`.
+   */
+  MsgHandle *Communicator::comm_declare_send_rank(void *buffer, int rank, int tag, size_t nbytes)
+  {
+    return shm::declare(*shm_segment, true, buffer, comm_rank(), rank, tag, nbytes, 1, 0);
+  }
+
+  /**
+   * Declare a message handle for receiving `nbytes` from the `rank` with `tag`.
+   */
+  MsgHandle *Communicator::comm_declare_recv_rank(void *buffer, int rank, int tag, size_t nbytes)
+  {
+    return shm::declare(*shm_segment, false, buffer, rank, comm_rank(), tag, nbytes, 1, 0);
+  }
+
+  /**
+   * Declare a message handle for sending to a node displaced in (x,y,z,t) according to "displacement"
+   */
+  MsgHandle *Communicator::comm_declare_send_displaced(void *buffer, const int displacement[], size_t nbytes)
+  {
+    Topology *topo = comm_default_topology();
+    int ndim = comm_ndim(topo);
+    check_displacement(displacement, ndim);
+
+    int rank = comm_rank_displaced(topo, displacement);
+    int tag = shm::tag_displaced(displacement, ndim, true);
+
+    return shm::declare(*shm_segment, true, buffer, comm_rank(), rank, tag, nbytes, 1, 0);
+  }
+
+  /**
+   * Declare a message handle for receiving from a node displaced in (x,y,z,t) according to "displacement"
+   */
+  MsgHandle *Communicator::comm_declare_receive_displaced(void *buffer, const int displacement[], size_t nbytes)
+  {
+    Topology *topo = comm_default_topology();
+    int ndim = comm_ndim(topo);
+    check_displacement(displacement, ndim);
+
+    int rank = comm_rank_displaced(topo, displacement);
+    int tag = shm::tag_displaced(displacement, ndim, false);
+
+    return shm::declare(*shm_segment, false, buffer, rank, comm_rank(), tag, nbytes, 1, 0);
+  }
+
+  /**
+   * Declare a message handle for sending to a node displaced in (x,y,z,t) according to "displacement"
+   */
+  MsgHandle *Communicator::comm_declare_strided_send_displaced(void *buffer, const int displacement[], size_t blksize,
+                                                               int nblocks, size_t stride)
+  {
+    Topology *topo = comm_default_topology();
+    int ndim = comm_ndim(topo);
+    check_displacement(displacement, ndim);
+
+    int rank = comm_rank_displaced(topo, displacement);
+    int tag = shm::tag_displaced(displacement, ndim, true);
+
+    return shm::declare(*shm_segment, true, buffer, comm_rank(), rank, tag, blksize, nblocks, stride);
+  }
+
+  /**
+   * Declare a message handle for receiving from a node displaced in (x,y,z,t) according to "displacement"
+   */
+  MsgHandle *Communicator::comm_declare_strided_receive_displaced(void *buffer, const int displacement[],
+                                                                  size_t blksize, int nblocks, size_t stride)
+  {
+    Topology *topo = comm_default_topology();
+    int ndim = comm_ndim(topo);
+    check_displacement(displacement, ndim);
+
+    int rank = comm_rank_displaced(topo, displacement);
+    int tag = shm::tag_displaced(displacement, ndim, false);
+
+    return shm::declare(*shm_segment, false, buffer, rank, comm_rank(), tag, blksize, nblocks, stride);
+  }
+
+  void Communicator::comm_free(MsgHandle *&mh)
+  {
+    comm_wait(mh); // as with a persistent request, an active message is completed first
+    shm::close_channel(mh->channel);
+    host_free(mh);
+    mh = nullptr;
+  }
+
+  void Communicator::comm_start(MsgHandle *mh)
+  {
+    auto &channel = *mh->channel;
+    if (mh->active && !shm::complete(mh)) errorQuda("Message on channel %s started while active", channel.name.c_str());
+
+    // the message is copied into the channel as soon as there is a free slot
+    if (mh->send) {
+      mh->seq = channel.produced + channel.sends.size();
+      channel.sends.push_back(mh);
+    } else {
+      mh->seq = channel.consumed + channel.recvs.size();
+      channel.recvs.push_back(mh);
+    }
+    mh->active = true;
+    shm::progress(channel);
+  }
+
+  void Communicator::comm_wait(MsgHandle *mh)
+  {
+    if (!mh->active) return;
+    auto &channel = *mh->channel;
+    if (!channel.segment) errorQuda("Message on channel %s outlived its communicator", channel.name.c_str());
+    auto &bell = channel.segment->bells[mh->send ? channel.src : channel.dst];
+
+    while (true) {
+      const uint32_t value = bell.count.load(std::memory_order_acquire);
+      shm::progress_all();
+      if (shm::complete(mh)) break;
+      shm::wait(bell.count, value, bell.waiters);
+    }
+    mh->active = false;
+  }
+
+  int Communicator::comm_query(MsgHandle *mh)
+  {
+    if (!mh->active) return 1;
+    shm::progress_all();
+    if (!shm::complete(mh)) return 0;
+    mh->active = false;
+    return 1;
+  }
+
+  MsgPlan *Communicator::comm_declare_plan(MsgHandle *const *mh, int n)
+  {
+    auto *plan = new MsgPlan;
+    plan->mh.assign(mh, mh + n);
+    plan->complete.resize(n, 1);
+    return plan;
+  }
+
+  void Communicator::comm_free_plan(MsgPlan *&plan)
+  {
+    delete plan;
+    plan = nullptr;
+  }
+
+  void Communicator::comm_start_plan(MsgPlan *plan)
+  {
+    for (auto mh : plan->mh) comm_start(mh);
+    std::fill(plan->complete.begin(), plan->complete.end(), 0);
+  }
+
+  void Communicator::comm_wait_plan(MsgPlan *plan)
+  {
+    for (auto mh : plan->mh) comm_wait(mh);
+    std::fill(plan->complete.begin(), plan->complete.end(), 1);
+  }
+
+  int Communicator::comm_query_plan(MsgPlan *plan, int i)
+  {
+    if (!plan->complete[i]) {
+      // a single pass of progress over the channels serves all messages of the set
+      shm::progress_all();
+      for (size_t j = 0; j < plan->mh.size(); j++) {
+        auto mh = plan->mh[j];
+        if (!plan->complete[j] && (!mh->active || shm::complete(mh))) {
+          mh->active = false;
+          plan->complete[j] = 1;
+        }
+      }
+    }
+    return plan->complete[i];
+  }
+
+  void Communicator::comm_allreduce_sum_array(double *data, size_t size)
+  {
+    // every rank reduces the gathered contributions in the same order, so all obtain identical sums
+    size_t n = comm_size();
+    std::vector<double> recv_buf(size * n);
+    shm::allgather(*shm_segment, rank, n, data, recv_buf.data(), size * sizeof(double));
+
+    if (!comm_deterministic_reduce()) {
+      for (size_t i = 0; i < size; i++) {
+        data[i] = recv_buf[i];
+        for (size_t j = 1; j < n; j++) data[i] += recv_buf[j * size + i];
+      }
+    } else {
+      std::vector<double> recv_trans(size * n);
+      for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < size; j++) { recv_trans[j * n + i] = recv_buf[i * size + j]; }
+      }
+
+      for (size_t i = 0; i < size; i++) { data[i] = deterministic_reduce(recv_trans.data() + i * n, n); }
+    }
+  }
+
+  // the collectives are staged through the segment by all ranks together, so the reduction is completed here
+  void Communicator::comm_allreduce_sum_start(double *data, size_t size) { comm_allreduce_sum_array(data, size); }
+
+  void Communicator::comm_allreduce_sum_wait() { }
+
+  void Communicator::comm_allreduce_max_array(deviation_t<double> *data, size_t size)
+  {
+    size_t n = comm_size();
+    std::vector<deviation_t<double>> recv_buf(size * n);
+    shm::allgather(*shm_segment, rank, n, data, recv_buf.data(), size * sizeof(deviation_t<double>));
+
+    for (size_t i = 0; i < size; i++) {
+      data[i] = recv_buf[i];
+      for (size_t j = 1; j < n; j++) { data[i] = data[i] > recv_buf[j * size + i] ? data[i] : recv_buf[j * size + i]; }
+    }
+  }
+
+  void Communicator::comm_allreduce_max_array(double *data, size_t size)
+  {
+    size_t n = comm_size();
+    std::vector<double> recv_buf(size * n);
+    shm::allgather(*shm_segment, rank, n, data, recv_buf.data(), size * sizeof(double));
+
+    for (size_t i = 0; i < size; i++) {
+      for (size_t j = 0; j < n; j++) data[i] = std::max(data[i], recv_buf[j * size + i]);
+    }
+  }
+
+  void Communicator::comm_allreduce_min_array(double *data, size_t size)
+  {
+    size_t n = comm_size();
+    std::vector<double> recv_buf(size * n);
+    shm::allgather(*shm_segment, rank, n, data, recv_buf.data(), size * sizeof(double));
+
+    for (size_t i = 0; i < size; i++) {
+      for (size_t j = 0; j < n; j++) data[i] = std::min(data[i], recv_buf[j * size + i]);
+    }
+  }
+
+  void Communicator::comm_allreduce_int(int &data)
+  {
+    std::vector<int> recv_buf(comm_size());
+    shm::allgather(*shm_segment, rank, size, &data, recv_buf.data(), sizeof(int));
+    data = std::accumulate(recv_buf.begin(), recv_buf.end(), 0);
+  }
+
+  void Communicator::comm_allreduce_xor(uint64_t &data)
+  {
+    std::vector<uint64_t> recv_buf(comm_size());
+    shm::allgather(*shm_segment, rank, size, &data, recv_buf.data(), sizeof(uint64_t));
+    data = 0;
+    for (auto x : recv_buf) data ^= x;
+  }
+
+  /**  broadcast from rank 0 */
+  void Communicator::comm_broadcast(void *data, size_t nbytes) { shm::broadcast(*shm_segment, rank, size, data, nbytes); }
+
+  void Communicator::comm_barrier(void) { shm::barrier(*shm_segment, size); }
+
+  void Communicator::comm_abort_(int status)
+  {
+    // the other ranks notice the abort when they next wait
+    if (shm::world) {
+      shm::world->status = status;
+      shm::world->abort.store(1);
+    }
+    exit(status);
+  }
+
+  int Communicator::comm_rank_global() { return shm::config().rank; }
+
+} // namespace quda
@@ -81,8 +81,22 @@ namespace quda
 
   int Communicator::comm_query(MsgHandle *) { return 1; }
 
+  MsgPlan *Communicator::comm_declare_plan(MsgHandle *const *, int) { return nullptr; }
+
+  void Communicator::comm_free_plan(MsgPlan *&) { }
+
+  void Communicator::comm_start_plan(MsgPlan *) { }
+
+  void Communicator::comm_wait_plan(MsgPlan *) { }
+
+  int Communicator::comm_query_plan(MsgPlan *, int) { return 1; }
+
   void Communicator::comm_allreduce_sum_array(double *, size_t) { }
 
+  void Communicator::comm_allreduce_sum_start(double *, size_t) { }
+
+  void Communicator::comm_allreduce_sum_wait() { }
+
   void Communicator::comm_allreduce_max_array(deviation_t<double> *, size_t) { }
 
   void Communicator::comm_allreduce_max_array(double *, size_t) { }
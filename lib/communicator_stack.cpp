@@ -2,6 +2,7 @@
 #include <map>
 #include <array.h>
 #include <lattice_field.h>
+#include <timeline.h>
 
 namespace quda
 {
@@ -171,19 +172,73 @@ namespace quda
 
   void comm_free(MsgHandle *&mh) { CHECK_MH(mh); get_current_communicator().comm_free(mh); }
 
-  void comm_start(MsgHandle *mh) { CHECK_MH(mh); get_current_communicator().comm_start(mh); }
+  void comm_start(MsgHandle *mh)
+  {
+    CHECK_MH(mh);
+    const double start = timeline::enabled() ? timeline::now() : 0.0;
+    get_current_communicator().comm_start(mh);
+    if (timeline::enabled()) timeline::record("comm_start", "comms", start, timeline::now() - start);
+  }
 
-  void comm_wait(MsgHandle *mh) { CHECK_MH(mh); get_current_communicator().comm_wait(mh); }
+  void comm_wait(MsgHandle *mh)
+  {
+    CHECK_MH(mh);
+    const double start = timeline::enabled() ? timeline::now() : 0.0;
+    get_current_communicator().comm_wait(mh);
+    if (timeline::enabled()) timeline::record("comm_wait", "comms", start, timeline::now() - start);
+  }
 
   int comm_query(MsgHandle *mh) { CHECK_MH(mh); return get_current_communicator().comm_query(mh); }
 
+  MsgPlan *comm_declare_plan(MsgHandle *const *mh, int n)
+  {
+    for (int i = 0; i < n; i++) CHECK_MH(mh[i]);
+    return get_current_communicator().comm_declare_plan(mh, n);
+  }
+
 #undef CHECK_MH
 
+#define CHECK_PLAN(plan) { if (plan == nullptr) errorQuda("null message plan"); }
+
+  void comm_free_plan(MsgPlan *&plan) { CHECK_PLAN(plan); get_current_communicator().comm_free_plan(plan); }
+
+  void comm_start_plan(MsgPlan *plan)
+  {
+    CHECK_PLAN(plan);
+    const double start = timeline::enabled() ? timeline::now() : 0.0;
+    get_current_communicator().comm_start_plan(plan);
+    if (timeline::enabled()) timeline::record("comm_start_plan", "comms", start, timeline::now() - start);
+  }
+
+  void comm_wait_plan(MsgPlan *plan)
+  {
+    CHECK_PLAN(plan);
+    const double start = timeline::enabled() ? timeline::now() : 0.0;
+    get_current_communicator().comm_wait_plan(plan);
+    if (timeline::enabled()) timeline::record("comm_wait_plan", "comms", start, timeline::now() - start);
+  }
+
+  int comm_query_plan(MsgPlan *plan, int i) { CHECK_PLAN(plan); return get_current_communicator().comm_query_plan(plan, i); }
+
+#undef CHECK_PLAN
+
   void comm_allreduce_sum_array(double *data, size_t size)
   {
     get_current_communicator().comm_allreduce_sum_array(data, size);
   }
 
+  void comm_allreduce_sum_start(double *data, size_t size)
+  {
+    get_current_communicator().comm_allreduce_sum_start(data, size);
+  }
+
+  void comm_allreduce_sum_wait()
+  {
+    const double start = timeline::enabled() ? timeline::now() : 0.0;
+    get_current_communicator().comm_allreduce_sum_wait();
+    if (timeline::enabled()) timeline::record("comm_allreduce_sum_wait", "comms", start, timeline::now() - start);
+  }
+
   template <> void comm_allreduce_sum<std::vector<double>>(std::vector<double> &a)
   {
     comm_allreduce_sum_array(a.data(), a.size());
@@ -284,6 +339,13 @@ namespace quda
 
   void comm_broadcast_global(void *data, size_t nbytes) { get_default_communicator().comm_broadcast(data, nbytes); }
 
+  size_t comm_size_global() { return get_default_communicator().comm_size(); }
+
+  void comm_allreduce_min_array_global(double *data, size_t size)
+  {
+    get_default_communicator().comm_allreduce_min_array(data, size);
+  }
+
   void comm_barrier(void) { get_current_communicator().comm_barrier(); }
 
   void comm_abort_(int status) { Communicator::comm_abort_(status); };
@@ -1,6 +1,7 @@
 #include <quda_internal.h>
 #include <timer.h>
 #include <gauge_field.h>
+#include <alloc_trace.h>
 #include <assert.h>
 #include <string.h>
 #include <typeinfo>
@@ -10,6 +11,8 @@ namespace quda {
   cpuGaugeField::cpuGaugeField(const GaugeFieldParam &param) :
     GaugeField(param)
   {
+    alloc_trace::category_scope category("gauge");
+
     if (precision == QUDA_HALF_PRECISION) {
       errorQuda("CPU fields do not support half precision");
     }
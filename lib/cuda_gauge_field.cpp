@@ -4,12 +4,15 @@
 #include <timer.h>
 #include <blas_quda.h>
 #include <device.h>
+#include <alloc_trace.h>
 
 namespace quda {
 
   cudaGaugeField::cudaGaugeField(const GaugeFieldParam &param) :
     GaugeField(param), gauge(0), even(0), odd(0)
   {
+    alloc_trace::category_scope category("gauge");
+
     if ((order == QUDA_QDP_GAUGE_ORDER || order == QUDA_QDPJIT_GAUGE_ORDER) &&
         create != QUDA_REFERENCE_FIELD_CREATE) {
       errorQuda("QDP ordering only supported for reference fields");
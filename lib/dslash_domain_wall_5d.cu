@@ -15,7 +15,7 @@ namespace quda
 
   template <typename Arg> class DomainWall5D : public Dslash<domainWall5D, Arg>
   {
-    using Dslash = Dslash<domainWall5D, Arg>;
+    using Dslash = quda::Dslash<domainWall5D, Arg>;
     using Dslash::arg;
     using Dslash::in;
 
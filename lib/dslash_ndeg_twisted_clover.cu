@@ -17,7 +17,7 @@ namespace quda
 
   template <typename Arg> class NdegTwistedClover : public Dslash<nDegTwistedClover, Arg>
     {
-      using Dslash = Dslash<nDegTwistedClover, Arg>;
+      using Dslash = quda::Dslash<nDegTwistedClover, Arg>;
       using Dslash::arg;
       using Dslash::in;
 
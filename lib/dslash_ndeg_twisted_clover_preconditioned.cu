@@ -16,7 +16,7 @@ namespace quda
 {
   template <typename Arg> class NdegTwistedCloverPreconditioned : public Dslash<nDegTwistedCloverPreconditioned, Arg>
     {
-      using Dslash = Dslash<nDegTwistedCloverPreconditioned, Arg>;
+      using Dslash = quda::Dslash<nDegTwistedCloverPreconditioned, Arg>;
       using Dslash::arg;
       using Dslash::in;
 
@@ -28,7 +28,6 @@ namespace quda
     extern bool dslash_exterior_compute;
     extern bool dslash_comms;
     extern bool dslash_copy;
-    static ColorSpinorField *inSpinor;
 
     /**
      * Arrays used for the dynamic scheduling.
@@ -123,12 +122,8 @@ namespace quda
   template <typename Dslash>
   inline void issueRecv(ColorSpinorField &input, const Dslash &dslash, bool gdr)
   {
-    for(int i=3; i>=0; i--){
-      if (!dslash.dslashParam.commDim[i]) continue;
-      for(int dir=1; dir>=0; dir--) {
-        PROFILE(if (dslash_comms) input.recvStart(2*i+dir, device::get_stream(2*i+dir), gdr), profile, QUDA_PROFILE_COMMS_START);
-      }
-    }
+    // all receives are posted together as a single persistent message set
+    PROFILE(if (dslash_comms) input.recvStartAll(dslash.dslashParam.commDim, gdr), profile, QUDA_PROFILE_COMMS_START);
   }
 
   /**
@@ -437,6 +432,31 @@ namespace quda
     }
   };
 
+  /**
+     Host dslash for fields resident in CPU memory.  There is no halo
+     exchange, so this is only valid when no dimension is
+     partitioned, and the interior kernel is applied by the tiled
+     multi-threaded host engine (see dslash_host.h).
+  */
+  template <typename Dslash> struct DslashHost : DslashPolicyImp<Dslash> {
+
+    void operator()(Dslash &dslash, ColorSpinorField *in, const int volume, const int *, TimeProfile &profile)
+    {
+      profile.TPSTART(QUDA_PROFILE_TOTAL);
+      if (in->Location() != QUDA_CPU_FIELD_LOCATION) errorQuda("Host dslash policy requires host fields");
+
+      auto &dslashParam = dslash.dslashParam;
+      dslashParam.kernel_type = INTERIOR_KERNEL;
+      dslashParam.threads = volume;
+      dslash.setShmem(0);
+
+      PROFILE(if (dslash_interior_compute) dslash.apply(device::get_default_stream()), profile, QUDA_PROFILE_DSLASH_KERNEL);
+      if (aux_worker) aux_worker->apply(device::get_default_stream());
+
+      profile.TPSTOP(QUDA_PROFILE_TOTAL);
+    }
+  };
+
   /**
      Generic shmem dslash
       // shmem bitfield encodes
@@ -943,20 +963,21 @@ namespace quda
         }
       }
 
-      for (int p2p = 0; p2p < 2; p2p++) { // schedule non-p2p traffic first, then do p2p
-        for (int i = 3; i >= 0; i--) {
-          if (!dslashParam.commDim[i]) continue;
+      // the non-p2p sends are started together as a single persistent message set
+      PROFILE(if (dslash_comms) in->sendStartAll(dslashParam.commDim, false), profile, QUDA_PROFILE_COMMS_START);
 
-          for (int dir = 1; dir >= 0; dir--) {
-            if ((comm_peer2peer_enabled(dir, i) + p2p) % 2 == 0) {
-              PROFILE(if (dslash_comms) in->sendStart(2 * i + dir,
-                                                      device::get_stream(dslashParam.remote_write ? packIndex : 2 * i + dir),
-                                                      false, dslashParam.remote_write),
-                  profile, QUDA_PROFILE_COMMS_START);
-            } // is p2p?
-          }   // dir
-        }     // i
-      }       // p2p
+      for (int i = 3; i >= 0; i--) { // p2p sends are tied to a stream so are started individually
+        if (!dslashParam.commDim[i]) continue;
+
+        for (int dir = 1; dir >= 0; dir--) {
+          if (comm_peer2peer_enabled(dir, i)) {
+            PROFILE(if (dslash_comms) in->sendStart(2 * i + dir,
+                                                    device::get_stream(dslashParam.remote_write ? packIndex : 2 * i + dir),
+                                                    false, dslashParam.remote_write),
+                profile, QUDA_PROFILE_COMMS_START);
+          } // is p2p?
+        }   // dir
+      }     // i
 
       DslashCommsPattern pattern(dslashParam.commDim, true);
       while (pattern.completeSum < pattern.commDimTotal) {
@@ -1046,21 +1067,22 @@ namespace quda
         }
       }
 
-      for (int p2p = 0; p2p < 2; p2p++) { // schedule non-p2p traffic first, then do p2p
-        for (int i = 3; i >= 0; i--) {
-          if (!dslashParam.commDim[i]) continue;
+      // the non-p2p sends are started together as a single persistent message set
+      PROFILE(if (dslash_comms) in->sendStartAll(dslashParam.commDim, false), profile, QUDA_PROFILE_COMMS_START);
 
-          for (int dir = 1; dir >= 0; dir--) {
-            if ((comm_peer2peer_enabled(dir, i) + p2p) % 2 == 0) {
-              PROFILE(
-                  if (dslash_comms) in->sendStart(2 * i + dir,
-                                                  device::get_stream(dslashParam.remote_write ? packScatterIndex : 2 * i + dir),
-                                                  false, dslashParam.remote_write),
-                  profile, QUDA_PROFILE_COMMS_START);
-            } // is p2p?
-          }   // dir
-        }     // i
-      }       // p2p
+      for (int i = 3; i >= 0; i--) { // p2p sends are tied to a stream so are started individually
+        if (!dslashParam.commDim[i]) continue;
+
+        for (int dir = 1; dir >= 0; dir--) {
+          if (comm_peer2peer_enabled(dir, i)) {
+            PROFILE(
+                if (dslash_comms) in->sendStart(2 * i + dir,
+                                                device::get_stream(dslashParam.remote_write ? packScatterIndex : 2 * i + dir),
+                                                false, dslashParam.remote_write),
+                profile, QUDA_PROFILE_COMMS_START);
+          } // is p2p?
+        }   // dir
+      }     // i
 
       DslashCommsPattern pattern(dslashParam.commDim, true);
       while (pattern.completeSum < pattern.commDimTotal) {
@@ -1142,20 +1164,21 @@ namespace quda
         }
       }
 
-      for (int p2p = 0; p2p < 2; p2p++) { // schedule non-p2p traffic first, then do p2p
-        for (int i = 3; i >= 0; i--) {
-          if (!dslashParam.commDim[i]) continue;
+      // the non-p2p sends are started together as a single persistent message set
+      PROFILE(if (dslash_comms) in->sendStartAll(dslashParam.commDim, false), profile, QUDA_PROFILE_COMMS_START);
 
-          for (int dir = 1; dir >= 0; dir--) {
-            if ((comm_peer2peer_enabled(dir, i) + p2p) % 2 == 0) {
-              PROFILE(if (dslash_comms) in->sendStart(2 * i + dir,
-                                                      device::get_stream(dslashParam.remote_write ? packIndex : 2 * i + dir),
-                                                      false, dslashParam.remote_write),
-                  profile, QUDA_PROFILE_COMMS_START);
-            } // is p2p?
-          }   // dir
-        }     // i
-      }       // p2p
+      for (int i = 3; i >= 0; i--) { // p2p sends are tied to a stream so are started individually
+        if (!dslashParam.commDim[i]) continue;
+
+        for (int dir = 1; dir >= 0; dir--) {
+          if (comm_peer2peer_enabled(dir, i)) {
+            PROFILE(if (dslash_comms) in->sendStart(2 * i + dir,
+                                                    device::get_stream(dslashParam.remote_write ? packIndex : 2 * i + dir),
+                                                    false, dslashParam.remote_write),
+                profile, QUDA_PROFILE_COMMS_START);
+          } // is p2p?
+        }   // dir
+      }     // i
 
       DslashCommsPattern pattern(dslashParam.commDim, true);
       while (pattern.completeSum < pattern.commDimTotal) {
@@ -1234,20 +1257,21 @@ namespace quda
         }
       }
 
-      for (int p2p = 0; p2p < 2; p2p++) { // schedule non-p2p traffic first, then do p2p
-        for (int i = 3; i >= 0; i--) {
-          if (!dslashParam.commDim[i]) continue;
+      // the non-p2p sends are started together as a single persistent message set
+      PROFILE(if (dslash_comms) in->sendStartAll(dslashParam.commDim, false), profile, QUDA_PROFILE_COMMS_START);
 
-          for (int dir = 1; dir >= 0; dir--) {
-            if ((comm_peer2peer_enabled(dir, i) + p2p) % 2 == 0) {
-              PROFILE(if (dslash_comms) in->sendStart(2 * i + dir,
-                                                      device::get_stream(dslashParam.remote_write ? packIndex : 2 * i + dir),
-                                                      false, dslashParam.remote_write),
-                  profile, QUDA_PROFILE_COMMS_START);
-            } // is p2p?
-          }   // dir
-        }     // i
-      }       // p2p
+      for (int i = 3; i >= 0; i--) { // p2p sends are tied to a stream so are started individually
+        if (!dslashParam.commDim[i]) continue;
+
+        for (int dir = 1; dir >= 0; dir--) {
+          if (comm_peer2peer_enabled(dir, i)) {
+            PROFILE(if (dslash_comms) in->sendStart(2 * i + dir,
+                                                    device::get_stream(dslashParam.remote_write ? packIndex : 2 * i + dir),
+                                                    false, dslashParam.remote_write),
+                profile, QUDA_PROFILE_COMMS_START);
+          } // is p2p?
+        }   // dir
+      }     // i
 
       DslashCommsPattern pattern(dslashParam.commDim, true);
       while (pattern.completeSum < pattern.commDimTotal) {
@@ -1320,20 +1344,21 @@ namespace quda
         }
       }
 
-      for (int p2p = 0; p2p < 2; p2p++) { // schedule non-p2p traffic first, then do p2p
-        for (int i = 3; i >= 0; i--) {
-          if (!dslashParam.commDim[i]) continue;
+      // the non-p2p sends are started together as a single persistent message set
+      PROFILE(if (dslash_comms) in->sendStartAll(dslashParam.commDim, false), profile, QUDA_PROFILE_COMMS_START);
 
-          for (int dir = 1; dir >= 0; dir--) {
-            if ((comm_peer2peer_enabled(dir, i) + p2p) % 2 == 0) {
-              PROFILE(if (dslash_comms) in->sendStart(2 * i + dir,
-                                                      device::get_stream(dslashParam.remote_write ? packIndex : 2 * i + dir),
-                                                      false, dslashParam.remote_write),
-                  profile, QUDA_PROFILE_COMMS_START);
-            } // is p2p?
-          }   // dir
-        }     // i
-      }       // p2p
+      for (int i = 3; i >= 0; i--) { // p2p sends are tied to a stream so are started individually
+        if (!dslashParam.commDim[i]) continue;
+
+        for (int dir = 1; dir >= 0; dir--) {
+          if (comm_peer2peer_enabled(dir, i)) {
+            PROFILE(if (dslash_comms) in->sendStart(2 * i + dir,
+                                                    device::get_stream(dslashParam.remote_write ? packIndex : 2 * i + dir),
+                                                    false, dslashParam.remote_write),
+                profile, QUDA_PROFILE_COMMS_START);
+          } // is p2p?
+        }   // dir
+      }     // i
 
       DslashCommsPattern pattern(dslashParam.commDim, true);
       while (pattern.completeSum < pattern.commDimTotal) {
@@ -1412,20 +1437,21 @@ namespace quda
         }
       }
 
-      for (int p2p = 0; p2p < 2; p2p++) { // schedule non-p2p traffic first, then do p2p
-        for (int i = 3; i >= 0; i--) {
-          if (!dslashParam.commDim[i]) continue;
+      // the non-p2p sends are started together as a single persistent message set
+      PROFILE(if (dslash_comms) in->sendStartAll(dslashParam.commDim, false), profile, QUDA_PROFILE_COMMS_START);
 
-          for (int dir = 1; dir >= 0; dir--) {
-            if ((comm_peer2peer_enabled(dir, i) + p2p) % 2 == 0) {
-              PROFILE(if (dslash_comms) in->sendStart(2 * i + dir,
-                                                      device::get_stream(dslashParam.remote_write ? packIndex : 2 * i + dir),
-                                                      false, dslashParam.remote_write),
-                  profile, QUDA_PROFILE_COMMS_START);
-            } // is p2p?
-          }   // dir
-        }     // i
-      }       // p2p
+      for (int i = 3; i >= 0; i--) { // p2p sends are tied to a stream so are started individually
+        if (!dslashParam.commDim[i]) continue;
+
+        for (int dir = 1; dir >= 0; dir--) {
+          if (comm_peer2peer_enabled(dir, i)) {
+            PROFILE(if (dslash_comms) in->sendStart(2 * i + dir,
+                                                    device::get_stream(dslashParam.remote_write ? packIndex : 2 * i + dir),
+                                                    false, dslashParam.remote_write),
+                profile, QUDA_PROFILE_COMMS_START);
+          } // is p2p?
+        }   // dir
+      }     // i
 
       DslashCommsPattern pattern(dslashParam.commDim, true);
       while (pattern.completeSum < pattern.commDimTotal) {
@@ -1498,20 +1524,21 @@ namespace quda
         }
       }
 
-      for (int p2p = 0; p2p < 2; p2p++) { // schedule non-p2p traffic first, then do p2p
-        for (int i = 3; i >= 0; i--) {
-          if (!dslashParam.commDim[i]) continue;
+      // the non-p2p sends are started together as a single persistent message set
+      PROFILE(if (dslash_comms) in->sendStartAll(dslashParam.commDim, false), profile, QUDA_PROFILE_COMMS_START);
 
-          for (int dir = 1; dir >= 0; dir--) {
-            if ((comm_peer2peer_enabled(dir, i) + p2p) % 2 == 0) {
-              PROFILE(if (dslash_comms) in->sendStart(2 * i + dir,
-                                                      dslashParam.remote_write ? device::get_default_stream() : device::get_stream(2 * i + dir),
-                                                      false, dslashParam.remote_write),
-                      profile, QUDA_PROFILE_COMMS_START);
-            } // is p2p?
-          }   // dir
-        }     // i
-      }       // p2p
+      for (int i = 3; i >= 0; i--) { // p2p sends are tied to a stream so are started individually
+        if (!dslashParam.commDim[i]) continue;
+
+        for (int dir = 1; dir >= 0; dir--) {
+          if (comm_peer2peer_enabled(dir, i)) {
+            PROFILE(if (dslash_comms) in->sendStart(2 * i + dir,
+                                                    dslashParam.remote_write ? device::get_default_stream() : device::get_stream(2 * i + dir),
+                                                    false, dslashParam.remote_write),
+                    profile, QUDA_PROFILE_COMMS_START);
+          } // is p2p?
+        }   // dir
+      }     // i
 
       DslashCommsPattern pattern(dslashParam.commDim, true);
       while (pattern.completeSum < pattern.commDimTotal) {
@@ -1590,20 +1617,21 @@ namespace quda
         }
       }
 
-      for (int p2p = 0; p2p < 2; p2p++) { // schedule non-p2p traffic first, then do p2p
-        for (int i = 3; i >= 0; i--) {
-          if (!dslashParam.commDim[i]) continue;
+      // the non-p2p sends are started together as a single persistent message set
+      PROFILE(if (dslash_comms) in->sendStartAll(dslashParam.commDim, false), profile, QUDA_PROFILE_COMMS_START);
 
-          for (int dir = 1; dir >= 0; dir--) {
-            if ((comm_peer2peer_enabled(dir, i) + p2p) % 2 == 0) {
-              PROFILE(if (dslash_comms) in->sendStart(2 * i + dir,
-                                                      dslashParam.remote_write ? device::get_default_stream() : device::get_stream(2 * i + dir),
-                                                      false, dslashParam.remote_write),
-                      profile, QUDA_PROFILE_COMMS_START);
-            } // is p2p?
-          }   // dir
-        }     // i
-      }       // p2p
+      for (int i = 3; i >= 0; i--) { // p2p sends are tied to a stream so are started individually
+        if (!dslashParam.commDim[i]) continue;
+
+        for (int dir = 1; dir >= 0; dir--) {
+          if (comm_peer2peer_enabled(dir, i)) {
+            PROFILE(if (dslash_comms) in->sendStart(2 * i + dir,
+                                                    dslashParam.remote_write ? device::get_default_stream() : device::get_stream(2 * i + dir),
+                                                    false, dslashParam.remote_write),
+                    profile, QUDA_PROFILE_COMMS_START);
+          } // is p2p?
+        }   // dir
+      }     // i
 
       DslashCommsPattern pattern(dslashParam.commDim, true);
       while (pattern.completeSum < pattern.commDimTotal) {
@@ -1664,6 +1692,7 @@ namespace quda
     QUDA_SHMEM_UBER_PACKFULL_DSLASH,
     QUDA_SHMEM_PACKINTRA_DSLASH,
     QUDA_SHMEM_PACKFULL_DSLASH,
+    QUDA_HOST_DSLASH, // only used for host fields, where it is the only policy
     QUDA_DSLASH_POLICY_DISABLED // this MUST be the last element
   };
 
@@ -1727,6 +1756,7 @@ namespace quda
       case QudaDslashPolicy::QUDA_SHMEM_UBER_PACKFULL_DSLASH: return std::make_unique<DslashShmemUberPackFull<Dslash>>();
       case QudaDslashPolicy::QUDA_SHMEM_PACKINTRA_DSLASH: return std::make_unique<DslashShmemPackIntra<Dslash>>();
       case QudaDslashPolicy::QUDA_SHMEM_PACKFULL_DSLASH: return std::make_unique<DslashShmemPackFull<Dslash>>();
+      case QudaDslashPolicy::QUDA_HOST_DSLASH: return std::make_unique<DslashHost<Dslash>>();
       default: errorQuda("Dslash policy %d not recognized", static_cast<int>(policy));
       }
 
@@ -1818,6 +1848,10 @@ namespace quda
 #endif
             }
 
+            if (dslash_policy == QudaDslashPolicy::QUDA_HOST_DSLASH)
+              errorQuda("Policy %d is selected automatically for host fields and cannot be tuned over",
+                        static_cast<int>(dslash_policy));
+
             enable_policy(static_cast<QudaDslashPolicy>(policy_));
             first_active_policy = policy_ < first_active_policy ? policy_ : first_active_policy;
             if (policy_list.peek() == ',') policy_list.ignore();
@@ -1894,6 +1928,14 @@ namespace quda
        }
       }
 
+      // host fields have a single policy, so there is no policy tuning to do
+      if (in.Location() == QUDA_CPU_FIELD_LOCATION) {
+        dslash_policy_init = true;
+        auto dslashImp = DslashFactory<Dslash>::create(QudaDslashPolicy::QUDA_HOST_DSLASH);
+        (*dslashImp)(dslash, &(this->in), volume, ghostFace, profile);
+        return;
+      }
+
       // before we do policy tuning we must ensure the kernel
       // constituents have been tuned since we can't do nested tuning
       if (!tuned()) {
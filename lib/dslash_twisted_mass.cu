@@ -15,7 +15,7 @@ namespace quda
 
   template <typename Arg> class TwistedMass : public Dslash<twistedMass, Arg>
   {
-    using Dslash = Dslash<twistedMass, Arg>;
+    using Dslash = quda::Dslash<twistedMass, Arg>;
     using Dslash::arg;
     using Dslash::in;
 
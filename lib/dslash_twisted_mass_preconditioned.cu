@@ -23,7 +23,7 @@ namespace quda
 
   template <typename Arg> class TwistedMassPreconditioned : public Dslash<twistedMassPreconditioned, Arg>
   {
-    using Dslash = Dslash<twistedMassPreconditioned, Arg>;
+    using Dslash = quda::Dslash<twistedMassPreconditioned, Arg>;
     using Dslash::arg;
     using Dslash::in;
 
@@ -17,7 +17,7 @@ namespace quda
 
   template <typename Arg> class Wilson : public Dslash<wilson, Arg>
   {
-    using Dslash = Dslash<wilson, Arg>;
+    using Dslash = quda::Dslash<wilson, Arg>;
 
   public:
     Wilson(Arg &arg, const ColorSpinorField &out, const ColorSpinorField &in) : Dslash(arg, out, in)
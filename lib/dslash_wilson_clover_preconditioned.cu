@@ -16,7 +16,7 @@ namespace quda
 
   template <typename Arg> class WilsonCloverPreconditioned : public Dslash<wilsonCloverPreconditioned, Arg>
   {
-    using Dslash = Dslash<wilsonCloverPreconditioned, Arg>;
+    using Dslash = quda::Dslash<wilsonCloverPreconditioned, Arg>;
     using Dslash::arg;
     using Dslash::in;
 
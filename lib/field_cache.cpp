@@ -1,18 +1,71 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
 #include <field_cache.h>
 #include <color_spinor_field.h>
 
 namespace quda {
 
-  template <typename T> std::map<FieldKey<T>, std::stack<T>> FieldTmp<T>::cache;
+  template <typename T> typename FieldTmp<T>::lru_t FieldTmp<T>::lru;
+  template <typename T>
+  std::unordered_map<FieldKey<T>, std::deque<typename FieldTmp<T>::lru_t::iterator>, FieldKeyHash<T>>
+    FieldTmp<T>::cache;
+  template <typename T> FieldCacheStats FieldTmp<T>::stats;
 
-  template <typename T> FieldTmp<T>::FieldTmp(const T &a) : key(FieldKey(a))
+  /**
+     @brief The maximum number of bytes held by the field cache, which
+     is set in MiB with the environment variable
+     QUDA_FIELD_CACHE_BUDGET (default unbounded)
+   */
+  static size_t field_cache_budget()
+  {
+    static bool init = false;
+    static size_t budget = std::numeric_limits<size_t>::max();
+
+    if (!init) {
+      char *budget_env = getenv("QUDA_FIELD_CACHE_BUDGET");
+      if (budget_env) budget = static_cast<size_t>(std::max(atof(budget_env), 0.0) * (1 << 20));
+      init = true;
+    }
+    return budget;
+  }
+
+  template <typename T> bool FieldTmp<T>::take(const FieldKey<T> &key, T &field)
   {
     auto it = cache.find(key);
+    if (it == cache.end() || it->second.empty()) {
+      stats.n_miss++;
+      return false;
+    }
+
+    auto entry = it->second.back();
+    it->second.pop_back();
+    field = std::move(entry->field);
+    stats.cached_bytes -= entry->bytes;
+    stats.n_cached--;
+    stats.n_hit++;
+    lru.erase(entry);
+    return true;
+  }
+
+  template <typename T> void FieldTmp<T>::evict()
+  {
+    while (stats.cached_bytes > field_cache_budget() && !lru.empty()) {
+      auto entry = std::prev(lru.end());
+      auto it = cache.find(entry->key);
+      it->second.pop_front(); // the least recently returned field of a key is the oldest of that key
+      if (it->second.empty()) cache.erase(it);
+      stats.cached_bytes -= entry->bytes;
+      stats.n_cached--;
+      stats.n_evict++;
+      lru.erase(entry); // frees the field
+    }
+  }
 
-    if (it != cache.end() && it->second.size()) { // found an entry
-      tmp = std::move(it->second.top());
-      it->second.pop(); // pop the defunct object
-    } else { // no entry found, we must allocate a new field
+  template <typename T> FieldTmp<T>::FieldTmp(const T &a) : key(FieldKey(a))
+  {
+    if (!take(key, tmp)) { // no entry found, we must allocate a new field
       typename T::param_type param(a);
       param.create = QUDA_ZERO_FIELD_CREATE;
       tmp = T(param);
@@ -21,12 +74,7 @@ namespace quda {
 
   template <typename T> FieldTmp<T>::FieldTmp(const FieldKey<T> &key, const typename T::param_type &param) : key(key)
   {
-    auto it = cache.find(key);
-
-    if (it != cache.end() && it->second.size()) { // found an entry
-      tmp = std::move(it->second.top());
-      it->second.pop(); // pop the defunct object
-    } else {            // no entry found, we must allocate a new field
+    if (!take(key, tmp)) { // no entry found, we must allocate a new field
       tmp = T(param);
     }
   }
@@ -34,13 +82,30 @@ namespace quda {
   template <typename T> FieldTmp<T>::~FieldTmp()
   {
     // don't cache the field if it's empty (e.g., has been moved)
-    if (tmp.Bytes() == 0) return;
-    cache[key].push(std::move(tmp));
+    const size_t bytes = tmp.Bytes();
+    if (bytes == 0) return;
+    lru.push_front({key, std::move(tmp), bytes});
+    cache[key].push_back(lru.begin());
+    stats.cached_bytes += bytes;
+    stats.n_cached++;
+    evict();
+    stats.peak_cached_bytes = std::max(stats.peak_cached_bytes, stats.cached_bytes);
   }
 
   template <typename T> void FieldTmp<T>::destroy()
   {
     cache.clear();
+    lru.clear();
+    stats.cached_bytes = 0;
+    stats.n_cached = 0;
+  }
+
+  template <typename T> void FieldTmp<T>::print_stats()
+  {
+    const size_t n_request = stats.n_hit + stats.n_miss;
+    printfQuda("Field cache: %lu requests, %.1f%% served from cache, %lu evictions, peak cached = %.1f MiB\n",
+               n_request, n_request > 0 ? 100.0 * stats.n_hit / n_request : 0.0, stats.n_evict,
+               stats.peak_cached_bytes / (double)(1 << 20));
   }
 
   template class FieldTmp<ColorSpinorField>;
@@ -502,6 +502,8 @@ namespace quda {
   void gaugeFixingOVR(GaugeField& data, const int gauge_dir, const int Nsteps, const int verbose_interval, const double relax_boost,
                       const double tolerance, const int reunit_interval, const int stopWtheta)
   {
+    // the overrelaxation kernels distribute the eight link updates of a site over the threads of a block
+    if (device::max_threads_per_block() < 8) errorQuda("Gauge fixing with overrelaxation requires multi-thread blocks");
     instantiate<GaugeFixingOVR>(data, gauge_dir, Nsteps, verbose_interval, relax_boost, tolerance, reunit_interval, stopWtheta);
   }
 
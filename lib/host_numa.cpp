@@ -0,0 +1,152 @@
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+#include <util_quda.h>
+#include <host_numa.h>
+#include <host_thread_helper.h>
+
+namespace quda
+{
+
+  namespace numa
+  {
+
+    enum class policy_t { DEFAULT, FIRST_TOUCH, INTERLEAVE, BIND };
+
+    /** memory policies of mbind (see linux/mempolicy.h) */
+    constexpr int mpol_bind = 2;
+    constexpr int mpol_interleave = 3;
+
+    /** the size of a transparent huge page, which is also the minimum size of the buffers we place */
+    constexpr size_t huge_page_bytes = 2 << 20;
+
+    /** the bit mask of nodes, with 64 nodes per word */
+    using node_mask_t = std::vector<unsigned long>;
+
+    /**
+       @brief Parse a list of nodes, e.g., 0,2-3, into a mask
+       @param[in] list The node list
+       @param[out] mask The mask of the nodes
+       @return Whether the list was valid
+     */
+    static bool parse_nodes(const std::string &list, node_mask_t &mask)
+    {
+      constexpr int bits = 8 * sizeof(unsigned long);
+      std::stringstream nodes(list);
+      std::string range;
+      mask.clear();
+      while (std::getline(nodes, range, ',')) {
+        if (range.empty() || range.find_first_not_of("0123456789-\n") != std::string::npos) return false;
+        char *end;
+        unsigned long lo = std::strtoul(range.c_str(), &end, 10);
+        unsigned long hi = *end == '-' ? std::strtoul(end + 1, nullptr, 10) : lo;
+        if (hi < lo || hi >= 4096) return false;
+        if (mask.size() <= hi / bits) mask.resize(hi / bits + 1, 0);
+        for (auto n = lo; n <= hi; n++) mask[n / bits] |= 1ul << (n % bits);
+      }
+      return !mask.empty();
+    }
+
+    struct config_t {
+      policy_t policy = policy_t::DEFAULT;
+      bool huge_pages = false;
+      node_mask_t nodes;
+    };
+
+    static const config_t &config()
+    {
+      static bool init = false;
+      static config_t config;
+
+      if (!init) {
+        char *numa_env = getenv("QUDA_HOST_NUMA");
+        if (numa_env && strcmp(numa_env, "first-touch") == 0) {
+          config.policy = policy_t::FIRST_TOUCH;
+        } else if (numa_env && strcmp(numa_env, "interleave") == 0) {
+          config.policy = policy_t::INTERLEAVE;
+          std::ifstream online("/sys/devices/system/node/online");
+          std::string list;
+          if (!(online >> list) || !parse_nodes(list, config.nodes)) {
+            warningQuda("Unable to determine the online NUMA nodes, host allocations will not be interleaved");
+            config.policy = policy_t::FIRST_TOUCH;
+          }
+        } else if (numa_env && strlen(numa_env) > 0 && strcmp(numa_env, "default") != 0) {
+          config.policy = policy_t::BIND;
+          if (!parse_nodes(numa_env, config.nodes)) errorQuda("Invalid QUDA_HOST_NUMA=%s", numa_env);
+        }
+
+        char *huge_pages_env = getenv("QUDA_HOST_HUGEPAGES");
+        if (huge_pages_env && strcmp(huge_pages_env, "1") == 0) config.huge_pages = true;
+
+#ifndef __linux__
+        if (config.policy == policy_t::INTERLEAVE || config.policy == policy_t::BIND || config.huge_pages) {
+          warningQuda("NUMA placement and huge pages of host allocations are only supported on Linux");
+          if (config.policy != policy_t::DEFAULT) config.policy = policy_t::FIRST_TOUCH;
+          config.huge_pages = false;
+        }
+#endif
+        if (config.policy != policy_t::DEFAULT && getVerbosity() >= QUDA_VERBOSE)
+          printfQuda("Host allocations use NUMA policy %s%s\n", numa_env,
+                     config.huge_pages ? " with transparent huge pages" : "");
+        init = true;
+      }
+      return config;
+    }
+
+    void place(void *ptr, size_t bytes)
+    {
+      const auto &config = numa::config();
+      if (config.policy == policy_t::DEFAULT && !config.huge_pages) return;
+      if (bytes < huge_page_bytes) return;
+
+      // the policies apply to whole pages, so we restrict ourselves to those within the buffer
+      const uintptr_t page = getpagesize();
+      const uintptr_t begin = (reinterpret_cast<uintptr_t>(ptr) + page - 1) / page * page;
+      const uintptr_t end = (reinterpret_cast<uintptr_t>(ptr) + bytes) / page * page;
+      if (end <= begin) return;
+      char *base = reinterpret_cast<char *>(begin);
+      const size_t length = end - begin;
+
+#ifdef __linux__
+      if (config.huge_pages && madvise(base, length, MADV_HUGEPAGE) != 0) {
+        static bool warned = false;
+        if (!warned) warningQuda("madvise(MADV_HUGEPAGE) failed: %s", strerror(errno));
+        warned = true;
+      }
+
+      if (config.policy == policy_t::INTERLEAVE || config.policy == policy_t::BIND) {
+        const int mode = config.policy == policy_t::INTERLEAVE ? mpol_interleave : mpol_bind;
+        const unsigned long max_node = 8 * sizeof(unsigned long) * config.nodes.size() + 1;
+        if (syscall(SYS_mbind, base, length, mode, config.nodes.data(), max_node, 0) != 0) {
+          static bool warned = false;
+          if (!warned) warningQuda("mbind failed: %s", strerror(errno));
+          warned = true;
+        }
+      }
+#endif
+
+      if (config.policy == policy_t::DEFAULT) return;
+
+      // touch the pages in parallel with the partitioning of a statically scheduled host kernel on all threads
+      // (a kernel tuned to a dynamic schedule or fewer threads does not preserve this locality, see host_numa.h)
+      const int64_t n_page = length / page;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(host::max_threads())
+#endif
+      for (int64_t p = 0; p < n_page; p++) base[p * page] = 0;
+    }
+
+  } // namespace numa
+
+} // namespace quda
@@ -23,6 +23,7 @@
 #include <llfat_quda.h>
 #include <unitarization_links.h>
 #include <algorithm>
+#include <map>
 #include <staggered_oprod.h>
 #include <ks_improved_force.h>
 #include <ks_force_quda.h>
@@ -391,6 +392,70 @@ void initCommsGridQuda(int nDim, const int *dims, QudaCommsMap func, void *fdata
 }
 
 
+/**
+ * Rank map selected by selectCommsGridQuda()
+ */
+typedef struct {
+  int ndim;
+  int dims[QUDA_MAX_DIM];
+  std::vector<int> ranks;
+} AutoMapData;
+
+static AutoMapData auto_map_data;
+
+static int auto_rank_from_coords(const int *coords, void *fdata)
+{
+  auto *md = static_cast<AutoMapData *>(fdata);
+
+  int index = coords[0];
+  for (int i = 1; i < md->ndim; i++) {
+    index = md->dims[i] * index + coords[i];
+  }
+  return md->ranks[index];
+}
+
+void selectCommsGridQuda(int nDim, const int *X, int *dims, QudaCommsMap *func, void **fdata)
+{
+  if (nDim != 4) {
+    errorQuda("Number of communication grid dimensions must be 4");
+  }
+
+  // identify the node of each rank by its host name
+  std::vector<int> node;
+#if defined(QMP_COMMS) || defined(MPI_COMMS)
+  int initialized;
+  MPI_Initialized(&initialized);
+  if (!initialized) errorQuda("MPI must be initialized before calling selectCommsGridQuda()");
+
+  MPI_Comm comm = MPI_COMM_WORLD;
+  if (user_set_comm_handle) comm = MPI_COMM_HANDLE_USER;
+  int size;
+  MPI_Comm_size(comm, &size);
+
+  std::vector<char> hostname(static_cast<size_t>(size) * QUDA_MAX_HOSTNAME_STRING);
+  MPI_Allgather(comm_hostname(), QUDA_MAX_HOSTNAME_STRING, MPI_CHAR, hostname.data(), QUDA_MAX_HOSTNAME_STRING,
+                MPI_CHAR, comm);
+
+  std::map<std::string, int> node_id;
+  for (int r = 0; r < size; r++) {
+    std::string name(&hostname[static_cast<size_t>(r) * QUDA_MAX_HOSTNAME_STRING]);
+    node.push_back(node_id.emplace(name, node_id.size()).first->second);
+  }
+#elif defined(SHM_COMMS)
+  // all processes of a shared-memory job are on this node
+  char *size_env = getenv("QUDA_SHM_SIZE");
+  node.assign(size_env ? atoi(size_env) : 1, 0);
+#else
+  node.assign(1, 0);
+#endif
+
+  auto_map_data.ndim = nDim;
+  comm_select_grid(nDim, X, node, auto_map_data.dims, auto_map_data.ranks);
+  for (int i = 0; i < nDim; i++) dims[i] = auto_map_data.dims[i];
+  *func = auto_rank_from_coords;
+  *fdata = &auto_map_data;
+}
+
 static void init_default_comms()
 {
 #if defined(QMP_COMMS)
@@ -404,6 +469,8 @@ static void init_default_comms()
   }
 #elif defined(MPI_COMMS)
   errorQuda("When using MPI for communications, initCommsGridQuda() must be called before initQuda()");
+#elif defined(SHM_COMMS)
+  errorQuda("When using shared-memory communications, initCommsGridQuda() must be called before initQuda()");
 #else // single-GPU
   const int dims[4] = {1, 1, 1, 1};
   initCommsGridQuda(4, dims, nullptr, nullptr);
@@ -1366,6 +1433,8 @@ void flushChronoQuda(int i)
   chronoResident[i].clear();
 }
 
+void flushRecycleQuda(int i) { GCRODR::flushRecycle(i); }
+
 void endQuda(void)
 {
   profileEnd.TPSTART(QUDA_PROFILE_TOTAL);
@@ -1376,6 +1445,7 @@ void endQuda(void)
   freeCloverQuda();
 
   for (int i = 0; i < QUDA_MAX_CHRONO; i++) flushChronoQuda(i);
+  for (int i = 0; i < GCRODR::max_recycle; i++) flushRecycleQuda(i);
 
   solutionResident.clear();
 
@@ -1450,6 +1520,7 @@ void endQuda(void)
 
     printfQuda("\n");
     printPeakMemUsage();
+    FieldTmp<ColorSpinorField>::print_stats();
     printfQuda("\n");
   }
 
@@ -2696,10 +2767,91 @@ void destroyDeflationQuda(void *df) {
   delete static_cast<deflated_solver*>(df);
 }
 
-void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
+/**
+   @brief The solution and solve types of an inversion, factorized
+   into whether the solution and the solve are even/odd
+   preconditioned, and which system is solved.  It was probably a bad
+   design decision to encode whether the system is even/odd
+   preconditioned (PC) in solve_type and solution_type, rather than in
+   separate members of QudaInvertParam.  We're stuck with it for now,
+   though, so here we factorize everything for convenience.
+ */
+struct invert_type_t {
+  bool pc_solution;
+  bool pc_solve;
+  bool mat_solution;
+  bool direct_solve;
+  bool norm_error_solve;
+};
+
+/**
+   @brief Factorize and check the solution and solve types of an inversion
+   @param[in] param The inverter parameters
+   @return The factorized types
+ */
+static invert_type_t invertType(const QudaInvertParam &param)
 {
-  profilerStart(__func__);
+  invert_type_t type;
+  type.pc_solution = (param.solution_type == QUDA_MATPC_SOLUTION) || (param.solution_type == QUDA_MATPCDAG_MATPC_SOLUTION);
+  type.pc_solve = (param.solve_type == QUDA_DIRECT_PC_SOLVE) || (param.solve_type == QUDA_NORMOP_PC_SOLVE)
+    || (param.solve_type == QUDA_NORMERR_PC_SOLVE);
+  type.mat_solution = (param.solution_type == QUDA_MAT_SOLUTION) || (param.solution_type == QUDA_MATPC_SOLUTION);
+  type.direct_solve = (param.solve_type == QUDA_DIRECT_SOLVE) || (param.solve_type == QUDA_DIRECT_PC_SOLVE);
+  type.norm_error_solve = (param.solve_type == QUDA_NORMERR_SOLVE) || (param.solve_type == QUDA_NORMERR_PC_SOLVE);
 
+  // solution_type specifies *what* system is to be solved.
+  // solve_type specifies *how* the system is to be solved.
+  //
+  // We have the following four cases (plus preconditioned variants):
+  //
+  // solution_type    solve_type    Effect
+  // -------------    ----------    ------
+  // MAT              DIRECT        Solve Ax=b
+  // MATDAG_MAT       DIRECT        Solve A^dag y = b, followed by Ax=y
+  // MAT              NORMOP        Solve (A^dag A) x = (A^dag b)
+  // MATDAG_MAT       NORMOP        Solve (A^dag A) x = b
+  // MAT              NORMERR       Solve (A A^dag) y = b, then x = A^dag y
+  //
+  // We generally require that the solution_type and solve_type
+  // preconditioning match.  As an exception, the unpreconditioned MAT
+  // solution_type may be used with any solve_type, including
+  // DIRECT_PC and NORMOP_PC.  In these cases, preparation of the
+  // preconditioned source and reconstruction of the full solution are
+  // taken care of by Dirac::prepare() and Dirac::reconstruct(),
+  // respectively.
+
+  if (type.pc_solution && !type.pc_solve) {
+    errorQuda("Preconditioned (PC) solution_type requires a PC solve_type");
+  }
+
+  if (!type.mat_solution && !type.pc_solution && type.pc_solve) {
+    errorQuda("Unpreconditioned MATDAG_MAT solution_type requires an unpreconditioned solve_type");
+  }
+
+  if (!type.mat_solution && type.norm_error_solve) { errorQuda("Normal-error solve requires Mat solution"); }
+
+  if (param.inv_type_precondition == QUDA_MG_INVERTER && (!type.direct_solve || !type.mat_solution)) {
+    errorQuda("Multigrid preconditioning only supported for direct solves");
+  }
+
+  if (param.chrono_use_resident && (type.norm_error_solve)) {
+    errorQuda("Chronological forcasting only presently supported for M^dagger M solver");
+  }
+
+  return type;
+}
+
+/**
+   @brief The prologue shared by invertQuda and invertBlockQuda:
+   check that QUDA is initialized, the parameters and the gauge field,
+   and reset the statistics of the solve
+   @param[in,out] param The inverter parameters
+   @param[in] hp_x Host solution pointer (of the first source)
+   @param[in] hp_b Host source pointer (of the first source)
+   @return The gauge field
+ */
+static cudaGaugeField *invertPrologue(QudaInvertParam *param, void *hp_x, void *hp_b)
+{
   profileInvert.TPSTART(QUDA_PROFILE_TOTAL);
 
   if (!initialized) errorQuda("QUDA not initialized");
@@ -2712,25 +2864,94 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
   // check the gauge fields have been created
   cudaGaugeField *cudaGauge = checkGauge(param);
 
-  // It was probably a bad design decision to encode whether the system is even/odd preconditioned (PC) in
-  // solve_type and solution_type, rather than in separate members of QudaInvertParam.  We're stuck with it
-  // for now, though, so here we factorize everything for convenience.
-
-  bool pc_solution = (param->solution_type == QUDA_MATPC_SOLUTION) ||
-    (param->solution_type == QUDA_MATPCDAG_MATPC_SOLUTION);
-  bool pc_solve = (param->solve_type == QUDA_DIRECT_PC_SOLVE) ||
-    (param->solve_type == QUDA_NORMOP_PC_SOLVE) || (param->solve_type == QUDA_NORMERR_PC_SOLVE);
-  bool mat_solution = (param->solution_type == QUDA_MAT_SOLUTION) ||
-    (param->solution_type ==  QUDA_MATPC_SOLUTION);
-  bool direct_solve = (param->solve_type == QUDA_DIRECT_SOLVE) ||
-    (param->solve_type == QUDA_DIRECT_PC_SOLVE);
-  bool norm_error_solve = (param->solve_type == QUDA_NORMERR_SOLVE) ||
-    (param->solve_type == QUDA_NORMERR_PC_SOLVE);
-
   param->secs = 0;
   param->gflops = 0;
   param->iter = 0;
 
+  return cudaGauge;
+}
+
+/**
+   @brief The epilogue shared by invertQuda and invertBlockQuda,
+   which undoes invertPrologue and saves the tunecache
+ */
+static void invertEpilogue()
+{
+  popVerbosity();
+
+  // cache is written out even if a long benchmarking job gets interrupted
+  saveTuneCache();
+
+  profileInvert.TPSTOP(QUDA_PROFILE_TOTAL);
+}
+
+/**
+   @brief Prepare a source and initial guess that have been
+   downloaded for an inversion: the source is checked to be non-zero,
+   both are normalized by the source norm if requested, and the source
+   is rescaled for the mass normalization
+   @param[in,out] b The source
+   @param[in,out] x The initial guess
+   @param[in] h_b The host source, for verbose output
+   @param[in] h_x The host initial guess, for verbose output
+   @param[in] param The inverter parameters
+   @return The norm squared of the source before normalization
+ */
+static double prepareInvertSource(ColorSpinorField &b, ColorSpinorField &x, const ColorSpinorField &h_b,
+                                  const ColorSpinorField &h_x, QudaInvertParam &param)
+{
+  double nb = blas::norm2(b);
+  if (nb==0.0) errorQuda("Source has zero norm");
+
+  if (getVerbosity() >= QUDA_DEBUG_VERBOSE) {
+    printfQuda("Source: CPU = %g, CUDA copy = %g\n", blas::norm2(h_b), nb);
+    if (param.use_init_guess == QUDA_USE_INIT_GUESS_YES) {
+      printfQuda("Initial guess: CPU = %g, CUDA copy = %g\n", blas::norm2(h_x), blas::norm2(x));
+    }
+  } else if (getVerbosity() >= QUDA_VERBOSE) {
+    printfQuda("Source: %g\n", nb);
+    if (param.use_init_guess == QUDA_USE_INIT_GUESS_YES) { printfQuda("Initial guess: %g\n", blas::norm2(x)); }
+  }
+
+  // rescale the source and solution vectors to help prevent the onset of underflow
+  if (param.solver_normalization == QUDA_SOURCE_NORMALIZATION) {
+    blas::ax(1.0 / sqrt(nb), b);
+    blas::ax(1.0 / sqrt(nb), x);
+  }
+
+  massRescale(b, param, false);
+
+  return nb;
+}
+
+/**
+   @brief Reconstruct the full solution of an inversion from the
+   solution of the (preconditioned) system solved, and undo the
+   normalization of prepareInvertSource
+   @param[in,out] x The solution
+   @param[in,out] b The source
+   @param[in] nb The norm squared of the source returned by prepareInvertSource
+   @param[in] dirac The Dirac operator
+   @param[in] param The inverter parameters
+ */
+static void reconstructInvertSolution(ColorSpinorField &x, ColorSpinorField &b, double nb, const Dirac &dirac,
+                                      const QudaInvertParam &param)
+{
+  dirac.reconstruct(x, b, param.solution_type);
+
+  if (param.solver_normalization == QUDA_SOURCE_NORMALIZATION) {
+    // rescale the solution
+    blas::ax(sqrt(nb), x);
+  }
+}
+
+void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
+{
+  profilerStart(__func__);
+
+  cudaGaugeField *cudaGauge = invertPrologue(param, hp_x, hp_b);
+  auto [pc_solution, pc_solve, mat_solution, direct_solve, norm_error_solve] = invertType(*param);
+
   Dirac *d = nullptr;
   Dirac *dSloppy = nullptr;
   Dirac *dPre = nullptr;
@@ -2810,26 +3031,7 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
   profileInvert.TPSTOP(QUDA_PROFILE_H2D);
   profileInvert.TPSTART(QUDA_PROFILE_PREAMBLE);
 
-  double nb = blas::norm2(b);
-  if (nb==0.0) errorQuda("Source has zero norm");
-
-  if (getVerbosity() >= QUDA_DEBUG_VERBOSE) {
-    printfQuda("Source: CPU = %g, CUDA copy = %g\n", blas::norm2(h_b), nb);
-    if (param->use_init_guess == QUDA_USE_INIT_GUESS_YES) {
-      printfQuda("Initial guess: CPU = %g, CUDA copy = %g\n", blas::norm2(h_x), blas::norm2(x));
-    }
-  } else if (getVerbosity() >= QUDA_VERBOSE) {
-    printfQuda("Source: %g\n", nb);
-    if (param->use_init_guess == QUDA_USE_INIT_GUESS_YES) { printfQuda("Initial guess: %g\n", blas::norm2(x)); }
-  }
-
-  // rescale the source and solution vectors to help prevent the onset of underflow
-  if (param->solver_normalization == QUDA_SOURCE_NORMALIZATION) {
-    blas::ax(1.0 / sqrt(nb), b);
-    blas::ax(1.0 / sqrt(nb), x);
-  }
-
-  massRescale(b, *param, false);
+  double nb = prepareInvertSource(b, x, h_b, h_x, *param);
 
   dirac.prepare(in, out, x, b, param->solution_type);
 
@@ -2845,47 +3047,6 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
     printfQuda("Prepared source post mass rescale = %g\n", nin);
   }
 
-  // solution_type specifies *what* system is to be solved.
-  // solve_type specifies *how* the system is to be solved.
-  //
-  // We have the following four cases (plus preconditioned variants):
-  //
-  // solution_type    solve_type    Effect
-  // -------------    ----------    ------
-  // MAT              DIRECT        Solve Ax=b
-  // MATDAG_MAT       DIRECT        Solve A^dag y = b, followed by Ax=y
-  // MAT              NORMOP        Solve (A^dag A) x = (A^dag b)
-  // MATDAG_MAT       NORMOP        Solve (A^dag A) x = b
-  // MAT              NORMERR       Solve (A A^dag) y = b, then x = A^dag y
-  //
-  // We generally require that the solution_type and solve_type
-  // preconditioning match.  As an exception, the unpreconditioned MAT
-  // solution_type may be used with any solve_type, including
-  // DIRECT_PC and NORMOP_PC.  In these cases, preparation of the
-  // preconditioned source and reconstruction of the full solution are
-  // taken care of by Dirac::prepare() and Dirac::reconstruct(),
-  // respectively.
-
-  if (pc_solution && !pc_solve) {
-    errorQuda("Preconditioned (PC) solution_type requires a PC solve_type");
-  }
-
-  if (!mat_solution && !pc_solution && pc_solve) {
-    errorQuda("Unpreconditioned MATDAG_MAT solution_type requires an unpreconditioned solve_type");
-  }
-
-  if (!mat_solution && norm_error_solve) {
-    errorQuda("Normal-error solve requires Mat solution");
-  }
-
-  if (param->inv_type_precondition == QUDA_MG_INVERTER && (!direct_solve || !mat_solution)) {
-    errorQuda("Multigrid preconditioning only supported for direct solves");
-  }
-
-  if (param->chrono_use_resident && ( norm_error_solve) ){
-    errorQuda("Chronological forcasting only presently supported for M^dagger M solver");
-  }
-
   profileInvert.TPSTOP(QUDA_PROFILE_PREAMBLE);
 
   if (mat_solution && !direct_solve && !norm_error_solve) { // prepare source: b' = A^dag b
@@ -2910,24 +3071,25 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
 
       auto &basis = chronoResident[param->chrono_index];
 
-      ColorSpinorParam cs_param(basis[0]);
-      std::vector<ColorSpinorField> Ap(basis.size(), cs_param);
-
-      if (param->chrono_precision == param->cuda_prec) {
-        for (unsigned int j = 0; j < basis.size(); j++) m(Ap[j], basis[j]);
-      } else if (param->chrono_precision == param->cuda_prec_sloppy) {
-        for (unsigned int j = 0; j < basis.size(); j++) mSloppy(Ap[j], basis[j]);
+      // the basis is applied with the sloppy operator if it is stored at or below the sloppy precision, with
+      // each vector promoted in turn and A p_i retained at the chrono precision for the normal system
+      bool sloppy = param->chrono_precision <= param->cuda_prec_sloppy;
+      bool orthogonal = false; // the resident basis is kept orthonormal
+      bool apply_mat = true;
+      bool hermitian = false;
+      MinResExt mre(sloppy ? mSloppy : m, orthogonal, apply_mat, hermitian, profileInvert);
+
+      if (sloppy && param->cuda_prec_sloppy != param->cuda_prec) {
+        ColorSpinorParam cs_param(*in);
+        cs_param.setPrecision(param->cuda_prec_sloppy, QUDA_INVALID_PRECISION, true);
+        cs_param.create = QUDA_NULL_FIELD_CREATE;
+        ColorSpinorField inSloppy(cs_param);
+        blas::copy(inSloppy, *in);
+        mre(*out, inSloppy, basis);
       } else {
-        errorQuda("Unexpected precision %d for chrono vectors (doesn't match outer %d or sloppy precision %d)",
-                  param->chrono_precision, param->cuda_prec, param->cuda_prec_sloppy);
+        mre(*out, *in, basis);
       }
 
-      bool orthogonal = true;
-      bool apply_mat = false;
-      bool hermitian = false;
-      MinResExt mre(m, orthogonal, apply_mat, hermitian, profileInvert);
-      mre(*out, *in, basis, Ap);
-
       profileInvert.TPSTOP(QUDA_PROFILE_CHRONO);
     }
 
@@ -2945,24 +3107,25 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
 
       auto &basis = chronoResident[param->chrono_index];
 
-      ColorSpinorParam cs_param(basis[0]);
-      std::vector<ColorSpinorField> Ap(basis.size(), cs_param);
-
-      if (param->chrono_precision == param->cuda_prec) {
-        for (unsigned int j = 0; j < basis.size(); j++) m(Ap[j], basis[j]);
-      } else if (param->chrono_precision == param->cuda_prec_sloppy) {
-        for (unsigned int j = 0; j < basis.size(); j++) mSloppy(Ap[j], basis[j]);
+      // the basis is applied with the sloppy operator if it is stored at or below the sloppy precision, with
+      // each vector promoted in turn so the compressed basis is never expanded in full
+      bool sloppy = param->chrono_precision <= param->cuda_prec_sloppy;
+      bool orthogonal = false; // the resident basis is kept orthonormal
+      bool apply_mat = true;
+      bool hermitian = true;
+      MinResExt mre(sloppy ? mSloppy : m, orthogonal, apply_mat, hermitian, profileInvert);
+
+      if (sloppy && param->cuda_prec_sloppy != param->cuda_prec) {
+        ColorSpinorParam cs_param(*in);
+        cs_param.setPrecision(param->cuda_prec_sloppy, QUDA_INVALID_PRECISION, true);
+        cs_param.create = QUDA_NULL_FIELD_CREATE;
+        ColorSpinorField inSloppy(cs_param);
+        blas::copy(inSloppy, *in);
+        mre(*out, inSloppy, basis);
       } else {
-        errorQuda("Unexpected precision %d for chrono vectors (doesn't match outer %d or sloppy precision %d)",
-                  param->chrono_precision, param->cuda_prec, param->cuda_prec_sloppy);
+        mre(*out, *in, basis);
       }
 
-      bool orthogonal = true;
-      bool apply_mat = false;
-      bool hermitian = true;
-      MinResExt mre(m, orthogonal, apply_mat, hermitian, profileInvert);
-      mre(*out, *in, basis, Ap);
-
       profileInvert.TPSTOP(QUDA_PROFILE_CHRONO);
     }
 
@@ -3008,25 +3171,15 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
       errorQuda("Requested chrono_max_dim %i is smaller than already existing chronology %lu", param->chrono_max_dim, basis.size());
     }
 
-    if(not param->chrono_replace_last){
-      // if we have not filled the space yet just augment
-      if ((int)basis.size() < param->chrono_max_dim) {
-        ColorSpinorParam cs_param(*out);
-        cs_param.setPrecision(param->chrono_precision);
-        basis.emplace_back(cs_param);
-      }
-
-      // shuffle every entry down one and bring the last to the front
-      std::rotate(basis.begin(), basis.end() - 1, basis.end());
-    }
-    basis[0] = *out; // set first entry to new solution
-  }
-  dirac.reconstruct(x, b, param->solution_type);
+    if (param->chrono_precision > param->cuda_prec)
+      errorQuda("Chrono precision %d cannot exceed the solver precision %d", param->chrono_precision, param->cuda_prec);
 
-  if (param->solver_normalization == QUDA_SOURCE_NORMALIZATION) {
-    // rescale the solution
-    blas::ax(sqrt(nb), x);
+    // orthogonalise the new solution against the retained basis and store it at the front, in the chrono
+    // precision: with a half or quarter precision basis the per-site norms of the native field order retain
+    // the dynamic range, allowing for a longer history in the same memory
+    MinResExt::insert(basis, *out, param->chrono_max_dim, param->chrono_replace_last, param->chrono_precision);
   }
+  reconstructInvertSolution(x, b, nb, dirac, *param);
   profileInvert.TPSTOP(QUDA_PROFILE_EPILOGUE);
 
   if (!param->make_resident_solution) {
@@ -3061,12 +3214,134 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
 
   profileInvert.TPSTOP(QUDA_PROFILE_FREE);
 
-  popVerbosity();
+  invertEpilogue();
 
-  // cache is written out even if a long benchmarking job gets interrupted
-  saveTuneCache();
+  profilerStop(__func__);
+}
 
-  profileInvert.TPSTOP(QUDA_PROFILE_TOTAL);
+/**
+   @brief Solve for several sources at once with a block solver that
+   shares the Krylov space between them.  This follows invertQuda, with
+   the exception of the two-pass, chronological and resident-solution
+   options, which are not supported.
+   @param[out] hp_x Host solution pointers
+   @param[in] hp_b Host source pointers
+   @param[in] n_src Number of sources
+   @param[in,out] param Inverter parameters, of which inv_type selects the block solver
+ */
+static void invertBlockQuda(void **hp_x, void **hp_b, int n_src, QudaInvertParam *param)
+{
+  profilerStart(__func__);
+
+  cudaGaugeField *cudaGauge = invertPrologue(param, hp_x[0], hp_b[0]);
+  auto [pc_solution, pc_solve, mat_solution, direct_solve, norm_error_solve] = invertType(*param);
+
+  if (!mat_solution && direct_solve) errorQuda("Two-pass solves are not supported by the block solver");
+  if (param->chrono_use_resident || param->chrono_make_resident)
+    errorQuda("Chronological forecasting is not supported by the block solver");
+  if (param->use_resident_solution || param->make_resident_solution)
+    errorQuda("Resident solutions are not supported by the block solver");
+
+  Dirac *d = nullptr;
+  Dirac *dSloppy = nullptr;
+  Dirac *dPre = nullptr;
+  createDirac(d, dSloppy, dPre, *param, pc_solve);
+  Dirac &dirac = *d;
+  Dirac &diracSloppy = *dSloppy;
+
+  profileInvert.TPSTART(QUDA_PROFILE_H2D);
+
+  const auto X = cudaGauge->X();
+  std::vector<ColorSpinorField> h_b, h_x, b, x;
+  for (auto v : {&h_b, &h_x, &b, &x}) v->reserve(n_src);
+
+  for (int i = 0; i < n_src; i++) {
+    // wrap CPU host side pointers
+    ColorSpinorParam cpuParam(hp_b[i], *param, X, pc_solution, param->input_location);
+    h_b.emplace_back(cpuParam);
+
+    cpuParam.v = hp_x[i];
+    cpuParam.location = param->output_location;
+    h_x.emplace_back(cpuParam);
+
+    // download source and initial guess
+    ColorSpinorParam cudaParam(cpuParam, *param, QUDA_CUDA_FIELD_LOCATION);
+    cudaParam.create = QUDA_COPY_FIELD_CREATE;
+    cudaParam.field = &h_b[i];
+    b.emplace_back(cudaParam);
+
+    cudaParam.create = QUDA_NULL_FIELD_CREATE;
+    x.emplace_back(cudaParam);
+    if (param->use_init_guess == QUDA_USE_INIT_GUESS_YES) {
+      x[i] = h_x[i];
+    } else {
+      blas::zero(x[i]);
+    }
+  }
+
+  profileInvert.TPSTOP(QUDA_PROFILE_H2D);
+  profileInvert.TPSTART(QUDA_PROFILE_PREAMBLE);
+
+  std::vector<double> nb(n_src);
+  std::vector<ColorSpinorField> in, out;
+  for (int i = 0; i < n_src; i++) {
+    nb[i] = prepareInvertSource(b[i], x[i], h_b[i], h_x[i], *param);
+
+    ColorSpinorField *in_i = nullptr;
+    ColorSpinorField *out_i = nullptr;
+    dirac.prepare(in_i, out_i, x[i], b[i], param->solution_type);
+    in.push_back(in_i->create_alias());
+    out.push_back(out_i->create_alias());
+  }
+
+  profileInvert.TPSTOP(QUDA_PROFILE_PREAMBLE);
+
+  SolverParam solverParam(*param);
+  if (mat_solution && !direct_solve && !norm_error_solve) { // prepare source: b' = A^dag b
+    for (auto &in_i : in) {
+      ColorSpinorField tmp(in_i);
+      dirac.Mdag(in_i, tmp);
+    }
+  }
+
+  if (direct_solve) {
+    DiracM m(dirac), mSloppy(diracSloppy);
+    MultiSrcSolver *solve = MultiSrcSolver::create(solverParam, m, mSloppy, profileInvert);
+    (*solve)(out, in);
+    delete solve;
+  } else if (!norm_error_solve) {
+    DiracMdagM m(dirac), mSloppy(diracSloppy);
+    MultiSrcSolver *solve = MultiSrcSolver::create(solverParam, m, mSloppy, profileInvert);
+    (*solve)(out, in);
+    delete solve;
+  } else { // norm_error_solve
+    DiracMMdag m(dirac), mSloppy(diracSloppy);
+    std::vector<ColorSpinorField> tmp;
+    for (auto &out_i : out) tmp.emplace_back(out_i);
+    MultiSrcSolver *solve = MultiSrcSolver::create(solverParam, m, mSloppy, profileInvert);
+    (*solve)(tmp, in);                                         // y = (M M^\dag) b
+    for (int i = 0; i < n_src; i++) dirac.Mdag(out[i], tmp[i]); // x = M^dag y
+    delete solve;
+  }
+  solverParam.updateInvertParam(*param);
+
+  profileInvert.TPSTART(QUDA_PROFILE_EPILOGUE);
+  for (int i = 0; i < n_src; i++) reconstructInvertSolution(x[i], b[i], nb[i], dirac, *param);
+  profileInvert.TPSTOP(QUDA_PROFILE_EPILOGUE);
+
+  profileInvert.TPSTART(QUDA_PROFILE_D2H);
+  for (int i = 0; i < n_src; i++) h_x[i] = x[i];
+  profileInvert.TPSTOP(QUDA_PROFILE_D2H);
+
+  profileInvert.TPSTART(QUDA_PROFILE_FREE);
+
+  delete d;
+  delete dSloppy;
+  delete dPre;
+
+  profileInvert.TPSTOP(QUDA_PROFILE_FREE);
+
+  invertEpilogue();
 
   profilerStop(__func__);
 }
@@ -3123,6 +3398,19 @@ void loadFatLongGaugeQuda(QudaInvertParam *inv_param, QudaGaugeParam *gauge_para
   }
 }
 
+/**
+   @brief Invert a batch of sources, with the block solver if one is
+   requested, else one source at a time
+ */
+static void invertBatchQuda(void **hp_x, void **hp_b, int n_src, QudaInvertParam *param)
+{
+  if (param->inv_type == QUDA_BLOCK_CG_INVERTER && n_src > 1) {
+    invertBlockQuda(hp_x, hp_b, n_src, param);
+  } else {
+    for (int n = 0; n < n_src; n++) invertQuda(hp_x[n], hp_b[n], param);
+  }
+}
+
 template <class Interface, class... Args>
 void callMultiSrcQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, // color spinor field pointers, and inv_param
                       void *h_gauge, void *milc_fatlinks, void *milc_longlinks,
@@ -3131,7 +3419,8 @@ void callMultiSrcQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, // col
                       Interface op, Args... args)
 {
   /**
-    Here we first re-distribute gauge, color spinor, and clover field to sub-partitions, then call either invertQuda or dslashQuda.
+    Here we first re-distribute gauge, color spinor, and clover field to sub-partitions, then apply op to the batch of
+    sources, which either inverts them (one at a time, or at once with a block solver) or applies dslashQuda.
     - For clover and gauge field, we re-distribute the host clover side fields, restore them after.
     - For color spinor field, we re-distribute the host side source fields, and re-collect the host side solution fields.
   */
@@ -3147,7 +3436,7 @@ void callMultiSrcQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, // col
 
   if (num_sub_partition == 1) { // In this case we don't split the grid.
 
-    for (int n = 0; n < param->num_src; n++) { op(_hp_x[n], _hp_b[n], param, args...); }
+    op(_hp_x, _hp_b, param->num_src, param, args...);
 
   } else {
 
@@ -3359,9 +3648,13 @@ void callMultiSrcQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, // col
       if (getVerbosity() >= QUDA_DEBUG_VERBOSE) { printfQuda("Split grid loaded clover field...\n"); }
     }
 
+    std::vector<void *> _collect_x_v(param->num_src_per_sub_partition);
+    std::vector<void *> _collect_b_v(param->num_src_per_sub_partition);
     for (int n = 0; n < param->num_src_per_sub_partition; n++) {
-      op(_collect_x[n]->V(), _collect_b[n]->V(), param, args...);
+      _collect_x_v[n] = _collect_x[n]->V();
+      _collect_b_v[n] = _collect_b[n]->V();
     }
+    op(_collect_x_v.data(), _collect_b_v.data(), param->num_src_per_sub_partition, param, args...);
 
     profileInvertMultiSrc.TPSTART(QUDA_PROFILE_TOTAL);
     profileInvertMultiSrc.TPSTART(QUDA_PROFILE_EPILOGUE);
@@ -3421,35 +3714,39 @@ void callMultiSrcQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, // col
 
 void invertMultiSrcQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, void *h_gauge, QudaGaugeParam *gauge_param)
 {
-  auto op = [](void *_x, void *_b, QudaInvertParam *param) { invertQuda(_x, _b, param); };
+  auto op = [](void **_x, void **_b, int n, QudaInvertParam *param) { invertBatchQuda(_x, _b, n, param); };
   callMultiSrcQuda(_hp_x, _hp_b, param, h_gauge, nullptr, nullptr, gauge_param, nullptr, nullptr, op);
 }
 
 void invertMultiSrcStaggeredQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, void *milc_fatlinks,
                                  void *milc_longlinks, QudaGaugeParam *gauge_param)
 {
-  auto op = [](void *_x, void *_b, QudaInvertParam *param) { invertQuda(_x, _b, param); };
+  auto op = [](void **_x, void **_b, int n, QudaInvertParam *param) { invertBatchQuda(_x, _b, n, param); };
   callMultiSrcQuda(_hp_x, _hp_b, param, nullptr, milc_fatlinks, milc_longlinks, gauge_param, nullptr, nullptr, op);
 }
 
 void invertMultiSrcCloverQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, void *h_gauge,
                               QudaGaugeParam *gauge_param, void *h_clover, void *h_clovinv)
 {
-  auto op = [](void *_x, void *_b, QudaInvertParam *param) { invertQuda(_x, _b, param); };
+  auto op = [](void **_x, void **_b, int n, QudaInvertParam *param) { invertBatchQuda(_x, _b, n, param); };
   callMultiSrcQuda(_hp_x, _hp_b, param, h_gauge, nullptr, nullptr, gauge_param, h_clover, h_clovinv, op);
 }
 
 void dslashMultiSrcQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, QudaParity parity, void *h_gauge,
                         QudaGaugeParam *gauge_param)
 {
-  auto op = [](void *_x, void *_b, QudaInvertParam *param, QudaParity parity) { dslashQuda(_x, _b, param, parity); };
+  auto op = [](void **_x, void **_b, int n, QudaInvertParam *param, QudaParity parity) {
+    for (int i = 0; i < n; i++) dslashQuda(_x[i], _b[i], param, parity);
+  };
   callMultiSrcQuda(_hp_x, _hp_b, param, h_gauge, nullptr, nullptr, gauge_param, nullptr, nullptr, op, parity);
 }
 
 void dslashMultiSrcStaggeredQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, QudaParity parity,
                                  void *milc_fatlinks, void *milc_longlinks, QudaGaugeParam *gauge_param)
 {
-  auto op = [](void *_x, void *_b, QudaInvertParam *param, QudaParity parity) { dslashQuda(_x, _b, param, parity); };
+  auto op = [](void **_x, void **_b, int n, QudaInvertParam *param, QudaParity parity) {
+    for (int i = 0; i < n; i++) dslashQuda(_x[i], _b[i], param, parity);
+  };
   callMultiSrcQuda(_hp_x, _hp_b, param, nullptr, milc_fatlinks, milc_longlinks, gauge_param, nullptr, nullptr, op,
                    parity);
 }
@@ -3457,7 +3754,9 @@ void dslashMultiSrcStaggeredQuda(void **_hp_x, void **_hp_b, QudaInvertParam *pa
 void dslashMultiSrcCloverQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, QudaParity parity, void *h_gauge,
                               QudaGaugeParam *gauge_param, void *h_clover, void *h_clovinv)
 {
-  auto op = [](void *_x, void *_b, QudaInvertParam *param, QudaParity parity) { dslashQuda(_x, _b, param, parity); };
+  auto op = [](void **_x, void **_b, int n, QudaInvertParam *param, QudaParity parity) {
+    for (int i = 0; i < n; i++) dslashQuda(_x[i], _b[i], param, parity);
+  };
   callMultiSrcQuda(_hp_x, _hp_b, param, h_gauge, nullptr, nullptr, gauge_param, h_clover, h_clovinv, op, parity);
 }
 
@@ -230,6 +230,22 @@ namespace quda {
     rho = r2; // cDotProductCuda(r0, r_sloppy); // BiCRstab
     blas::copy(p, rSloppy);
 
+    // resume from a checkpoint taken at a reliable update; the shadow residual is only saved when it is not the source
+    vector_ref<ColorSpinorField> checkpoint_vecs(y, p);
+    if (&r0 != &b) checkpoint_vecs.push_back(r0);
+    std::vector<double> checkpoint_state(3);
+    if (checkpointResume("BiCGstab", b, b2, checkpoint_vecs, checkpoint_state, k)) {
+      mat(r, y);
+      r2 = blas::xmyNorm(b, r);
+      if (x.Precision() != rSloppy.Precision()) blas::copy(rSloppy, r);
+      rho = Complex(checkpoint_state[0], checkpoint_state[1]);
+      rUpdate = static_cast<int>(checkpoint_state[2]);
+      rNorm = sqrt(r2);
+      maxrr = rNorm;
+      maxrx = rNorm;
+      if (use_heavy_quark_res) heavy_quark_res = sqrt(blas::HeavyQuarkResidualNorm(y, r).z);
+    }
+
     if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
       printfQuda("BiCGstab debug: x2=%e, r2=%e, v2=%e, p2=%e, tmp2=%e r0=%e t2=%e\n",
 		 blas::norm2(x), blas::norm2(rSloppy), blas::norm2(v), blas::norm2(p),
@@ -342,8 +358,12 @@ namespace quda {
 	blas::cxpaypbz(rSloppy, -beta*omega, v, beta, p);
       }
 
+      if (updateR && !convergence(r2, heavy_quark_res, stop, param.tol_hq) && checkpointDue(k))
+        checkpointSave("BiCGstab", checkpoint_vecs, {rho.real(), rho.imag(), static_cast<double>(rUpdate)}, k);
     }
 
+    if (convergence(r2, heavy_quark_res, stop, param.tol_hq)) checkpointRemove();
+
     if (x.Precision() != xSloppy.Precision()) blas::copy(x, xSloppy);
     blas::xpy(y, x);
 
@@ -356,6 +356,16 @@ namespace quda {
       blas::xpayz(rSloppy, beta, x_update_batch.get_current_field(), x_update_batch.get_current_field());
     }
 
+    int k = 0;
+
+    // resume from a checkpoint taken at a reliable update, where the state is the iterate and the search direction
+    std::vector<double> checkpoint_state;
+    if (advanced_feature && checkpointResume("CG", b, b2, {y, x_update_batch.get_current_field()}, checkpoint_state, k)) {
+      mat(r, y);
+      r2 = blas::xmyNorm(b, r);
+      blas::copy(rSloppy, r);
+    }
+
     const bool use_heavy_quark_res =
       (param.residual_type & QUDA_HEAVY_QUARK_RESIDUAL) ? true : false;
     bool heavy_quark_restart = false;
@@ -390,8 +400,6 @@ namespace quda {
       blas::flops = 0;
     }
 
-    int k = 0;
-
     PrintStats("CG", k, r2, b2, heavy_quark_res);
 
     bool converged = convergence(r2, heavy_quark_res, stop, param.tol_hq);
@@ -593,11 +601,15 @@ namespace quda {
 
       if (ru.steps_since_reliable == 0) {
         x_update_batch.reset();
+        if (!converged && advanced_feature && checkpointDue(k))
+          checkpointSave("CG", {y, x_update_batch.get_current_field()}, checkpoint_state, k);
       } else {
         ++x_update_batch;
       }
     }
 
+    if (converged) checkpointRemove();
+
     blas::copy(x, xSloppy);
     blas::xpy(y, x);
 
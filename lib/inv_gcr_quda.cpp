@@ -325,6 +325,17 @@ namespace quda {
 
     int total_iter = 0;
     int restart = 0;
+
+    // resume from a checkpoint taken at a restart, where the Krylov space is discarded anyway
+    std::vector<double> checkpoint_state(1);
+    if (checkpointResume("GCR", b, b2, {x}, checkpoint_state, total_iter)) {
+      mat(r, x);
+      r2 = blas::xmyNorm(b, r);
+      if (use_heavy_quark_res) heavy_quark_res = sqrt(blas::HeavyQuarkResidualNorm(x, r).z);
+      blas::copy(r_sloppy, r);
+      restart = static_cast<int>(checkpoint_state[0]);
+    }
+
     double r2_old = r2;
     double maxr_deflate = sqrt(r2);
     bool l2_converge = false;
@@ -416,6 +427,8 @@ namespace quda {
           PrintStats("GCR (restart)", restart, r2, b2, heavy_quark_res);
           blas::copy(r_sloppy, r);
 
+          if (checkpointDue(total_iter)) checkpointSave("GCR", {x}, {static_cast<double>(restart)}, total_iter);
+
           r2_old = r2;
 
           // prevent ending the Krylov space prematurely if other convergence criteria not met 
@@ -426,6 +439,8 @@ namespace quda {
       }
     }
 
+    if (convergence(r2, heavy_quark_res, stop, param.tol_hq)) checkpointRemove();
+
     profile.TPSTOP(QUDA_PROFILE_COMPUTE);
     profile.TPSTART(QUDA_PROFILE_EPILOGUE);
 
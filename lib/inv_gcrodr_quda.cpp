@@ -0,0 +1,420 @@
+#include <algorithm>
+
+#include <quda_internal.h>
+#include <blas_quda.h>
+#include <invert_quda.h>
+#include <util_quda.h>
+#include <eigen_helper.h>
+
+namespace quda
+{
+
+  using matrix = Matrix<Complex, Dynamic, Dynamic>;
+  using vector = Matrix<Complex, Dynamic, 1>;
+
+  /**
+     The resident recycled subspaces, indexed by recycle_index
+   */
+  static std::vector<std::vector<ColorSpinorField>> recycleResident(GCRODR::max_recycle);
+
+  /**
+     A resident subspace whose relative departure from invariance,
+     |C - U (U^+ C)|_F / |C|_F with C = A U, exceeds this value is
+     considered stale and is discarded.  Harmonic Ritz vectors of a
+     non-normal operator typically give values of a few tenths, while a
+     subspace recycled from an unrelated operator approaches unity.
+   */
+  constexpr double stale_tol = 0.9;
+
+  void GCRODR::flushRecycle(int index)
+  {
+    if (index < 0 || index >= max_recycle)
+      errorQuda("Requested recycle index %d is outside of max %d", index, max_recycle);
+    recycleResident[index].clear();
+  }
+
+  GCRODR::GCRODR(const DiracMatrix &mat, const DiracMatrix &matSloppy, const DiracMatrix &matPrecon,
+                 SolverParam &param, TimeProfile &profile) :
+    Solver(mat, matSloppy, matPrecon, matPrecon, param, profile),
+    n_krylov(param.Nkrylov),
+    n_recycle(param.recycle_max_dim)
+  {
+    if (n_recycle < 0) errorQuda("Invalid recycled subspace dimension %d", n_recycle);
+    if (n_recycle >= n_krylov)
+      errorQuda("Recycled subspace dimension %d must be smaller than the Krylov dimension %d", n_recycle, n_krylov);
+    if (param.recycle_index < 0 || param.recycle_index >= max_recycle)
+      errorQuda("Requested recycle index %d is outside of max %d", param.recycle_index, max_recycle);
+  }
+
+  void GCRODR::create(ColorSpinorField &x, const ColorSpinorField &b)
+  {
+    Solver::create(x, b);
+    if (!init) {
+      ColorSpinorParam csParam(x);
+      csParam.create = QUDA_NULL_FIELD_CREATE;
+      r = ColorSpinorField(csParam);
+
+      csParam.setPrecision(param.precision_sloppy);
+      rS = mixed() ? ColorSpinorField(csParam) : r.create_alias();
+      xS = ColorSpinorField(csParam);
+      W.resize(n_krylov + 1, csParam);
+      U_new.resize(n_recycle, csParam);
+      C_new.resize(n_recycle, csParam);
+
+      init = true;
+    }
+  }
+
+  int GCRODR::prepareRecycle(std::vector<ColorSpinorField> &U)
+  {
+    if (U.size() > 0 && !ColorSpinorField::are_compatible(U[0], rS)) {
+      logQuda(QUDA_SUMMARIZE, "GCRODR: resident subspace %d does not match the system, discarding\n",
+              param.recycle_index);
+      U.clear();
+    }
+    if ((int)U.size() > n_recycle) U.erase(U.begin() + n_recycle, U.end());
+
+    const int k = U.size();
+    if (k == 0) return 0;
+
+    // C = A U with the current operator, held in W until it is orthonormalised
+    matSloppy({W.begin(), W.begin() + k}, U);
+
+    // orthonormalise C from the eigendecomposition of its Gram matrix,
+    // dropping directions that have become numerically dependent
+    std::vector<Complex> g(k * k);
+    blas::cDotProduct(g, {W.begin(), W.begin() + k}, {W.begin(), W.begin() + k});
+    matrix G(k, k);
+    for (int i = 0; i < k; i++)
+      for (int j = 0; j < k; j++) G(i, j) = g[i * k + j];
+
+    SelfAdjointEigenSolver<matrix> eigen(G);
+    const double lambda_max = eigen.eigenvalues()(k - 1);
+    const double eps = precisionEpsilon(param.precision_sloppy);
+    int rank = 0;
+    for (int i = 0; i < k; i++)
+      if (eigen.eigenvalues()(i) > eps * lambda_max) rank++;
+
+    if (rank == 0) {
+      logQuda(QUDA_SUMMARIZE, "GCRODR: resident subspace %d is degenerate, discarding\n", param.recycle_index);
+      U.clear();
+      return 0;
+    }
+
+    std::vector<Complex> a(k * rank);
+    for (int i = 0; i < k; i++)
+      for (int j = 0; j < rank; j++)
+        a[i * rank + j] = eigen.eigenvectors()(i, k - rank + j) / sqrt(eigen.eigenvalues()(k - rank + j));
+
+    blas::zero({C_new.begin(), C_new.begin() + rank});
+    blas::zero({U_new.begin(), U_new.begin() + rank});
+    blas::caxpy(a, {W.begin(), W.begin() + k}, {C_new.begin(), C_new.begin() + rank});
+    blas::caxpy(a, U, {U_new.begin(), U_new.begin() + rank});
+
+    U.erase(U.begin() + rank, U.end());
+    for (int i = 0; i < rank; i++) {
+      std::swap(W[i], C_new[i]);
+      std::swap(U[i], U_new[i]);
+    }
+
+    // departure of span(U) from invariance: with C orthonormal,
+    // |C - U (U^+ C)|_F^2 = k - tr((U* C)^dag (U* U)^-1 (U* C))
+    std::vector<Complex> uu(rank * rank);
+    std::vector<Complex> uc(rank * rank);
+    blas::cDotProduct(uu, U, U);
+    blas::cDotProduct(uc, U, {W.begin(), W.begin() + rank});
+    matrix Guu(rank, rank);
+    matrix Guc(rank, rank);
+    for (int i = 0; i < rank; i++) {
+      for (int j = 0; j < rank; j++) {
+        Guu(i, j) = uu[i * rank + j];
+        Guc(i, j) = uc[i * rank + j];
+      }
+    }
+    double e2 = rank - (Guc.adjoint() * Guu.ldlt().solve(Guc)).trace().real();
+    double stale = sqrt(std::max(e2, 0.0) / rank);
+    logQuda(QUDA_VERBOSE, "GCRODR: resident subspace %d has dimension %d and departure from invariance %e\n",
+            param.recycle_index, rank, stale);
+
+    if (stale > stale_tol) {
+      logQuda(QUDA_SUMMARIZE, "GCRODR: resident subspace %d is stale (%e > %e), discarding\n", param.recycle_index,
+              stale, stale_tol);
+      U.clear();
+      return 0;
+    }
+
+    return rank;
+  }
+
+  int GCRODR::cycle(std::vector<ColorSpinorField> &U, int k, double r2, double stop, int &n_iter)
+  {
+    // Arnoldi process for the operator projected orthogonally to C,
+    // with classical Gram-Schmidt applied twice against [C V]
+    const int s_max = n_krylov - k;
+    const double beta = sqrt(r2);
+    blas::copy(W[k], rS);
+    blas::ax(1.0 / beta, W[k]);
+
+    matrix G = matrix::Zero(n_krylov + 1, n_krylov);
+    std::vector<double> D(k);
+    if (k > 0) {
+      // A U~ = C D, where U~ = U D has unit-norm columns
+      for (int i = 0; i < k; i++) {
+        D[i] = 1.0 / sqrt(blas::norm2(U[i]));
+        G(i, i) = D[i];
+      }
+    }
+
+    int s = 0;
+    for (int j = 0; j < s_max; j++) {
+      auto &w = W[k + j + 1];
+      matSloppy(w, W[k + j]);
+
+      const int n = k + j + 1;
+      std::vector<Complex> h(n);
+      for (int pass = 0; pass < 2; pass++) {
+        blas::cDotProduct(h, {W.begin(), W.begin() + n}, {w});
+        for (int i = 0; i < n; i++) G(i, k + j) += h[i];
+        for (auto &hi : h) hi = -hi;
+        blas::caxpy(h, {W.begin(), W.begin() + n}, {w});
+      }
+
+      double h_next = sqrt(blas::norm2(w));
+      s = j + 1;
+      if (h_next == 0.0) { // invariant subspace found
+        blas::zero(w);
+        break;
+      }
+      G(n, k + j) = h_next;
+      blas::ax(1.0 / h_next, w);
+
+      // the residual of the cycle is that of the small least-squares problem, so we can stop as soon as it converges
+      if (j + 1 < s_max) {
+        vector c = vector::Zero(n + 1);
+        c(k) = beta;
+        matrix Gj = G.topLeftCorner(n + 1, n);
+        vector y = Gj.householderQr().solve(c);
+        if ((c - Gj * y).squaredNorm() < stop) break;
+      }
+    }
+    n_iter = s;
+
+    // minimize |beta e_k - G y| over the cycle subspace [U~ V]
+    const int n = k + s;
+    matrix Gm = G.topLeftCorner(n + 1, n);
+    vector c = vector::Zero(n + 1);
+    c(k) = beta;
+
+    profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+    profile.TPSTART(QUDA_PROFILE_EIGEN);
+    vector y = Gm.householderQr().solve(c);
+    profile.TPSTOP(QUDA_PROFILE_EIGEN);
+    profile.TPSTART(QUDA_PROFILE_COMPUTE);
+
+    // x += U~ y_U + V y_V
+    std::vector<Complex> y_u(k);
+    std::vector<Complex> y_v(s);
+    for (int i = 0; i < k; i++) y_u[i] = D[i] * y(i);
+    for (int i = 0; i < s; i++) y_v[i] = y(k + i);
+    if (k > 0) blas::caxpy(y_u, U, xS);
+    blas::caxpy(y_v, {W.begin() + k, W.begin() + n}, xS);
+
+    const int k_new = std::min(n_recycle, n);
+    if (k_new == 0) return 0;
+
+    // harmonic Ritz vectors of the cycle: G* G z = theta G* W* [U~ V] z,
+    // where W* [U~ V] = [[C* U~, 0], [V* U~, I]]
+    matrix WV = matrix::Zero(n + 1, n);
+    if (k > 0) {
+      std::vector<Complex> wu((n + 1) * k);
+      blas::cDotProduct(wu, {W.begin(), W.begin() + n + 1}, U);
+      for (int i = 0; i < n + 1; i++)
+        for (int j = 0; j < k; j++) WV(i, j) = wu[i * k + j] * D[j];
+    }
+    for (int j = k; j < n; j++) WV(j, j) = 1.0;
+
+    profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+    profile.TPSTART(QUDA_PROFILE_EIGEN);
+
+    // solve for 1 / theta, which only requires the Hermitian positive G* G to be inverted
+    matrix M = (Gm.adjoint() * Gm).ldlt().solve(Gm.adjoint() * WV);
+    ComplexEigenSolver<matrix> eigen(M);
+    std::vector<int> order(n);
+    for (int i = 0; i < n; i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+      return std::abs(eigen.eigenvalues()(a)) > std::abs(eigen.eigenvalues()(b));
+    });
+
+    matrix P(n, k_new);
+    for (int j = 0; j < k_new; j++) P.col(j) = eigen.eigenvectors().col(order[j]);
+
+    // G P = Q R, then C = W Q and U = [U~ V] P R^-1, so that A U = C
+    HouseholderQR<matrix> qr(Gm * P);
+    matrix Q = qr.householderQ() * matrix::Identity(n + 1, k_new);
+    matrix R = qr.matrixQR().topLeftCorner(k_new, k_new).triangularView<Upper>();
+    matrix PR = R.adjoint().triangularView<Lower>().solve(P.adjoint()).adjoint();
+
+    profile.TPSTOP(QUDA_PROFILE_EIGEN);
+    profile.TPSTART(QUDA_PROFILE_COMPUTE);
+
+    std::vector<Complex> a_c((n + 1) * k_new);
+    for (int i = 0; i < n + 1; i++)
+      for (int j = 0; j < k_new; j++) a_c[i * k_new + j] = Q(i, j);
+
+    std::vector<Complex> a_u(k * k_new);
+    for (int i = 0; i < k; i++)
+      for (int j = 0; j < k_new; j++) a_u[i * k_new + j] = D[i] * PR(i, j);
+
+    std::vector<Complex> a_v(s * k_new);
+    for (int i = 0; i < s; i++)
+      for (int j = 0; j < k_new; j++) a_v[i * k_new + j] = PR(k + i, j);
+
+    blas::zero({C_new.begin(), C_new.begin() + k_new});
+    blas::zero({U_new.begin(), U_new.begin() + k_new});
+    blas::caxpy(a_c, {W.begin(), W.begin() + n + 1}, {C_new.begin(), C_new.begin() + k_new});
+    if (k > 0) blas::caxpy(a_u, U, {U_new.begin(), U_new.begin() + k_new});
+    blas::caxpy(a_v, {W.begin() + k, W.begin() + n}, {U_new.begin(), U_new.begin() + k_new});
+
+    // the resident subspace takes ownership of the new vectors
+    if ((int)U.size() < k_new) {
+      ColorSpinorParam csParam(rS);
+      csParam.create = QUDA_NULL_FIELD_CREATE;
+      U.resize(k_new, csParam);
+    } else {
+      U.erase(U.begin() + k_new, U.end());
+    }
+    for (int i = 0; i < k_new; i++) {
+      std::swap(W[i], C_new[i]);
+      std::swap(U[i], U_new[i]);
+    }
+
+    return k_new;
+  }
+
+  void GCRODR::operator()(ColorSpinorField &x, ColorSpinorField &b)
+  {
+    if (checkLocation(x, b) != QUDA_CUDA_FIELD_LOCATION) errorQuda("Not supported");
+    if (param.residual_type & QUDA_HEAVY_QUARK_RESIDUAL)
+      errorQuda("Heavy-quark residual not supported by the GCRO-DR solver");
+
+    profile.TPSTART(QUDA_PROFILE_INIT);
+
+    // Check to see that we're not trying to invert on a zero-field source
+    double b2 = blas::norm2(b);
+    if (b2 == 0 && (param.compute_null_vector == QUDA_COMPUTE_NULL_VECTOR_NO || param.use_init_guess == QUDA_USE_INIT_GUESS_NO)) {
+      profile.TPSTOP(QUDA_PROFILE_INIT);
+      printfQuda("Warning: inverting on zero-field source\n");
+      x = b;
+      param.true_res = 0.0;
+      param.true_res_hq = 0.0;
+      return;
+    }
+
+    create(x, b);
+
+    double stop = stopping(param.tol, b2, param.residual_type); // stopping condition of solver
+
+    profile.TPSTOP(QUDA_PROFILE_INIT);
+    profile.TPSTART(QUDA_PROFILE_PREAMBLE);
+
+    blas::flops = 0;
+
+    // compute initial residual depending on whether we have an initial guess or not
+    double r2;
+    if (param.use_init_guess == QUDA_USE_INIT_GUESS_YES) {
+      mat(r, x);
+      r2 = blas::xmyNorm(b, r);
+      if (b2 == 0) b2 = r2;
+    } else {
+      blas::copy(r, b);
+      r2 = b2;
+      blas::zero(x);
+    }
+    blas::zero(xS);
+    blas::copy(rS, r);
+
+    auto &U = recycleResident[param.recycle_index];
+    int k = prepareRecycle(U);
+
+    profile.TPSTOP(QUDA_PROFILE_PREAMBLE);
+    profile.TPSTART(QUDA_PROFILE_COMPUTE);
+
+    int iter = 0;
+    int cycles = 0;
+    const int maxResIncreaseTotal = param.max_res_increase_total;
+    int resIncreaseTotal = 0;
+    double r2_old = r2;
+
+    while (true) {
+      // project the residual orthogonally to C, x += U C* r, r -= C C* r
+      if (k > 0) {
+        std::vector<Complex> alpha(k);
+        blas::cDotProduct(alpha, {W.begin(), W.begin() + k}, {rS});
+        blas::caxpy(alpha, U, xS);
+        for (auto &a : alpha) a = -a;
+        blas::caxpy(alpha, {W.begin(), W.begin() + k}, rS);
+        r2 = blas::norm2(rS);
+      }
+
+      PrintStats("GCRODR", iter, r2, b2, 0.0);
+      if (convergence(r2, 0.0, stop, param.tol_hq) || iter >= param.maxiter) break;
+
+      int n_iter = 0;
+      k = cycle(U, k, r2, stop, n_iter);
+      iter += n_iter;
+      cycles++;
+
+      // accumulate the cycle solution and recompute the true residual
+      blas::copy(r, xS);
+      blas::xpy(r, x);
+      blas::zero(xS);
+      mat(r, x);
+      r2 = blas::xmyNorm(b, r);
+      blas::copy(rS, r);
+
+      if (r2 > r2_old) {
+        resIncreaseTotal++;
+        warningQuda("GCRODR: new residual norm %e is greater than previous residual norm %e (total #inc %i)",
+                    sqrt(r2), sqrt(r2_old), resIncreaseTotal);
+        if (resIncreaseTotal > maxResIncreaseTotal) {
+          warningQuda("GCRODR: solver exiting due to too many residual norm increases");
+          break;
+        }
+      }
+      r2_old = r2;
+    }
+
+    profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+    profile.TPSTART(QUDA_PROFILE_EPILOGUE);
+
+    // the solution of a final projection has not been accumulated yet
+    blas::copy(r, xS);
+    blas::xpy(r, x);
+
+    param.secs = profile.Last(QUDA_PROFILE_COMPUTE);
+    double gflops = (blas::flops + mat.flops() + matSloppy.flops()) * 1e-9;
+    param.gflops = gflops;
+    param.iter += iter;
+
+    if (iter >= param.maxiter) warningQuda("Exceeded maximum iterations %d", param.maxiter);
+
+    logQuda(QUDA_VERBOSE, "GCRODR: %d cycles, recycled subspace %d has dimension %d\n", cycles, param.recycle_index,
+            k);
+
+    // compute the true residuals
+    if (param.compute_true_res) {
+      mat(r, x);
+      param.true_res = sqrt(blas::xmyNorm(b, r) / b2);
+    }
+
+    PrintSummary("GCRODR", iter, r2, b2, stop, param.tol_hq);
+
+    // reset the flops counters
+    blas::flops = 0;
+    mat.flops();
+    matSloppy.flops();
+
+    profile.TPSTOP(QUDA_PROFILE_EPILOGUE);
+  }
+
+} // namespace quda
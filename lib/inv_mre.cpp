@@ -1,3 +1,5 @@
+#include <limits>
+
 #include <invert_quda.h>
 #include <blas_quda.h>
 #include <eigen_helper.h>
@@ -76,11 +78,8 @@ namespace quda
     const int N = p.size();
     logQuda(QUDA_VERBOSE, "Constructing minimum residual extrapolation with basis size %d\n", N);
 
-    if (N <= 1) {
-      if (N == 0)
-        blas::zero(x);
-      else
-        blas::copy(x, p[0]);
+    if (N == 0) {
+      blas::zero(x);
       if (!running) profile.TPSTOP(QUDA_PROFILE_CHRONO);
       return;
     }
@@ -136,4 +135,169 @@ namespace quda
     if (!running) profile.TPSTOP(QUDA_PROFILE_CHRONO);
   }
 
+  void MinResExt::operator()(ColorSpinorField &x, const ColorSpinorField &b, cvector_ref<const ColorSpinorField> &p)
+  {
+    bool running = profile.isRunning(QUDA_PROFILE_CHRONO);
+    if (!running) profile.TPSTART(QUDA_PROFILE_CHRONO);
+
+    const int N = p.size();
+    logQuda(QUDA_VERBOSE, "Constructing minimum residual extrapolation with orthonormal basis size %d\n", N);
+
+    if (N == 0) {
+      blas::zero(x);
+      if (!running) profile.TPSTOP(QUDA_PROFILE_CHRONO);
+      return;
+    }
+
+    // work vectors at the precision of the operator
+    ColorSpinorParam param(b);
+    param.create = QUDA_NULL_FIELD_CREATE;
+    ColorSpinorField pj(param);
+    ColorSpinorField Apj(param);
+
+    // the normal system of a non-Hermitian operator needs every pair
+    // (A p_i, A p_j), so A P is retained, but at the precision of the basis
+    std::vector<ColorSpinorField> Ap;
+    if (!hermitian) {
+      ColorSpinorParam ap_param(p[0]);
+      ap_param.create = QUDA_NULL_FIELD_CREATE;
+      for (int j = 0; j < N - 1; j++) Ap.emplace_back(ap_param);
+    }
+
+    // form the Nx(N+1) matrix [P* A P | P* b], or [(A P)* (A P) | (A P)* b]
+    // if not Hermitian, column by column, with the global reduction
+    // deferred until all columns are complete
+    std::vector<Complex> A_(N * (N + 1));
+    std::vector<Complex> col(N);
+
+    commGlobalReductionPush(false);
+    for (int j = 0; j < N; j++) {
+      blas::copy(pj, p[j]);
+      mat(Apj, pj);
+      if (!hermitian) {
+        // the diagonal and the rhs are formed at the operator precision
+        std::vector<Complex> diag_b(2);
+        blas::cDotProduct(diag_b, {Apj}, {Apj, b});
+        A_[j * (N + 1) + j] = diag_b[0];
+        A_[j * (N + 1) + N] = diag_b[1];
+        if (j > 0) {
+          // the column above the diagonal, with the row below it from the symmetry
+          std::vector<Complex> col_j(j);
+          blas::cDotProduct(col_j, {Ap.begin(), Ap.begin() + j}, {Apj});
+          for (int i = 0; i < j; i++) {
+            A_[i * (N + 1) + j] = col_j[i];
+            A_[j * (N + 1) + i] = conj(col_j[i]);
+          }
+        }
+        if (j < N - 1) blas::copy(Ap[j], Apj);
+      } else if (j == 0) {
+        // fold the rhs phi = P* b into the first column
+        std::vector<Complex> col_b(2 * N);
+        blas::cDotProduct(col_b, p, {Apj, b});
+        for (int i = 0; i < N; i++) {
+          A_[i * (N + 1) + j] = col_b[i * 2 + 0];
+          A_[i * (N + 1) + N] = col_b[i * 2 + 1];
+        }
+      } else {
+        blas::cDotProduct(col, p, {Apj});
+        for (int i = 0; i < N; i++) A_[i * (N + 1) + j] = col[i];
+      }
+    }
+    commGlobalReductionPop();
+    if (commGlobalReduction()) comm_allreduce_sum(A_);
+
+    typedef Matrix<Complex, Dynamic, Dynamic> matrix;
+    typedef Matrix<Complex, Dynamic, 1> vector;
+
+    vector phi(N), psi(N);
+    matrix A(N, N);
+    for (int i = 0; i < N; i++) {
+      phi(i) = A_[i * (N + 1) + N];
+      for (int j = 0; j < N; j++) A(i, j) = A_[i * (N + 1) + j];
+    }
+
+    profile.TPSTOP(QUDA_PROFILE_CHRONO);
+    profile.TPSTART(QUDA_PROFILE_EIGEN);
+
+    LDLT<matrix> cholesky(A);
+    psi = cholesky.solve(phi);
+
+    profile.TPSTOP(QUDA_PROFILE_EIGEN);
+    profile.TPSTART(QUDA_PROFILE_CHRONO);
+
+    std::vector<Complex> alpha(N);
+    for (int i = 0; i < N; i++) alpha[i] = psi(i);
+
+    blas::zero(x);
+    blas::caxpy(alpha, p, x);
+
+    if (getVerbosity() >= QUDA_SUMMARIZE) {
+      // compute the residual only if we're going to print it
+      ColorSpinorField r(param);
+      blas::copy(r, x);
+      mat(Apj, r);
+      printfQuda("MinResExt: N = %d, |res| / |src| = %e\n", N, sqrt(blas::xmyNorm(b, Apj) / blas::norm2(b)));
+    }
+
+    if (!running) profile.TPSTOP(QUDA_PROFILE_CHRONO);
+  }
+
+  bool MinResExt::insert(std::vector<ColorSpinorField> &p, const ColorSpinorField &v, int max_dim,
+                         bool replace_first, QudaPrecision precision)
+  {
+    if (precision > v.Precision())
+      errorQuda("Basis precision %d cannot exceed the precision %d of the vector being added", precision, v.Precision());
+
+    // the basis vectors that are retained
+    auto begin = p.begin() + ((replace_first && p.size() > 0) ? 1 : 0);
+    auto end = p.end() - ((p.end() - begin >= max_dim && begin != p.end()) ? 1 : 0);
+    const int N = end - begin;
+
+    // orthogonalise in the precision of v
+    ColorSpinorField w(v);
+    double v2 = blas::norm2(w);
+    if (v2 == 0.0) return false;
+
+    if (N > 0) {
+      // classical Gram-Schmidt applied twice to compensate for the loss
+      // of orthogonality of the single pass
+      std::vector<Complex> alpha(N);
+      for (int pass = 0; pass < 2; pass++) {
+        blas::cDotProduct(alpha, {begin, end}, {w});
+        for (auto &a : alpha) a = -a;
+        blas::caxpy(alpha, {begin, end}, {w});
+      }
+    }
+
+    // the retained basis is only orthonormal to the precision at which
+    // it is stored, so any smaller remainder is rounding noise
+    double eps = 0.;
+    switch (precision) {
+    case QUDA_DOUBLE_PRECISION: eps = std::numeric_limits<double>::epsilon() / 2.; break;
+    case QUDA_SINGLE_PRECISION: eps = std::numeric_limits<float>::epsilon() / 2.; break;
+    case QUDA_HALF_PRECISION: eps = pow(2., -13); break;
+    case QUDA_QUARTER_PRECISION: eps = pow(2., -6); break;
+    default: errorQuda("Invalid basis precision %d", precision);
+    }
+
+    double w2 = blas::norm2(w);
+    if (w2 < 16 * eps * eps * v2) {
+      logQuda(QUDA_VERBOSE, "MinResExt: vector is dependent on the basis (|w| / |v| = %e), not added\n", sqrt(w2 / v2));
+      return false;
+    }
+    blas::ax(1.0 / sqrt(w2), w);
+
+    // drop the replaced and expired vectors and store the new one at the front
+    p.erase(end, p.end());
+    p.erase(p.begin(), begin);
+
+    ColorSpinorParam param(v);
+    param.setPrecision(precision, precision, true);
+    param.create = QUDA_NULL_FIELD_CREATE;
+    p.emplace(p.begin(), param);
+    blas::copy(p[0], w);
+
+    return true;
+  }
+
 } // namespace quda
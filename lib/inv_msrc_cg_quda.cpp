@@ -1,338 +1,317 @@
-#include <stdio.h>
-#include <stdlib.h>
-#include <math.h>
+#include <algorithm>
 
 #include <quda_internal.h>
 #include <color_spinor_field.h>
 #include <blas_quda.h>
-#include <dslash_quda.h>
 #include <invert_quda.h>
 #include <util_quda.h>
-#include <sys/time.h>
-#include <iostream>
-
-namespace quda {
-
-  MultiSrcCG::MultiSrcCG(DiracMatrix &mat, DiracMatrix &matSloppy, SolverParam &param, TimeProfile &profile) :
-    MultiSrcSolver(param, profile), mat(mat), matSloppy(matSloppy)
+#include <eigen_helper.h>
+
+/**
+   @file inv_msrc_cg_quda.cpp
+
+   Implementation of block CG for multiple right-hand sides.  We use
+   the BCGrQ variant of Dubrulle, ETNA 12, 216 (2001), where the block
+   residual is carried as R = Q C with Q orthonormal:
+
+     Q_0 C_0 = R_0, P_0 = Q_0
+     alpha_k = (P_k^dag A P_k)^{-1}
+     X_{k+1} = X_k + P_k alpha_k C_k
+     Q_{k+1} S_{k+1} = Q_k - A P_k alpha_k
+     P_{k+1} = Q_{k+1} + P_k S_{k+1}^dag
+     C_{k+1} = S_{k+1} C_k
+
+   All block operations are matrix-multi-vector products that map onto
+   the multi-blas and multi-reduce kernels.  The QR factorizations are
+   rank revealing, so the block size shrinks when the residual block
+   becomes degenerate.
+*/
+
+namespace quda
+{
+
+  using matrix = Matrix<Complex, Dynamic, Dynamic, RowMajor>;
+
+  /**
+     @brief Flatten an Eigen matrix into the row-major coefficient
+     array expected by the multi-blas functions, where y = x * a + y
+     is y_j += sum_i a(i, j) x_i
+   */
+  static std::vector<Complex> coeff(const matrix &a) { return std::vector<Complex>(a.data(), a.data() + a.size()); }
+
+  /**
+     @brief Rank-revealing orthonormalization W = Q S of the first n
+     vectors of w.  The Gram matrix W^dag W = V Lambda V^dag gives Q = W
+     V Lambda^{-1/2} and S = Lambda^{1/2} V^dag, where eigenvalues
+     below eps times the largest are dropped as linearly dependent.
+     @param[out] q The orthonormal basis, of which the first rank vectors are set
+     @param[in] w The vectors to orthonormalize
+     @param[in] n The number of vectors in w
+     @param[in] eps Relative eigenvalue threshold
+     @return The rank x n matrix S, whose row count is the rank
+   */
+  static matrix orthonormalize(std::vector<ColorSpinorField> &q, std::vector<ColorSpinorField> &w, int n, double eps)
   {
+    std::vector<Complex> gram(n * n);
+    blas::hDotProduct(gram, {w.begin(), w.begin() + n}, {w.begin(), w.begin() + n});
+    SelfAdjointEigenSolver<matrix> eigen(Map<matrix>(gram.data(), n, n));
 
-  }
+    // the eigenvalues are in increasing order
+    const VectorXd &lambda = eigen.eigenvalues();
+    int rank = 0;
+    for (int i = 0; i < n; i++)
+      if (lambda(i) > eps * lambda(n - 1) && lambda(i) > 0.0) rank++;
+    if (rank == 0) return matrix(0, n);
 
-  MultiSrcCG::~MultiSrcCG() {
+    VectorXd sqrt_lambda = lambda.tail(rank).cwiseSqrt();
+    matrix V = eigen.eigenvectors().rightCols(rank);
+    matrix M = V * sqrt_lambda.cwiseInverse().cast<Complex>().asDiagonal();
 
+    for (int i = 0; i < rank; i++) blas::zero(q[i]);
+    blas::caxpy(coeff(M), {w.begin(), w.begin() + n}, {q.begin(), q.begin() + rank});
+
+    return sqrt_lambda.cast<Complex>().asDiagonal() * V.adjoint();
   }
 
-  void MultiSrcCG::operator()(std::vector<ColorSpinorField *> out, std::vector<ColorSpinorField *> in)
+  MultiSrcCG::MultiSrcCG(const DiracMatrix &mat, const DiracMatrix &matSloppy, SolverParam &param,
+                         TimeProfile &profile) :
+    MultiSrcSolver(mat, matSloppy, param, profile)
   {
+  }
 
-#if 0
-
-    if (Location(x, b) != QUDA_CUDA_FIELD_LOCATION)
-      errorQuda("Not supported");
-
-    profile.TPSTART(QUDA_PROFILE_INIT);
-
-    // Check to see that we're not trying to invert on a zero-field source
-    const double b2 = blas::norm2(b);
-    if(b2 == 0){
-      profile.TPSTOP(QUDA_PROFILE_INIT);
-      printfQuda("Warning: inverting on zero-field source\n");
-      x=b;
-      param.true_res = 0.0;
-      param.true_res_hq = 0.0;
-      return;
-    }
-
-    ColorSpinorField r(b);
-
-    ColorSpinorParam csParam(x);
-    csParam.create = QUDA_ZERO_FIELD_CREATE;
-    ColorSpinorField y(b, csParam);
-
-    mat(r, x, y);
-    double r2 = blas::xmyNorm(b, r);
-
-    csParam.setPrecision(param.precision_sloppy);
-    ColorSpinorField Ap(x, csParam);
-    ColorSpinorField tmp(x, csParam);
-
-    // tmp2 only needed for multi-gpu Wilson-like kernels
-    ColorSpinorField *tmp2_p = !mat.isStaggered() ? new ColorSpinorField(x, csParam) : &tmp;
-    ColorSpinorField &tmp2 = *tmp2_p;
-
-    ColorSpinorField *r_sloppy;
-    if (param.precision_sloppy == x.Precision()) {
-      r_sloppy = &r;
-    } else {
-      csParam.create = QUDA_COPY_FIELD_CREATE;
-      r_sloppy = new ColorSpinorField(r, csParam);
-    }
+  void MultiSrcCG::create(const std::vector<ColorSpinorField> &x, const std::vector<ColorSpinorField> &b)
+  {
+    if (checkPrecision(x[0], b[0]) != param.precision)
+      errorQuda("Precision mismatch %d %d", checkPrecision(x[0], b[0]), param.precision);
+
+    // the block fields are reallocated only if the number of sources changes
+    if (n_src != static_cast<int>(b.size())) {
+      n_src = b.size();
+      ColorSpinorParam csParam(x[0]);
+      csParam.create = QUDA_NULL_FIELD_CREATE;
+      for (auto v : {&r, &y}) {
+        v->clear();
+        v->resize(n_src, csParam);
+      }
 
-    ColorSpinorField *x_sloppy;
-    if (param.precision_sloppy == x.Precision() ||
-	!param.use_sloppy_partial_accumulator) {
-      x_sloppy = &static_cast<ColorSpinorField&>(x);
-    } else {
-      csParam.create = QUDA_COPY_FIELD_CREATE;
-      x_sloppy = new ColorSpinorField(x, csParam);
+      csParam.setPrecision(param.precision_sloppy);
+      for (auto v : {&xS, &Q, &P, &AP, &T}) {
+        v->clear();
+        v->resize(n_src, csParam);
+      }
     }
+  }
 
-    // additional high-precision temporary if Wilson and mixed-precision
-    csParam.setPrecision(param.precision);
-    ColorSpinorField *tmp3_p =
-      (param.precision != param.precision_sloppy && !mat.isStaggered()) ?
-      new ColorSpinorField(x, csParam) : &tmp;
-    ColorSpinorField &tmp3 = *tmp3_p;
+  void MultiSrcCG::operator()(std::vector<ColorSpinorField> &x, std::vector<ColorSpinorField> &b)
+  {
+    if (x.size() != b.size() || b.size() == 0) errorQuda("Mismatched solution (%lu) and source (%lu) sets", x.size(), b.size());
+    if (checkLocation(x[0], b[0]) != QUDA_CUDA_FIELD_LOCATION) errorQuda("Not supported");
+    if (param.residual_type & QUDA_HEAVY_QUARK_RESIDUAL)
+      errorQuda("Heavy-quark residual not supported by the block CG solver");
 
-    ColorSpinorField &xSloppy = *x_sloppy;
-    ColorSpinorField &rSloppy = *r_sloppy;
+    profile.TPSTART(QUDA_PROFILE_INIT);
 
-    ColorSpinorField p(rSloppy);
+    create(x, b);
+    const int n = n_src;
 
-    if(&x != &xSloppy){
-      blas::copy(y,x);
-      blas::zero(xSloppy);
-    }else{
-      blas::zero(y);
+    std::vector<double> b2(n), stop(n), r2(n);
+    for (int i = 0; i < n; i++) {
+      b2[i] = blas::norm2(b[i]);
+      if (b2[i] == 0.0) errorQuda("Source %d has zero norm", i);
+      stop[i] = Solver::stopping(param.tol, b2[i], param.residual_type);
     }
 
-    const bool use_heavy_quark_res =
-      (param.residual_type & QUDA_HEAVY_QUARK_RESIDUAL) ? true : false;
-    bool heavy_quark_restart = false;
-
-    profile.TPSTOP(QUDA_PROFILE_INIT);
-    profile.TPSTART(QUDA_PROFILE_PREAMBLE);
-
-    double r2_old;
-
-    double stop = stopping(param.tol, b2, param.residual_type); // stopping condition of solver
-
-    double heavy_quark_res = 0.0; // heavy quark residual
-    double heavy_quark_res_old = 0.0; // heavy quark residual
-
-    if (use_heavy_quark_res) {
-      heavy_quark_res = sqrt(blas::HeavyQuarkResidualNorm(x, r).z);
-      heavy_quark_res_old = heavy_quark_res; // heavy quark residual
+    // relative eigenvalue threshold of the Gram matrix below which
+    // block directions are dropped: the Cholesky QR squares the
+    // condition number, so this is a relative singular value of
+    // sqrt(eps) of the sloppy precision
+    double eps = 0.;
+    switch (param.precision_sloppy) {
+    case QUDA_DOUBLE_PRECISION: eps = std::numeric_limits<double>::epsilon() / 2.; break;
+    case QUDA_SINGLE_PRECISION: eps = std::numeric_limits<float>::epsilon() / 2.; break;
+    case QUDA_HALF_PRECISION: eps = pow(2., -13); break;
+    case QUDA_QUARTER_PRECISION: eps = pow(2., -6); break;
+    default: errorQuda("Invalid sloppy precision %d", param.precision_sloppy);
     }
-    const int heavy_quark_check = param.heavy_quark_check; // how often to check the heavy quark residual
-
-    double alpha=0.0, beta=0.0;
-    double pAp;
-    int rUpdate = 0;
-
-    double rNorm = sqrt(r2);
-    double r0Norm = rNorm;
-    double maxrx = rNorm;
-    double maxrr = rNorm;
-    double delta = param.delta;
 
     // this parameter determines how many consective reliable update
     // reisudal increases we tolerate before terminating the solver,
     // i.e., how long do we want to keep trying to converge
-    const int maxResIncrease = (use_heavy_quark_res ? 0 : param.max_res_increase); // check if we reached the limit of our tolerance
+    const int maxResIncrease = param.max_res_increase; // check if we reached the limit of our tolerance
     const int maxResIncreaseTotal = param.max_res_increase_total;
-    // 0 means we have no tolerance
-    // maybe we should expose this as a parameter
-    const int hqmaxresIncrease = maxResIncrease + 1;
-
     int resIncrease = 0;
     int resIncreaseTotal = 0;
-    int hqresIncrease = 0;
 
-    // set this to true if maxResIncrease has been exceeded but when we use heavy quark residual we still want to continue the CG
-    // only used if we use the heavy_quark_res
-    bool L2breakdown =false;
+    profile.TPSTOP(QUDA_PROFILE_INIT);
+    profile.TPSTART(QUDA_PROFILE_PREAMBLE);
 
-    profile.TPSTOP(QUDA_PROFILE_PREAMBLE);
-    profile.TPSTART(QUDA_PROFILE_COMPUTE);
     blas::flops = 0;
 
-    int k=0;
-
-    PrintStats("CG", k, r2, b2, heavy_quark_res);
-
-    int steps_since_reliable = 1;
-    bool converged = convergence(r2, heavy_quark_res, stop, param.tol_hq);
-
-    while ( !converged && k < param.maxiter) {
-      matSloppy(Ap, p, tmp, tmp2); // tmp as tmp
-
-      double sigma;
-
-      bool breakdown = false;
-      if (param.pipeline) {
-	double3 triplet = blas::tripleCGReduction(rSloppy, Ap, p);
-	r2 = triplet.x; double Ap2 = triplet.y; pAp = triplet.z;
-	r2_old = r2;
-
-	alpha = r2 / pAp;
-	sigma = alpha*(alpha * Ap2 - pAp);
-	if (sigma < 0.0 || steps_since_reliable==0) { // sigma condition has broken down
-	  r2 = blas::axpyNorm(-alpha, Ap, rSloppy);
-	  sigma = r2;
-	  breakdown = true;
-	}
-
-	r2 = sigma;
-      } else {
-	r2_old = r2;
-	pAp = blas::reDotProduct(p, Ap);
-	alpha = r2 / pAp;
-
-	// here we are deploying the alternative beta computation
-	Complex cg_norm = blas::axpyCGNorm(-alpha, Ap, rSloppy);
-	r2 = real(cg_norm); // (r_new, r_new)
-	sigma = imag(cg_norm) >= 0.0 ? imag(cg_norm) : r2; // use r2 if (r_k+1, r_k+1-r_k) breaks
+    // compute initial residuals depending on whether we have an initial guess or not
+    if (param.use_init_guess == QUDA_USE_INIT_GUESS_YES) {
+      mat(r, x);
+      for (int i = 0; i < n; i++) {
+        r2[i] = blas::xmyNorm(b[i], r[i]);
+        blas::copy(y[i], x[i]);
+      }
+    } else {
+      for (int i = 0; i < n; i++) {
+        blas::copy(r[i], b[i]);
+        r2[i] = b2[i];
+        blas::zero(x[i]);
+        blas::zero(y[i]);
       }
+    }
+    for (auto &v : xS) blas::zero(v);
+
+    // the largest residual relative to its source tracks the progress of the block
+    auto rel = [&]() {
+      double max_rel = 0.0;
+      for (int i = 0; i < n; i++) max_rel = std::max(max_rel, r2[i] / b2[i]);
+      return max_rel;
+    };
+
+    auto converged = [&]() {
+      for (int i = 0; i < n; i++) {
+        if (std::isnan(r2[i]) || std::isinf(r2[i])) errorQuda("Block CG appears to have diverged on source %d", i);
+        if (r2[i] > stop[i]) return false;
+      }
+      return true;
+    };
+
+    // (re)start the block recurrence from the true residual: Q C = R, P = Q
+    int rank = 0;
+    matrix C;
+    auto restart = [&]() {
+      for (int i = 0; i < n; i++) blas::copy(T[i], r[i]);
+      C = orthonormalize(Q, T, n, eps);
+      rank = C.rows();
+      for (int i = 0; i < rank; i++) blas::copy(P[i], Q[i]);
+    };
+
+    profile.TPSTOP(QUDA_PROFILE_PREAMBLE);
+    if (converged()) {
+      param.true_res = sqrt(rel());
+      return;
+    }
+    profile.TPSTART(QUDA_PROFILE_COMPUTE);
 
-      // reliable update conditions
-      rNorm = sqrt(r2);
-      if (rNorm > maxrx) maxrx = rNorm;
-      if (rNorm > maxrr) maxrr = rNorm;
-      int updateX = (rNorm < delta*r0Norm && r0Norm <= maxrx) ? 1 : 0;
-      int updateR = ((rNorm < delta*maxrr && r0Norm <= maxrr) || updateX) ? 1 : 0;
+    restart();
 
-      // force a reliable update if we are within target tolerance (only if doing reliable updates)
-      if ( convergence(r2, heavy_quark_res, stop, param.tol_hq) && param.delta >= param.tol) updateX = 1;
+    double r0 = rel(); // relative residual at the last reliable update
+    const double delta2 = param.delta * param.delta;
 
-      // For heavy-quark inversion force a reliable update if we continue after
-      if (use_heavy_quark_res and L2breakdown and convergenceHQ(r2, heavy_quark_res, stop, param.tol_hq) and param.delta >= param.tol) {
-	updateX = 1;
+    int k = 0;
+    int rUpdate = 0;
+    logQuda(QUDA_VERBOSE, "Block CG: %d sources, %5d iterations, max |r|/|b| = %9.6e\n", n, k, sqrt(r0));
+
+    while (rank > 0 && !converged() && k < param.maxiter) {
+      auto p = vector_ref<ColorSpinorField>(P.begin(), P.begin() + rank);
+      auto ap = vector_ref<ColorSpinorField>(AP.begin(), AP.begin() + rank);
+      auto q = vector_ref<ColorSpinorField>(Q.begin(), Q.begin() + rank);
+
+      matSloppy(ap, p);
+
+      // alpha = (P^dag A P)^{-1}
+      std::vector<Complex> pAp(rank * rank);
+      blas::hDotProduct_Anorm(pAp, p, ap);
+      matrix alpha = Map<matrix>(pAp.data(), rank, rank).ldlt().solve(matrix::Identity(rank, rank));
+
+      // X += P alpha C
+      blas::caxpy(coeff(alpha * C), p, xS);
+
+      // W = Q - A P alpha, which is orthonormalized into the next Q S
+      blas::caxpy(coeff(-alpha), ap, q);
+      matrix S = orthonormalize(T, Q, rank, eps);
+      const int rank_new = S.rows();
+      if (rank_new < rank) logQuda(QUDA_VERBOSE, "Block CG: block size reduced from %d to %d\n", rank, rank_new);
+      std::swap(Q, T);
+
+      // P = Q + P S^dag, where the product is formed in the free A P block
+      if (rank_new > 0) {
+        for (int i = 0; i < rank_new; i++) blas::copy(AP[i], Q[i]);
+        blas::caxpy(coeff(S.adjoint()), p, {AP.begin(), AP.begin() + rank_new});
+        std::swap(P, AP);
       }
 
-      if ( !(updateR || updateX)) {
-	//beta = r2 / r2_old;
-	beta = sigma / r2_old; // use the alternative beta computation
-
-        if (param.pipeline && !breakdown) blas::tripleCGUpdate(alpha, beta, Ap, rSloppy, xSloppy, p);
-	else blas::axpyZpbx(alpha, p, xSloppy, rSloppy, beta);
-
-
-	if (use_heavy_quark_res && k%heavy_quark_check==0) {
-	  if (&x != &xSloppy) {
-	    blas::copy(tmp,y);
-	    heavy_quark_res = sqrt(blas::xpyHeavyQuarkResidualNorm(xSloppy, tmp, rSloppy).z);
-	  } else {
-	    blas::copy(r, rSloppy);
-	    heavy_quark_res = sqrt(blas::xpyHeavyQuarkResidualNorm(x, y, r).z);
-	  }
-	}
-
-	steps_since_reliable++;
-      } else {
-	blas::axpy(alpha, p, xSloppy);
-	blas::copy(x, xSloppy); // nop when these pointers alias
-
-	blas::xpy(x, y); // swap these around?
-	mat(r, y, x, tmp3); // here we can use x as tmp
-	r2 = blas::xmyNorm(b, r);
-
-	blas::copy(rSloppy, r); //nop when these pointers alias
-	blas::zero(xSloppy);
-
-	// calculate new reliable HQ resididual
-	if (use_heavy_quark_res) heavy_quark_res = sqrt(blas::HeavyQuarkResidualNorm(y, r).z);
-
-	// break-out check if we have reached the limit of the precision
-	if (sqrt(r2) > r0Norm && updateX) { // reuse r0Norm for this
-	  resIncrease++;
-	  resIncreaseTotal++;
-	  warningQuda("CG: new reliable residual norm %e is greater than previous reliable residual norm %e (total #inc %i)",
-		      sqrt(r2), r0Norm, resIncreaseTotal);
-	  if ( resIncrease > maxResIncrease or resIncreaseTotal > maxResIncreaseTotal) {
-            if (use_heavy_quark_res) {
-	      L2breakdown = true;
-            } else {
-	      warningQuda("CG: solver exiting due to too many true residual norm increases");
-	      break;
-	    }
-	  }
-	} else {
-	  resIncrease = 0;
-	}
-	// if L2 broke down already we turn off reliable updates and restart the CG
-	if (use_heavy_quark_res and L2breakdown) {
-	  delta = 0;
-	  warningQuda("CG: Restarting without reliable updates for heavy-quark residual");
-	  heavy_quark_restart = true;
-	  if (heavy_quark_res > heavy_quark_res_old) {
-	    hqresIncrease++;
-	    warningQuda("CG: new reliable HQ residual norm %e is greater than previous reliable residual norm %e", heavy_quark_res, heavy_quark_res_old);
-	    // break out if we do not improve here anymore
-	    if (hqresIncrease > hqmaxresIncrease) {
-	      warningQuda("CG: solver exiting due to too many heavy quark residual norm increases");
-	      break;
-	    }
-	  }
-	}
-
-	rNorm = sqrt(r2);
-	maxrr = rNorm;
-	maxrx = rNorm;
-	r0Norm = rNorm;
-	rUpdate++;
-
-	if (use_heavy_quark_res and heavy_quark_restart) {
-	  // perform a restart
-	  blas::copy(p, rSloppy);
-	  heavy_quark_restart = false;
-	} else {
-	  // explicitly restore the orthogonality of the gradient vector
-	  double rp = blas::reDotProduct(rSloppy, p) / (r2);
-	  blas::axpy(-rp, rSloppy, p);
-
-	  beta = r2 / r2_old;
-	  blas::xpay(rSloppy, beta, p);
-	}
-
-
-        steps_since_reliable = 0;
-        heavy_quark_res_old = heavy_quark_res;
-      }
+      C = S * C;
+      rank = rank_new;
+      for (int i = 0; i < n; i++) r2[i] = rank > 0 ? C.col(i).squaredNorm() : 0.0;
 
-      breakdown = false;
       k++;
-
-      PrintStats("CG", k, r2, b2, heavy_quark_res);
-      // check convergence, if convergence is satisfied we only need to check that we had a reliable update for the heavy quarks recently
-      converged = convergence(r2, heavy_quark_res, stop, param.tol_hq);
-
-      // check for recent enough reliable updates of the HQ residual if we use it
-      if (use_heavy_quark_res) {
-        // L2 is concverged or precision maxed out for L2
-        bool L2done = L2breakdown or convergenceL2(r2, heavy_quark_res, stop, param.tol_hq);
-        // HQ is converged and if we do reliable update the HQ residual has been calculated using a reliable update
-        bool HQdone = (steps_since_reliable == 0 and param.delta > 0) and convergenceHQ(r2, heavy_quark_res, stop, param.tol_hq);
-        converged = L2done and HQdone;
+      double r_rel = rel();
+      logQuda(QUDA_VERBOSE, "Block CG: %d sources, %5d iterations, max |r|/|b| = %9.6e\n", n, k, sqrt(r_rel));
+
+      // reliable update when the block residual has dropped by delta, at apparent convergence, or at breakdown
+      if (r_rel < delta2 * r0 || converged() || rank == 0) {
+        for (int i = 0; i < n; i++) {
+          blas::copy(x[i], xS[i]);
+          blas::xpy(x[i], y[i]);
+          blas::zero(xS[i]);
+        }
+        mat(r, y);
+        for (int i = 0; i < n; i++) r2[i] = blas::xmyNorm(b[i], r[i]);
+        rUpdate++;
+
+        // break-out check if we have reached the limit of the precision
+        r_rel = rel();
+        if (r_rel > r0) {
+          resIncrease++;
+          resIncreaseTotal++;
+          warningQuda("Block CG: new reliable residual norm %e is greater than previous reliable residual norm %e "
+                      "(total #inc %i)",
+                      sqrt(r_rel), sqrt(r0), resIncreaseTotal);
+          if (resIncrease > maxResIncrease or resIncreaseTotal > maxResIncreaseTotal) {
+            warningQuda("Block CG: solver exiting due to too many true residual norm increases");
+            break;
+          }
+        } else {
+          resIncrease = 0;
+        }
+        r0 = r_rel;
+
+        if (!converged()) restart();
       }
-
     }
 
-    blas::copy(x, xSloppy);
-    blas::xpy(y, x);
+    for (int i = 0; i < n; i++) {
+      blas::copy(x[i], xS[i]);
+      blas::xpy(y[i], x[i]);
+    }
 
     profile.TPSTOP(QUDA_PROFILE_COMPUTE);
     profile.TPSTART(QUDA_PROFILE_EPILOGUE);
 
     param.secs = profile.Last(QUDA_PROFILE_COMPUTE);
-    double gflops = (blas::flops + mat.flops() + matSloppy.flops())*1e-9;
-    reduceDouble(gflops);
+    double gflops = (blas::flops + mat.flops() + matSloppy.flops()) * 1e-9;
     param.gflops = gflops;
     param.iter += k;
 
-    if (k==param.maxiter)
-      warningQuda("Exceeded maximum iterations %d", param.maxiter);
-
-    if (getVerbosity() >= QUDA_VERBOSE)
-      printfQuda("CG: Reliable updates = %d\n", rUpdate);
-
-    // compute the true residuals
-    mat(r, x, y, tmp3);
-    param.true_res = sqrt(blas::xmyNorm(b, r) / b2);
-    param.true_res_hq = sqrt(blas::HeavyQuarkResidualNorm(x,r).z);
-
-    PrintSummary("CG", k, r2, b2, stop, inv.tol_hq);
+    if (k == param.maxiter) warningQuda("Exceeded maximum iterations %d", param.maxiter);
+    if (rank == 0 && !converged()) warningQuda("Block CG: residual block has no linearly independent directions left");
+
+    logQuda(QUDA_VERBOSE, "Block CG: Reliable updates = %d\n", rUpdate);
+
+    // compute the true residuals, where the reported residual is the worst over the sources
+    param.true_res = 0.0;
+    if (param.compute_true_res) {
+      mat(r, x);
+      for (int i = 0; i < n; i++) {
+        double true_res = sqrt(blas::xmyNorm(b[i], r[i]) / b2[i]);
+        param.true_res = std::max(param.true_res, true_res);
+        logQuda(QUDA_SUMMARIZE,
+                "Block CG: source %d, convergence at %d iterations, L2 relative residual: iterated = %9.6e, true = "
+                "%9.6e (requested = %9.6e)\n",
+                i, k, sqrt(r2[i] / b2[i]), true_res, sqrt(stop[i] / b2[i]));
+      }
+    } else {
+      for (int i = 0; i < n; i++) {
+        logQuda(QUDA_SUMMARIZE,
+                "Block CG: source %d, convergence at %d iterations, L2 relative residual: iterated = %9.6e (requested "
+                "= %9.6e)\n",
+                i, k, sqrt(r2[i] / b2[i]), sqrt(stop[i] / b2[i]));
+      }
+    }
 
     // reset the flops counters
     blas::flops = 0;
@@ -340,17 +319,6 @@ namespace quda {
     matSloppy.flops();
 
     profile.TPSTOP(QUDA_PROFILE_EPILOGUE);
-    profile.TPSTART(QUDA_PROFILE_FREE);
-
-    if (&tmp3 != &tmp) delete tmp3_p;
-    if (&tmp2 != &tmp) delete tmp2_p;
-
-    if (rSloppy.Precision() != r.Precision()) delete r_sloppy;
-    if (xSloppy.Precision() != x.Precision()) delete x_sloppy;
-
-    profile.TPSTOP(QUDA_PROFILE_FREE);
-#endif
-    return;
   }
 
 } // namespace quda
@@ -0,0 +1,282 @@
+#include <array>
+
+#include <quda_internal.h>
+#include <blas_quda.h>
+#include <comm_quda.h>
+#include <invert_quda.h>
+#include <util_quda.h>
+
+namespace quda
+{
+
+  PipeCG::PipeCG(const DiracMatrix &mat, const DiracMatrix &matSloppy, const DiracMatrix &matPrecon,
+                 SolverParam &param, TimeProfile &profile) :
+    Solver(mat, matSloppy, matPrecon, matPrecon, param, profile)
+  {
+  }
+
+  void PipeCG::create(ColorSpinorField &x, const ColorSpinorField &b)
+  {
+    Solver::create(x, b);
+    if (!init) {
+      ColorSpinorParam csParam(x);
+      csParam.create = QUDA_ZERO_FIELD_CREATE;
+      r = ColorSpinorField(csParam);
+      y = ColorSpinorField(csParam);
+
+      csParam.setPrecision(param.precision_sloppy);
+      rS = mixed() ? ColorSpinorField(csParam) : r.create_alias();
+      xS = ColorSpinorField(csParam);
+      pS = ColorSpinorField(csParam);
+      sS = ColorSpinorField(csParam);
+      wS = ColorSpinorField(csParam);
+      zS = ColorSpinorField(csParam);
+      qS = ColorSpinorField(csParam);
+
+      init = true;
+    }
+  }
+
+  /**
+     @brief Helper for the fused (r, r), (w, r) reduction of each
+     iteration.  The local sums are computed with global reductions
+     disabled, and their allreduce is posted non-blocking so that it
+     can proceed while the next operator is applied.
+   */
+  class PipeReduction
+  {
+    std::array<double, 2> sum = {};
+    const bool global;
+    bool pending = false;
+
+  public:
+    PipeReduction() : global(commGlobalReduction()) { }
+
+    ~PipeReduction()
+    {
+      if (pending) comm_allreduce_sum_wait();
+    }
+
+    /**
+       @brief Post the reduction of local partial sums
+       @param[in] local The local (r, r) and (w, r)
+     */
+    void start(double2 local)
+    {
+      sum = {local.x, local.y};
+      if (global) {
+        comm_allreduce_sum_start(sum.data(), sum.size());
+        pending = true;
+      }
+    }
+
+    /**
+       @brief Wait for the reduction started with start()
+       @return The global (r, r) and (w, r)
+     */
+    double2 wait()
+    {
+      if (pending) {
+        comm_allreduce_sum_wait();
+        pending = false;
+      }
+      return make_double2(sum[0], sum[1]);
+    }
+  };
+
+  /**
+     @brief Compute the local (r, r) and Re(w, r), without the global reduction
+   */
+  static double2 local_norm_dot(const ColorSpinorField &w, const ColorSpinorField &r)
+  {
+    commGlobalReductionPush(false);
+    double3 wr_rr = blas::cDotProductNormB(w, r);
+    commGlobalReductionPop();
+    return make_double2(wr_rr.z, wr_rr.x);
+  }
+
+  void PipeCG::operator()(ColorSpinorField &x, ColorSpinorField &b)
+  {
+    if (checkLocation(x, b) != QUDA_CUDA_FIELD_LOCATION) errorQuda("Not supported");
+    if (param.residual_type & QUDA_HEAVY_QUARK_RESIDUAL)
+      errorQuda("Heavy-quark residual not supported by the pipelined CG solver");
+
+    profile.TPSTART(QUDA_PROFILE_INIT);
+
+    // Check to see that we're not trying to invert on a zero-field source
+    double b2 = blas::norm2(b);
+    if (b2 == 0 && (param.compute_null_vector == QUDA_COMPUTE_NULL_VECTOR_NO || param.use_init_guess == QUDA_USE_INIT_GUESS_NO)) {
+      profile.TPSTOP(QUDA_PROFILE_INIT);
+      printfQuda("Warning: inverting on zero-field source\n");
+      x = b;
+      param.true_res = 0.0;
+      param.true_res_hq = 0.0;
+      return;
+    }
+
+    create(x, b);
+
+    double stop = stopping(param.tol, b2, param.residual_type); // stopping condition of solver
+
+    // this parameter determines how many consective reliable update
+    // reisudal increases we tolerate before terminating the solver,
+    // i.e., how long do we want to keep trying to converge
+    const int maxResIncrease = param.max_res_increase; // check if we reached the limit of our tolerance
+    const int maxResIncreaseTotal = param.max_res_increase_total;
+    int resIncrease = 0;
+    int resIncreaseTotal = 0;
+
+    profile.TPSTOP(QUDA_PROFILE_INIT);
+    profile.TPSTART(QUDA_PROFILE_PREAMBLE);
+
+    blas::flops = 0;
+
+    // compute initial residual depending on whether we have an initial guess or not
+    double r2;
+    if (param.use_init_guess == QUDA_USE_INIT_GUESS_YES) {
+      mat(r, x);
+      r2 = blas::xmyNorm(b, r);
+      if (b2 == 0) b2 = r2;
+      blas::copy(y, x);
+    } else {
+      blas::copy(r, b);
+      r2 = b2;
+      blas::zero(x);
+      blas::zero(y);
+    }
+    blas::zero(xS);
+    blas::copy(rS, r);
+
+    profile.TPSTOP(QUDA_PROFILE_PREAMBLE);
+    if (convergence(r2, 0.0, stop, param.tol_hq)) return;
+    profile.TPSTART(QUDA_PROFILE_COMPUTE);
+
+    double rNorm = sqrt(r2);
+    double r0Norm = rNorm;
+    double maxrx = rNorm;
+    double maxrr = rNorm;
+    const double delta = param.delta;
+
+    PipeReduction reduction;
+    matSloppy(wS, rS);
+    reduction.start(local_norm_dot(wS, rS));
+
+    int k = 0;
+    double gamma = r2, gamma_old = r2, alpha = 0.0, alpha_old = 0.0;
+
+    while (true) {
+      // the operator application overlaps the reduction in flight
+      matSloppy(qS, wS);
+
+      double2 rr_wr = reduction.wait();
+      gamma = rr_wr.x;
+      r2 = gamma;
+
+      // residual replacement with the reliable update conditions of CG
+      rNorm = sqrt(r2);
+      if (rNorm > maxrx) maxrx = rNorm;
+      if (rNorm > maxrr) maxrr = rNorm;
+      bool update = (rNorm < delta * r0Norm && r0Norm <= maxrx); // condition for x
+      update = (update || (rNorm < delta * maxrr && r0Norm <= maxrr)); // condition for r
+
+      // the recursive residual of the pipelined recurrences drifts, so always verify an apparent convergence
+      if (k > 0 && convergence(r2, 0.0, stop, param.tol_hq)) update = true;
+
+      if (k > 0 && update) {
+        blas::copy(x, xS);
+        blas::xpy(x, y);
+        blas::zero(xS);
+        mat(r, y);
+        r2 = blas::xmyNorm(b, r);
+        param.true_res = sqrt(r2 / b2);
+
+        // break-out check if we have reached the limit of the precision
+        if (sqrt(r2) > r0Norm) {
+          resIncrease++;
+          resIncreaseTotal++;
+          warningQuda(
+            "PipeCG: new reliable residual norm %e is greater than previous reliable residual norm %e (total #inc %i)",
+            sqrt(r2), r0Norm, resIncreaseTotal);
+          if (resIncrease > maxResIncrease or resIncreaseTotal > maxResIncreaseTotal) {
+            warningQuda("PipeCG: solver exiting due to too many true residual norm increases");
+            break;
+          }
+        } else {
+          resIncrease = 0;
+        }
+
+        rNorm = sqrt(r2);
+        r0Norm = rNorm;
+        maxrr = rNorm;
+        maxrx = rNorm;
+
+        // residual replacement (Cools and Vanroose): recompute the
+        // auxiliary vectors from the true residual and the current search
+        // direction, keeping p and beta so the Krylov space is not lost
+        blas::copy(rS, r);
+        matSloppy(wS, rS);
+        matSloppy(sS, pS);
+        matSloppy(zS, sS);
+        matSloppy(qS, wS);
+        reduction.start(local_norm_dot(wS, rS));
+        rr_wr = reduction.wait();
+        gamma = rr_wr.x;
+      }
+
+      PrintStats("PipeCG", k, r2, b2, 0.0);
+      if (convergence(r2, 0.0, stop, param.tol_hq) || k >= param.maxiter) break;
+
+      double beta;
+      if (k == 0) {
+        beta = 0.0;
+        alpha = gamma / rr_wr.y;
+      } else {
+        beta = gamma / gamma_old;
+        alpha = gamma / (rr_wr.y - beta * gamma / alpha_old);
+      }
+      gamma_old = gamma;
+      alpha_old = alpha;
+
+      // z = q + beta z, s = w + beta s, w -= alpha z
+      blas::pipeCGUpdate(alpha, beta, qS, zS, wS, sS);
+
+      // p = r + beta p, x += alpha p, r -= alpha s, and the local sums for the next iteration
+      commGlobalReductionPush(false);
+      double2 local = blas::pipeCGUpdateNorm(alpha, beta, xS, pS, rS, sS, wS);
+      commGlobalReductionPop();
+      reduction.start(local);
+
+      k++;
+    }
+
+    // accumulate the sloppy solution into the high-precision one
+    blas::copy(x, xS);
+    blas::xpy(y, x);
+
+    profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+    profile.TPSTART(QUDA_PROFILE_EPILOGUE);
+
+    param.secs = profile.Last(QUDA_PROFILE_COMPUTE);
+    double gflops = (blas::flops + mat.flops() + matSloppy.flops()) * 1e-9;
+    param.gflops = gflops;
+    param.iter += k;
+
+    if (k == param.maxiter) warningQuda("Exceeded maximum iterations %d", param.maxiter);
+
+    // compute the true residuals
+    if (param.compute_true_res) {
+      mat(r, x);
+      param.true_res = sqrt(blas::xmyNorm(b, r) / b2);
+    }
+
+    PrintSummary("PipeCG", k, r2, b2, stop, param.tol_hq);
+
+    // reset the flops counters
+    blas::flops = 0;
+    mat.flops();
+    matSloppy.flops();
+
+    profile.TPSTOP(QUDA_PROFILE_EPILOGUE);
+  }
+
+} // namespace quda
@@ -1,9 +1,11 @@
 #include <typeinfo>
+#include <utility>
 #include <quda_internal.h>
 #include <lattice_field.h>
 #include <color_spinor_field.h>
 #include <gauge_field.h>
 #include <clover_field.h>
+#include <alloc_trace.h>
 
 namespace quda {
 
@@ -235,6 +237,8 @@ namespace quda {
     mh_send = std::exchange(src.mh_send, {});
     mh_recv_rdma = std::exchange(src.mh_recv_rdma, {});
     mh_send_rdma = std::exchange(src.mh_send_rdma, {});
+    halo_plans = std::exchange(src.halo_plans, {});
+    halo_plan_active = std::exchange(src.halo_plan_active, {});
     initComms = std::exchange(src.initComms, false);
     vol_string = std::exchange(src.vol_string, {});
     aux_string = std::exchange(src.aux_string, {});
@@ -261,6 +265,8 @@ namespace quda {
 
   void LatticeField::allocateGhostBuffer(size_t ghost_bytes) const
   {
+    alloc_trace::category_scope category("ghost");
+
     // only allocate if not already allocated or buffer required is bigger than previously
     if ( !initGhostFaceBuffer || ghost_bytes > ghostFaceBytes) {
 
@@ -429,6 +435,11 @@ namespace quda {
       from_face_dim_dir_hd = {};
       from_face_dim_dir_d = {};
 
+      // the message sets reference the message handles so are freed first
+      for (auto &plan : halo_plans) comm_free_plan(plan.second.plan);
+      halo_plans.clear();
+      halo_plan_active = {};
+
       for (int b=0; b<2; ++b) {
 	for (int i=0; i<nDimComms; i++) {
           for (int dir = 0; dir < 2; dir++) {
@@ -454,6 +465,48 @@ namespace quda {
 
   }
 
+  void LatticeField::haloPlanStart(int mask, bool send, bool gdr)
+  {
+    halo_plan_active[bufferIndex][send] = nullptr;
+    if (!mask) return;
+
+    const int key = ((bufferIndex * 2 + send) * 2 + gdr) * 256 + mask;
+    auto it = halo_plans.find(key);
+    if (it == halo_plans.end()) {
+      const auto &mh = send ? (gdr ? mh_send_rdma : mh_send) : (gdr ? mh_recv_rdma : mh_recv);
+      HaloPlan plan;
+      plan.gdr = gdr;
+      std::vector<MsgHandle *> handles;
+      for (int dim = 0; dim < QUDA_MAX_DIM; dim++) {
+        for (int dir = 0; dir < 2; dir++) {
+          plan.index[dim][dir] = -1;
+          if (!(mask & (1 << (2 * dim + dir)))) continue;
+          if (!mh[bufferIndex][dim][dir]) errorQuda("No message handle for face dim = %d dir = %d", dim, dir);
+          plan.index[dim][dir] = handles.size();
+          handles.push_back(mh[bufferIndex][dim][dir]);
+        }
+      }
+      plan.plan = comm_declare_plan(handles.data(), handles.size());
+      it = halo_plans.emplace(key, plan).first;
+    }
+
+    comm_start_plan(it->second.plan);
+    halo_plan_active[bufferIndex][send] = &it->second;
+  }
+
+  int LatticeField::haloPlanQuery(int dim, int dir, bool send, bool gdr)
+  {
+    auto plan = halo_plan_active[bufferIndex][send];
+    if (!plan || plan->gdr != gdr || plan->index[dim][dir] < 0) return -1;
+    return comm_query_plan(plan->plan, plan->index[dim][dir]);
+  }
+
+  void LatticeField::haloPlanClear(int dim, int dir, bool send)
+  {
+    auto &plan = halo_plan_active[bufferIndex][send];
+    if (plan && plan->index[dim][dir] >= 0) plan = nullptr;
+  }
+
   void LatticeField::createIPCComms()
   {
     if ( initIPCComms && !ghost_field_reset ) return;
@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <util_quda.h>
+#include <memory_pool.h>
+
+namespace quda
+{
+
+  MemoryPool::MemoryPool(const std::string &name, allocator_t allocator, deallocator_t deallocator, size_t slab_bytes,
+                         double max_waste) :
+    name(name),
+    allocator(allocator),
+    deallocator(deallocator),
+    slab_bytes(((slab_bytes + granularity - 1) / granularity) * granularity),
+    max_waste(max_waste)
+  {
+    if (max_waste < 0.0) errorQuda("Invalid maximum waste ratio %f for %s pool", max_waste, name.c_str());
+  }
+
+  MemoryPool::~MemoryPool()
+  {
+    for (auto block : free_blocks) delete block;
+    for (auto &block : live_blocks) delete block.second;
+  }
+
+  void MemoryPool::update_stats()
+  {
+    stats.cached_bytes = stats.reserved_bytes - stats.live_bytes;
+    stats.n_live = live_blocks.size();
+    stats.n_free = free_blocks.size();
+    stats.n_slab = slabs.size();
+    stats.largest_free_block = free_blocks.empty() ? 0 : (*free_blocks.rbegin())->bytes;
+    stats.peak_live_bytes = std::max(stats.peak_live_bytes, stats.live_bytes);
+    stats.peak_reserved_bytes = std::max(stats.peak_reserved_bytes, stats.reserved_bytes);
+    stats.peak_fragmented_bytes = std::max(stats.peak_fragmented_bytes, stats.cached_bytes - stats.largest_free_block);
+  }
+
+  void MemoryPool::insert_free(block_t *block)
+  {
+    block->free = true;
+    block->requested = 0;
+
+    if (block->prev && block->prev->free) { // merge into the lower neighbour
+      auto prev = block->prev;
+      free_blocks.erase(prev);
+      prev->bytes += block->bytes;
+      prev->next = block->next;
+      if (block->next) block->next->prev = prev;
+      delete block;
+      block = prev;
+    }
+
+    if (block->next && block->next->free) { // absorb the upper neighbour
+      auto next = block->next;
+      free_blocks.erase(next);
+      block->bytes += next->bytes;
+      block->next = next->next;
+      if (next->next) next->next->prev = block;
+      delete next;
+    }
+
+    free_blocks.insert(block);
+  }
+
+  void MemoryPool::release_free_slabs()
+  {
+    for (auto it = free_blocks.begin(); it != free_blocks.end();) {
+      auto block = *it;
+      if (block->prev || block->next) { // only part of a slab
+        it++;
+        continue;
+      }
+      deallocator(__func__, __FILE__, __LINE__, block->slab);
+      stats.reserved_bytes -= block->bytes;
+      stats.n_slab_free++;
+      slabs.erase(block->slab);
+      it = free_blocks.erase(it);
+      delete block;
+    }
+  }
+
+  void *MemoryPool::allocate(const char *func, const char *file, int line, size_t bytes)
+  {
+    const size_t size = ((std::max(bytes, size_t(1)) + granularity - 1) / granularity) * granularity;
+
+    // smallest free block that is large enough
+    block_t key = {nullptr, size, 0, true, nullptr, nullptr, nullptr};
+    auto it = free_blocks.lower_bound(&key);
+
+    block_t *block;
+    if (it != free_blocks.end()) {
+      block = *it;
+      free_blocks.erase(it);
+      stats.n_hit++;
+    } else {
+      // the free slabs are too small for this request, so we return them before growing the pool
+      release_free_slabs();
+      const size_t slab_size = std::max(size, slab_bytes);
+      char *slab = static_cast<char *>(allocator(func, file, line, slab_size));
+      slabs[slab] = slab_size;
+      stats.reserved_bytes += slab_size;
+      stats.n_slab_alloc++;
+      block = new block_t {slab, slab_size, 0, true, nullptr, nullptr, slab};
+    }
+
+    // split the block if handing it out whole would waste too much
+    const size_t excess = block->bytes - size;
+    if (excess > 0 && excess > max_waste * size) {
+      auto remainder = new block_t {block->ptr + size, excess, 0, true, block, block->next, block->slab};
+      if (block->next) block->next->prev = remainder;
+      block->next = remainder;
+      block->bytes = size;
+      free_blocks.insert(remainder);
+      stats.n_split++;
+    }
+
+    block->free = false;
+    block->requested = bytes;
+    live_blocks[block->ptr] = block;
+    stats.live_bytes += block->bytes;
+    stats.requested_bytes += bytes;
+    stats.n_alloc++;
+    update_stats();
+
+    return block->ptr;
+  }
+
+  void MemoryPool::free(void *ptr)
+  {
+    auto it = live_blocks.find(ptr);
+    if (it == live_blocks.end()) errorQuda("Attempt to free invalid pointer %p to %s pool", ptr, name.c_str());
+    auto block = it->second;
+    live_blocks.erase(it);
+
+    stats.live_bytes -= block->bytes;
+    stats.requested_bytes -= block->requested;
+    insert_free(block);
+    update_stats();
+  }
+
+  void MemoryPool::flush()
+  {
+    release_free_slabs();
+    update_stats();
+  }
+
+  void MemoryPool::print_stats() const
+  {
+    constexpr double MiB = 1 << 20;
+    printfQuda("%s pool: live = %.1f MiB (peak %.1f MiB), cached = %.1f MiB, reserved = %.1f MiB (peak %.1f MiB)\n",
+               name.c_str(), stats.live_bytes / MiB, stats.peak_live_bytes / MiB, stats.cached_bytes / MiB,
+               stats.reserved_bytes / MiB, stats.peak_reserved_bytes / MiB);
+    printfQuda("%s pool: %lu requests, %.1f%% served from cache, %lu splits, %lu slab allocations, %lu slab frees\n",
+               name.c_str(), stats.n_alloc, stats.n_alloc > 0 ? 100.0 * stats.n_hit / stats.n_alloc : 0.0,
+               stats.n_split, stats.n_slab_alloc, stats.n_slab_free);
+    printfQuda("%s pool: fragmentation = %.1f%% of cached (peak %.1f MiB), waste = %.1f%% of live\n", name.c_str(),
+               100.0 * stats.fragmentation(), stats.peak_fragmented_bytes / MiB, 100.0 * stats.waste());
+  }
+
+} // namespace quda
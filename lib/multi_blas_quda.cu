@@ -62,6 +62,7 @@ namespace quda {
         default: max_warp_split = 4;
         }
         max_warp_split = std::min(NXZ, max_warp_split); // ensure we only split if valid
+        max_warp_split = std::min(device::warp_size(), max_warp_split); // cannot split below a single thread
 
         if (x_prec != y_prec) {
           strcat(aux, ",");
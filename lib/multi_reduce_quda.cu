@@ -639,7 +639,7 @@ namespace quda {
       }
 
       // do a single multi-node reduction only once we have computed all local dot products
-      comm_allreduce_sum(result_tmp);
+      if (commGlobalReduction()) comm_allreduce_sum(result_tmp);
 
       // multiReduce_recurse returns a column-major matrix.
       // To be consistent with the multi-blas functions, we should
@@ -690,7 +690,7 @@ namespace quda {
       }
 
       // do a single multi-node reduction only once we have computed all local dot products
-      comm_allreduce_sum(result_tmp);
+      if (commGlobalReduction()) comm_allreduce_sum(result_tmp);
 
       // multiReduce_recurse returns a column-major matrix.
       // To be consistent with the multi-blas functions, we should
@@ -708,7 +708,7 @@ namespace quda {
       TileSizeTune<multiCdot, multiCdot, Complex, decltype(x), decltype(y)>(result_tmp, x, y, x, x, true, false); // last false is b/c L2 norm
 
       // do a single multi-node reduction only once we have computed all local dot products
-      comm_allreduce_sum(result_tmp); // FIXME - could optimize this for Hermiticity as well
+      if (commGlobalReduction()) comm_allreduce_sum(result_tmp); // FIXME - could optimize this for Hermiticity as well
 
       // multiReduce_recurse returns a column-major matrix.
       // To be consistent with the multi-blas functions, we should
@@ -733,7 +733,7 @@ namespace quda {
       TileSizeTune<multiCdot, multiCdot, Complex, decltype(x), decltype(y)>(result_tmp, x, y, x, x, true, true); // last true is b/c A norm
 
       // do a single multi-node reduction only once we have computed all local dot products
-      comm_allreduce_sum(result_tmp);
+      if (commGlobalReduction()) comm_allreduce_sum(result_tmp);
 
       // multiReduce_recurse returns a column-major matrix.
       // To be consistent with the multi-blas functions, we should
@@ -4,6 +4,7 @@
 #include <tune_quda.h>
 #include <random_quda.h>
 #include <vector_io.h>
+#include <alloc_trace.h>
 
 // for building the KD inverse op
 #include <staggered_kd_build_xinv.h>
@@ -49,6 +50,7 @@ namespace quda
     matCoarseSmootherSloppy(nullptr),
     rng(nullptr)
   {
+    alloc_trace::category_scope category("MG level " + std::to_string(param.level));
     sprintf(prefix, "MG level %d (%s): ", param.level, param.location == QUDA_CUDA_FIELD_LOCATION ? "GPU" : "CPU");
     pushLevel(param.level);
 
@@ -122,6 +124,7 @@ namespace quda
   }
 
   void MG::reset(bool refresh) {
+    alloc_trace::category_scope category("MG level " + std::to_string(param.level));
     pushLevel(param.level);
 
     if (getVerbosity() >= QUDA_VERBOSE) printfQuda("%s level %d\n", transfer ? "Resetting" : "Creating", param.level);
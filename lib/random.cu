@@ -15,8 +15,9 @@ namespace quda {
     bool tuneSharedBytes() const { return false; }
 
   public:
+    // the states are always device allocations, so this is a device launch whatever the location of meta
     RNGInit(RNG &rng, const LatticeField &meta, unsigned long long seed) :
-      TunableKernel2D(meta, meta.SiteSubset()),
+      TunableKernel2D(meta, meta.SiteSubset(), QUDA_CUDA_FIELD_LOCATION),
       rng(rng),
       meta(meta),
       seed(seed)
@@ -2,11 +2,51 @@
 #include <color_spinor_field_order.h>
 #include <tunable_reduction.h>
 #include <kernels/reduce_core.cuh>
+#include <blas_host_simd.h>
 
 namespace quda {
 
   namespace blas {
 
+    /**
+       @brief Apply the vectorized host kernel that matches the reducer,
+       if there is one, accumulating the local result into sum.  The
+       field arguments point to the start of a contiguous array of n
+       real numbers.
+       @return Whether a vectorized kernel was applied
+     */
+    template <typename real>
+    bool host_simd(double &sum, const Norm2<double, real> &, real *x, real *, real *, real *, real *, size_t n,
+                   const host::launch_param &param)
+    {
+      sum += simd::norm2(x, n, param);
+      return true;
+    }
+
+    template <typename real>
+    bool host_simd(array<double, 2> &sum, const Cdot<double, real> &, real *x, real *y, real *, real *, real *,
+                   size_t n, const host::launch_param &param)
+    {
+      auto dot = simd::cDotProduct(x, y, n, param);
+      sum[0] += dot[0];
+      sum[1] += dot[1];
+      return true;
+    }
+
+    template <typename real>
+    bool host_simd(double &sum, const axpbyzNorm2<double, real> &r, real *x, real *y, real *z, real *, real *,
+                   size_t n, const host::launch_param &param)
+    {
+      sum += simd::axpbyzNorm(r.a, x, r.b, y, z, n, param);
+      return true;
+    }
+
+    template <typename reduce_t, typename Reducer, typename real>
+    bool host_simd(reduce_t &, const Reducer &, real *, real *, real *, real *, real *, size_t, const host::launch_param &)
+    {
+      return false;
+    }
+
     template <template <typename ReducerType, typename real> class Reducer,
               typename store_t, typename y_store_t, int nSpin, typename coeff_t>
     class Reduce : public TunableReduction2D
@@ -110,6 +150,27 @@ namespace quda {
           constexpr int M = N; // if site unrolling then M=N will be 24/6, e.g., full AoS
           const int length = x.Length() / M;
 
+          // single and double precision fields are contiguous arrays of reals per parity, so use the vectorized path if possible
+          if constexpr (std::is_same<host_store_t, host_y_store_t>::value && !isFixed<host_store_t>::value) {
+            if (simd::enabled() && !x.IsComposite()) {
+              auto param = host::get_launch_param(tp);
+              auto parity_ptr = [](ColorSpinorField &f, int parity) {
+                return static_cast<host_store_t *>(f.V()) + parity * (f.Bytes() / (2 * sizeof(host_store_t)));
+              };
+              std::vector<host_reduce_t> sum(1, ::quda::zero<host_reduce_t>());
+              bool applied = true;
+              for (int parity = 0; parity < nParity && applied; parity++) {
+                applied = host_simd(sum[0], r_, parity_ptr(x, parity), parity_ptr(y, parity), parity_ptr(z, parity),
+                                    parity_ptr(w, parity), parity_ptr(v, parity), (length / nParity) * M, param);
+              }
+              if (applied) {
+                if (!activeTuning() && commGlobalReduction()) decltype(r_)::reducer::comm_reduce(sum);
+                result = sum[0];
+                return;
+              }
+            }
+          }
+
           ReductionArg<host_real_t, M, host_store_t, N, host_y_store_t, Ny, decltype(r_)> arg(x, y, z, w, v, r_, length, nParity);
           launch_host<Reduce_>(result, tp, stream, arg);
         }
@@ -272,6 +333,13 @@ namespace quda {
       return instantiateReduce<quadrupleCG3UpdateNorm_, false>(a, b, 0.0, x, y, z, w, v);
     }
 
+    double2 pipeCGUpdateNorm(double a, double b, ColorSpinorField &x, ColorSpinorField &y, ColorSpinorField &z,
+                             const ColorSpinorField &w, const ColorSpinorField &v)
+    {
+      auto red = instantiateReduce<pipeCGUpdateNorm_, false>(a, b, 0.0, x, y, z, w, v);
+      return make_double2(red[0], red[1]);
+    }
+
   } // namespace blas
 
 } // namespace quda
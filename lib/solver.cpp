@@ -2,8 +2,14 @@
 #include <invert_quda.h>
 #include <multigrid.h>
 #include <eigensolve_quda.h>
+#include <vector_io.h>
+#include <blas_quda.h>
 #include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
 #include <limits>
+#include <typeinfo>
 
 namespace quda {
 
@@ -11,6 +17,17 @@ namespace quda {
     if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Creating a %s solver\n", type);
   }
 
+  /**
+     Set asynchronously by the checkpoint signal handler, and polled by
+     the solvers at the points where they can checkpoint
+  */
+  static volatile std::sig_atomic_t checkpoint_signalled = 0;
+
+  static void checkpoint_handler(int) { checkpoint_signalled = 1; }
+
+  /** Maximum number of scalars in a solver checkpoint */
+  constexpr int checkpoint_max_scalar = 16;
+
   Solver::Solver(const DiracMatrix &mat, const DiracMatrix &matSloppy, const DiracMatrix &matPrecon,
                  const DiracMatrix &matEig, SolverParam &param, TimeProfile &profile) :
     mat(mat),
@@ -28,6 +45,14 @@ namespace quda {
     // compute parity of the node
     for (int i=0; i<4; i++) node_parity += commCoords(i);
     node_parity = node_parity % 2;
+
+    // the application's handler is restored when the solver is destroyed
+    if (checkpointEnabled() && param.checkpoint_signal > 0) {
+      checkpoint_signal_prev = std::signal(param.checkpoint_signal, checkpoint_handler);
+      if (checkpoint_signal_prev == SIG_ERR)
+        errorQuda("Unable to install handler for checkpoint signal %d", param.checkpoint_signal);
+      checkpoint_signal_installed = param.checkpoint_signal;
+    }
   }
 
   Solver::~Solver()
@@ -36,6 +61,7 @@ namespace quda {
       delete eig_solve;
       eig_solve = nullptr;
     }
+    if (checkpoint_signal_installed) std::signal(checkpoint_signal_installed, checkpoint_signal_prev);
   }
 
   void Solver::create(ColorSpinorField &x, const ColorSpinorField &b)
@@ -147,6 +173,18 @@ namespace quda {
       report("CG3NR");
       solver = new CG3NR(mat, matSloppy, matPrecon, param, profile);
       break;
+    case QUDA_PIPE_CG_INVERTER:
+      report("PipeCG");
+      solver = new PipeCG(mat, matSloppy, matPrecon, param, profile);
+      break;
+    case QUDA_BLOCK_CG_INVERTER: // block CG with a single source is CG
+      report("CG");
+      solver = new CG(mat, matSloppy, matPrecon, matEig, param, profile);
+      break;
+    case QUDA_GCRODR_INVERTER:
+      report("GCRODR");
+      solver = new GCRODR(mat, matSloppy, matPrecon, param, profile);
+      break;
     default:
       errorQuda("Invalid solver type %d", param.inv_type);
     }
@@ -383,6 +421,245 @@ namespace quda {
     return eps;
   }
 
+  /**
+     @brief Pause whichever solver phase is timing, so that the
+     checkpoint I/O is attributed to QUDA_PROFILE_IO
+     @return The paused phase, or QUDA_PROFILE_COUNT if none
+   */
+  static QudaProfileType checkpoint_io_start(TimeProfile &profile)
+  {
+    QudaProfileType phase = QUDA_PROFILE_COUNT;
+    for (auto p : {QUDA_PROFILE_INIT, QUDA_PROFILE_PREAMBLE, QUDA_PROFILE_COMPUTE}) {
+      if (profile.isRunning(p)) {
+        phase = p;
+        profile.TPSTOP(p);
+      }
+    }
+    profile.TPSTART(QUDA_PROFILE_IO);
+    return phase;
+  }
+
+  static void checkpoint_io_stop(TimeProfile &profile, QudaProfileType phase)
+  {
+    profile.TPSTOP(QUDA_PROFILE_IO);
+    if (phase != QUDA_PROFILE_COUNT) profile.TPSTART(phase);
+  }
+
+  /**
+     @return The highest precision of a set of vectors, which VectorIO
+     requires them to share
+   */
+  template <typename T> static QudaPrecision checkpoint_precision(const vector_ref<T> &v)
+  {
+    QudaPrecision prec = QUDA_INVALID_PRECISION;
+    for (auto i = 0u; i < v.size(); i++) prec = std::max(prec, v[i].Precision());
+    return prec;
+  }
+
+  bool Solver::checkpointDue(int k)
+  {
+    if (!checkpointEnabled()) return false;
+
+    bool due = param.checkpoint_interval > 0 && k - checkpoint_iter >= param.checkpoint_interval;
+
+    if (param.checkpoint_signal > 0) {
+      // the signal need not have been delivered to every process
+      int signalled = checkpoint_signalled;
+      comm_allreduce_int(signalled);
+      if (signalled) due = true;
+    }
+
+    return due;
+  }
+
+  void Solver::checkpointSave(const char *name, cvector_ref<const ColorSpinorField> &v,
+                              const std::vector<double> &scalar, int k)
+  {
+    if (scalar.size() > checkpoint_max_scalar)
+      errorQuda("Checkpoint scalars %lu exceed max %d", scalar.size(), checkpoint_max_scalar);
+
+    auto phase = checkpoint_io_start(profile);
+    const std::string &file = param.checkpoint_file;
+    logQuda(QUDA_SUMMARIZE, "%s: checkpointing %lu vectors at iteration %d to %s\n", name, v.size(), k, file.c_str());
+
+    // promote any vectors that do not share the highest precision
+    const QudaPrecision prec = checkpoint_precision(v);
+    std::vector<ColorSpinorField> tmp;
+    tmp.reserve(v.size());
+    vector_ref<const ColorSpinorField> V;
+    for (auto i = 0u; i < v.size(); i++) {
+      if (v[i].Precision() == prec) {
+        V.push_back(v[i]);
+      } else {
+        ColorSpinorParam csParam(v[i]);
+        csParam.setPrecision(prec);
+        csParam.create = QUDA_NULL_FIELD_CREATE;
+        tmp.emplace_back(csParam);
+        blas::copy(tmp.back(), v[i]);
+        V.push_back(tmp.back());
+      }
+    }
+
+    VectorIO io(file + ".tmp");
+    io.save(V);
+
+    if (comm_rank() == 0) {
+      auto state = file + ".state.tmp";
+      FILE *fp = fopen(state.c_str(), "w");
+      if (!fp) errorQuda("Unable to open checkpoint state file %s", state.c_str());
+      fprintf(fp, "%s %d %lu %lu\n", name, k, v.size(), scalar.size());
+      fprintf(fp, "%s\n%a\n", checkpoint_fingerprint.c_str(), checkpoint_b2);
+      for (auto s : scalar) fprintf(fp, "%a\n", s);
+      if (fclose(fp)) errorQuda("Unable to write checkpoint state file %s", state.c_str());
+    }
+
+    // only replace the previous checkpoint once every process has completed the new one
+    comm_barrier();
+    if (comm_rank() == 0) {
+      if (std::rename((file + ".tmp").c_str(), file.c_str())
+          || std::rename((file + ".state.tmp").c_str(), (file + ".state").c_str()))
+        errorQuda("Unable to replace checkpoint %s", file.c_str());
+    }
+    comm_barrier();
+
+    checkpoint_iter = k;
+    checkpoint_signalled = 0;
+    checkpoint_io_stop(profile, phase);
+  }
+
+  /**
+     @brief Describe the system being solved, so that a checkpoint is
+     only resumed by a solve of the same system
+   */
+  static std::string system_fingerprint(const SolverParam &param, const DiracMatrix &mat, const ColorSpinorField &b)
+  {
+    const Dirac &dirac = *mat.Expose();
+    std::string fingerprint = std::string(typeid(mat).name()) + " dirac=" + std::to_string(dirac.getDiracType())
+      + " inv=" + std::to_string(param.inv_type) + " prec=" + std::to_string(param.precision) + ","
+      + std::to_string(param.precision_sloppy) + " vol=" + b.VolString() + " subset=" + std::to_string(b.SiteSubset());
+
+    char coeff[128];
+    snprintf(coeff, sizeof(coeff), " kappa=%a mass=%a mu=%a shift=%a", dirac.Kappa(), dirac.Mass(), dirac.Mu(),
+             mat.shift);
+    return fingerprint + coeff;
+  }
+
+  bool Solver::checkpointResume(const char *name, const ColorSpinorField &b, double b2, cvector_ref<ColorSpinorField> &v,
+                                std::vector<double> &scalar, int &k)
+  {
+    checkpoint_iter = 0;
+    if (!checkpointEnabled()) return false;
+    checkpoint_fingerprint = system_fingerprint(param, mat, b);
+    checkpoint_b2 = b2;
+    if (!param.checkpoint_resume) return false;
+
+    auto phase = checkpoint_io_start(profile);
+    const std::string &file = param.checkpoint_file;
+
+    struct {
+      int status; // 0 = not found, 1 = read, -1 = malformed
+      char name[64];
+      int iter;
+      int nvec;
+      int nscalar;
+      char fingerprint[256];
+      double b2;
+      double scalar[checkpoint_max_scalar];
+    } state = {};
+
+    if (comm_rank() == 0) {
+      FILE *fp = fopen((file + ".state").c_str(), "r");
+      if (fp) {
+        state.status = fscanf(fp, "%63s %d %d %d\n", state.name, &state.iter, &state.nvec, &state.nscalar) == 4 ? 1 : -1;
+        if (state.nscalar < 0 || state.nscalar > checkpoint_max_scalar) state.status = -1;
+        if (state.status == 1 && !fgets(state.fingerprint, sizeof(state.fingerprint), fp)) state.status = -1;
+        state.fingerprint[strcspn(state.fingerprint, "\n")] = '\0';
+        if (state.status == 1 && fscanf(fp, "%la", &state.b2) != 1) state.status = -1;
+        for (int i = 0; state.status == 1 && i < state.nscalar; i++)
+          if (fscanf(fp, "%la", &state.scalar[i]) != 1) state.status = -1;
+        fclose(fp);
+      }
+    }
+    comm_broadcast(&state, sizeof(state));
+
+    if (state.status == 0) {
+      logQuda(QUDA_SUMMARIZE, "%s: no checkpoint found at %s, starting from the beginning\n", name, file.c_str());
+      param.checkpoint_resume = false;
+      checkpoint_io_stop(profile, phase);
+      return false;
+    }
+    if (state.status < 0) errorQuda("Malformed checkpoint state file %s.state", file.c_str());
+
+    // |b|^2 is compared with a tolerance, since its reduction order may differ between jobs
+    if (strcmp(state.name, name) != 0 || state.nvec != static_cast<int>(v.size())
+        || state.nscalar != static_cast<int>(scalar.size()) || checkpoint_fingerprint != state.fingerprint
+        || std::abs(state.b2 - b2) > 1e-10 * b2) {
+      warningQuda("%s: refusing checkpoint %s of another system (%s with %d vectors, %s, |b|^2 = %e), starting from "
+                  "the beginning",
+                  name, file.c_str(), state.name, state.nvec, state.fingerprint, state.b2);
+      checkpoint_io_stop(profile, phase);
+      return false;
+    }
+    param.checkpoint_resume = false;
+
+    // load at the highest precision, from which the others are demoted
+    const QudaPrecision prec = checkpoint_precision(v);
+    std::vector<ColorSpinorField> tmp;
+    tmp.reserve(v.size());
+    vector_ref<ColorSpinorField> V;
+    for (auto i = 0u; i < v.size(); i++) {
+      if (v[i].Precision() == prec) {
+        V.push_back(v[i]);
+      } else {
+        ColorSpinorParam csParam(v[i]);
+        csParam.setPrecision(prec);
+        csParam.create = QUDA_NULL_FIELD_CREATE;
+        tmp.emplace_back(csParam);
+        V.push_back(tmp.back());
+      }
+    }
+
+    VectorIO io(file);
+    io.load(V);
+    for (auto i = 0u; i < v.size(); i++)
+      if (&V[i] != &v[i]) blas::copy(v[i], V[i]);
+
+    for (auto i = 0u; i < scalar.size(); i++) scalar[i] = state.scalar[i];
+    k = state.iter;
+    checkpoint_iter = k;
+
+    logQuda(QUDA_SUMMARIZE, "%s: resuming from checkpoint %s at iteration %d\n", name, file.c_str(), k);
+    checkpoint_io_stop(profile, phase);
+    return true;
+  }
+
+  void Solver::checkpointRemove()
+  {
+    if (!checkpointEnabled()) return;
+    if (comm_rank() == 0) {
+      // either file may be absent if no checkpoint was taken
+      std::remove(param.checkpoint_file.c_str());
+      std::remove((param.checkpoint_file + ".state").c_str());
+    }
+  }
+
+  MultiSrcSolver *MultiSrcSolver::create(SolverParam &param, const DiracMatrix &mat, const DiracMatrix &matSloppy,
+                                         TimeProfile &profile)
+  {
+    MultiSrcSolver *solver = nullptr;
+
+    switch (param.inv_type) {
+    case QUDA_BLOCK_CG_INVERTER:
+      report("MultiSrcCG");
+      solver = new MultiSrcCG(mat, matSloppy, param, profile);
+      break;
+    default: errorQuda("Invalid multi-source solver type %d", param.inv_type);
+    }
+
+    if (!mat.hermitian()) errorQuda("Cannot solve non-Hermitian system with Hermitian solver");
+    return solver;
+  }
+
   void MultiShiftSolver::create(const std::vector<ColorSpinorField> &x, const ColorSpinorField &b)
   {
     if (checkPrecision(x[0], b) != param.precision)
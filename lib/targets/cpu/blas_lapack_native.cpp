@@ -0,0 +1,38 @@
+#include <blas_lapack.h>
+
+/**
+   The native BLAS/LAPACK of the CPU target.  Since device memory is
+   host memory on this target, we can apply the generic (Eigen)
+   implementation directly to the data, regardless of the nominal
+   location, without staging it through pinned buffers.
+ */
+
+namespace quda
+{
+
+  namespace blas_lapack
+  {
+
+    namespace native
+    {
+
+      void init() { }
+
+      void destroy() { }
+
+      long long BatchInvertMatrix(void *Ainv, void *A, const int n, const uint64_t batch, QudaPrecision precision,
+                                  QudaFieldLocation)
+      {
+        return generic::BatchInvertMatrix(Ainv, A, n, batch, precision, QUDA_CPU_FIELD_LOCATION);
+      }
+
+      long long stridedBatchGEMM(void *A, void *B, void *C, QudaBLASParam blas_param, QudaFieldLocation)
+      {
+        return generic::stridedBatchGEMM(A, B, C, blas_param, QUDA_CPU_FIELD_LOCATION);
+      }
+
+    } // namespace native
+
+  } // namespace blas_lapack
+
+} // namespace quda
@@ -0,0 +1,40 @@
+#include <comm_quda.h>
+#include <quda_api.h>
+
+/**
+   On the CPU target there are no device-to-device copies between
+   processes: peer-to-peer is never enabled, and all halo exchange is
+   done through the host communication buffers.
+ */
+
+namespace quda
+{
+
+  bool comm_peer2peer_possible(int, int) { return false; }
+
+  int comm_peer2peer_performance(int, int) { return 0; }
+
+  void comm_create_neighbor_memory(array_2d<void *, QUDA_MAX_DIM, 2> &remote, void *)
+  {
+    for (int dim = 0; dim < 4; ++dim)
+      for (int dir = 0; dir < 2; ++dir) remote[dim][dir] = nullptr;
+  }
+
+  void comm_destroy_neighbor_memory(array_2d<void *, QUDA_MAX_DIM, 2> &) { }
+
+  void comm_create_neighbor_event(array_2d<qudaEvent_t, QUDA_MAX_DIM, 2> &remote,
+                                  array_2d<qudaEvent_t, QUDA_MAX_DIM, 2> &local)
+  {
+    for (int dim = 0; dim < 4; ++dim) {
+      for (int dir = 0; dir < 2; ++dir) {
+        remote[dim][dir].event = nullptr;
+        local[dim][dir].event = nullptr;
+      }
+    }
+  }
+
+  void comm_destroy_neighbor_event(array_2d<qudaEvent_t, QUDA_MAX_DIM, 2> &, array_2d<qudaEvent_t, QUDA_MAX_DIM, 2> &)
+  {
+  }
+
+} // namespace quda
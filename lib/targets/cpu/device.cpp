@@ -0,0 +1,96 @@
+#include <climits>
+#include <util_quda.h>
+#include <quda_internal.h>
+#include <target_device.h>
+#include <host_thread_helper.h>
+
+static const int Nstream = 9;
+
+/**
+   The device of the CPU target is the host process itself.  All work
+   is executed synchronously, so streams are only indices, and the
+   launch limits describe the emulated grid of the host launcher: each
+   thread block is executed by a single host thread, while the grid
+   is distributed among all host threads.
+ */
+
+namespace quda
+{
+
+  namespace device
+  {
+
+    static bool initialized = false;
+
+    void init(int dev)
+    {
+      if (initialized) return;
+      initialized = true;
+      printfQuda("*** CPU BACKEND ***\n");
+      if (dev != 0) warningQuda("Device ordinal %d requested, but the CPU target has a single device", dev);
+      if (getVerbosity() >= QUDA_SUMMARIZE) print_device_properties();
+    }
+
+    int get_device_count() { return 1; }
+
+    void get_visible_devices_string(char device_list_string[128]) { device_list_string[0] = '\0'; }
+
+    void print_device_properties()
+    {
+      printfQuda("Host threads: %d\n", host::max_threads());
+      printfQuda("Shared memory per block: %u bytes\n", target::cpu::shared_memory_bytes);
+    }
+
+    void create_context() { }
+
+    void destroy() { }
+
+    qudaStream_t get_stream(unsigned int i)
+    {
+      if (i > Nstream) errorQuda("Invalid stream index %u", i);
+      qudaStream_t stream;
+      stream.idx = i;
+      return stream;
+    }
+
+    qudaStream_t get_default_stream()
+    {
+      qudaStream_t stream;
+      stream.idx = Nstream - 1;
+      return stream;
+    }
+
+    unsigned int get_default_stream_idx() { return Nstream - 1; }
+
+    bool managed_memory_supported() { return false; }
+
+    bool shared_memory_atomic_supported() { return true; }
+
+    size_t max_default_shared_memory() { return target::cpu::shared_memory_bytes; }
+
+    size_t max_dynamic_shared_memory() { return target::cpu::shared_memory_bytes; }
+
+    unsigned int max_threads_per_block() { return 1; }
+
+    unsigned int max_threads_per_processor() { return 1; }
+
+    unsigned int max_threads_per_block_dim(int) { return 1; }
+
+    unsigned int max_grid_size(int i) { return i == 0 ? INT_MAX : 65535; }
+
+    unsigned int processor_count() { return host::max_threads(); }
+
+    unsigned int max_blocks_per_processor() { return 1; }
+
+    namespace profile
+    {
+
+      void start() { }
+
+      void stop() { }
+
+    } // namespace profile
+
+  } // namespace device
+
+} // namespace quda
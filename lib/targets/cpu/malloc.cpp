@@ -0,0 +1,572 @@
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <map>
+#include <unistd.h>   // for getpagesize()
+#include <execinfo.h> // for backtrace
+#include <quda_internal.h>
+#include <memory_pool.h>
+#include <host_numa.h>
+#include <alloc_trace.h>
+#include <device.h>
+
+/**
+   Memory management for the CPU target.  Every allocation is host
+   memory: "device" allocations are page-aligned host buffers, pinned
+   and mapped allocations need no registration, and a mapped buffer is
+   its own device pointer.  The allocations are still tracked per type,
+   so that the memory accounting, leak reporting and pointer location
+   queries behave as with the other targets.
+ */
+
+namespace quda
+{
+
+  enum AllocType { DEVICE, DEVICE_PINNED, HOST, PINNED, MAPPED, MANAGED, N_ALLOC_TYPE };
+
+  class MemAlloc
+  {
+
+  public:
+    std::string func;
+    std::string file;
+    int line;
+    size_t size;
+    size_t base_size;
+
+    MemAlloc() : line(-1), size(0), base_size(0) { }
+
+    MemAlloc(std::string func, std::string file, int line) : func(func), file(file), line(line), size(0), base_size(0)
+    {
+    }
+
+    MemAlloc(const MemAlloc &) = default;
+    MemAlloc(MemAlloc &&) = default;
+    virtual ~MemAlloc() = default;
+    MemAlloc &operator=(const MemAlloc &) = default;
+    MemAlloc &operator=(MemAlloc &&) = default;
+  };
+
+  static std::map<void *, MemAlloc> alloc[N_ALLOC_TYPE];
+  static size_t total_bytes[N_ALLOC_TYPE] = {0};
+  static size_t max_total_bytes[N_ALLOC_TYPE] = {0};
+  static size_t total_host_bytes, max_total_host_bytes;
+  static size_t total_pinned_bytes, max_total_pinned_bytes;
+
+  size_t device_allocated() { return total_bytes[DEVICE]; }
+
+  size_t pinned_allocated() { return total_bytes[PINNED]; }
+
+  size_t mapped_allocated() { return total_bytes[MAPPED]; }
+
+  size_t managed_allocated() { return total_bytes[MANAGED]; }
+
+  size_t host_allocated() { return total_bytes[HOST]; }
+
+  size_t device_allocated_peak() { return max_total_bytes[DEVICE]; }
+
+  size_t pinned_allocated_peak() { return max_total_bytes[PINNED]; }
+
+  size_t mapped_allocated_peak() { return max_total_bytes[MAPPED]; }
+
+  size_t managed_allocated_peak() { return max_total_bytes[MANAGED]; }
+
+  size_t host_allocated_peak() { return max_total_bytes[HOST]; }
+
+  static void print_trace(void)
+  {
+    void *array[10];
+    size_t size;
+    char **strings;
+    size = backtrace(array, 10);
+    strings = backtrace_symbols(array, size);
+    printfQuda("Obtained %zd stack frames.\n", size);
+    for (size_t i = 0; i < size; i++) printfQuda("%s\n", strings[i]);
+    free(strings);
+  }
+
+  static void print_alloc_header()
+  {
+    printfQuda("Type    Pointer          Size             Location\n");
+    printfQuda("----------------------------------------------------------\n");
+  }
+
+  static void print_alloc(AllocType type)
+  {
+    const char *type_str[] = {"Device", "Device Pinned", "Host  ", "Pinned", "Mapped", "Managed"};
+    std::map<void *, MemAlloc>::iterator entry;
+
+    for (auto entry : alloc[type]) {
+      void *ptr = entry.first;
+      MemAlloc a = entry.second;
+      printfQuda("%s  %15p  %15lu  %s(), %s:%d\n", type_str[type], ptr, (unsigned long)a.base_size, a.func.c_str(),
+                 a.file.c_str(), a.line);
+    }
+  }
+
+  /** names of the allocation types in the allocation trace */
+  static const char *alloc_trace_kind[] = {"device", "device pinned", "host", "pinned", "mapped", "managed"};
+
+  /** whether the allocation is a slab of a memory pool, in which case the blocks of the pool are traced instead */
+  static bool pool_slab = false;
+
+  static void track_malloc(const AllocType &type, const MemAlloc &a, void *ptr)
+  {
+    total_bytes[type] += a.base_size;
+    if (total_bytes[type] > max_total_bytes[type]) { max_total_bytes[type] = total_bytes[type]; }
+    if (type != DEVICE && type != DEVICE_PINNED) {
+      total_host_bytes += a.base_size;
+      if (total_host_bytes > max_total_host_bytes) { max_total_host_bytes = total_host_bytes; }
+    }
+    if (type == PINNED || type == MAPPED) {
+      total_pinned_bytes += a.base_size;
+      if (total_pinned_bytes > max_total_pinned_bytes) { max_total_pinned_bytes = total_pinned_bytes; }
+    }
+    alloc[type][ptr] = a;
+    if (alloc_trace::enabled() && !pool_slab) {
+      const bool device = type == DEVICE || type == DEVICE_PINNED;
+      alloc_trace::record_alloc(alloc_trace_kind[type], device, ptr, a.base_size, a.func.c_str(), a.file.c_str(),
+                                a.line);
+    }
+  }
+
+  static void track_free(const AllocType &type, void *ptr)
+  {
+    size_t size = alloc[type][ptr].base_size;
+    total_bytes[type] -= size;
+    if (type != DEVICE && type != DEVICE_PINNED) { total_host_bytes -= size; }
+    if (type == PINNED || type == MAPPED) { total_pinned_bytes -= size; }
+    alloc[type].erase(ptr);
+    if (alloc_trace::enabled()) alloc_trace::record_free(ptr);
+  }
+
+  /**
+   * Allocate host memory aligned to, and padded to a multiple of, two
+   * pages.  This backs every allocation type other than safe_malloc(),
+   * so that field data is suitably aligned for vectorized access.
+   */
+  static void *aligned_malloc(MemAlloc &a, size_t size)
+  {
+    void *ptr = nullptr;
+
+    a.size = size;
+
+    static int page_size = 2 * getpagesize();
+    a.base_size = ((size + page_size - 1) / page_size) * page_size; // round up to the nearest multiple of page_size
+    int align = posix_memalign(&ptr, page_size, a.base_size);
+    if (!ptr || align != 0) {
+      alloc_trace::print_summary();
+      errorQuda("Failed to allocate aligned host memory of size %zu (%s:%d in %s())\n", size, a.file.c_str(), a.line,
+                a.func.c_str());
+    }
+    numa::place(ptr, a.base_size); // prior to any registration, which faults in the pages
+    return ptr;
+  }
+
+  /**
+     Managed memory has no meaning on the host, since all memory is
+     already accessible from both host and "device".
+   */
+  bool use_managed_memory()
+  {
+    static bool managed = false;
+    static bool init = false;
+
+    if (!init) {
+      char *enable_managed_memory = getenv("QUDA_ENABLE_MANAGED_MEMORY");
+      if (enable_managed_memory && strcmp(enable_managed_memory, "1") == 0) {
+        warningQuda("Managed memory is not used with the CPU target, ignoring QUDA_ENABLE_MANAGED_MEMORY");
+      }
+      init = true;
+    }
+
+    return managed;
+  }
+
+  bool use_qdp_managed()
+  {
+#if defined(QDP_USE_CUDA_MANAGED_MEMORY) || defined(QDP_ENABLE_MANAGED_MEMORY)
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  bool is_prefetch_enabled() { return false; }
+
+  /**
+   * Allocate "device" memory with error-checking.  This function
+   * should only be called via the device_malloc() macro, defined in
+   * malloc_quda.h
+   */
+  void *device_malloc_(const char *func, const char *file, int line, size_t size)
+  {
+    MemAlloc a(func, file, line);
+    void *ptr = aligned_malloc(a, size);
+    track_malloc(DEVICE, a, ptr);
+#ifdef HOST_DEBUG
+    memset(ptr, 0xff, a.base_size);
+#endif
+    return ptr;
+  }
+
+  /**
+   * Allocate "device" memory that is to be shared with other
+   * processes.  Since there is no peer-to-peer communication on the
+   * CPU target this is a regular device allocation.  This function
+   * should only be called via the device_pinned_malloc() macro,
+   * defined in malloc_quda.h.
+   */
+  void *device_pinned_malloc_(const char *func, const char *file, int line, size_t size)
+  {
+    return device_malloc_(func, file, line, size);
+  }
+
+  /**
+   * Perform a standard malloc() with error-checking.  This function
+   * should only be called via the safe_malloc() macro, defined in
+   * malloc_quda.h
+   */
+  void *safe_malloc_(const char *func, const char *file, int line, size_t size)
+  {
+    MemAlloc a(func, file, line);
+    a.size = a.base_size = size;
+
+    void *ptr = malloc(size);
+    if (!ptr) { errorQuda("Failed to allocate host memory of size %zu (%s:%d in %s())\n", size, file, line, func); }
+    numa::place(ptr, size);
+    track_malloc(HOST, a, ptr);
+    return ptr;
+  }
+
+  /**
+   * Allocate "pinned" host memory.  There is nothing to register on
+   * the CPU target, so this is an aligned host allocation.  This
+   * function should only be called via the pinned_malloc() macro,
+   * defined in malloc_quda.h
+   */
+  void *pinned_malloc_(const char *func, const char *file, int line, size_t size)
+  {
+    MemAlloc a(func, file, line);
+    void *ptr = aligned_malloc(a, size);
+    track_malloc(PINNED, a, ptr);
+#ifdef HOST_DEBUG
+    memset(ptr, 0xff, a.base_size);
+#endif
+    return ptr;
+  }
+
+  /**
+   * Allocate "mapped" host memory.  The host address is also the
+   * device address on the CPU target.  This function should only be
+   * called via the mapped_malloc() macro, defined in malloc_quda.h
+   */
+  void *mapped_malloc_(const char *func, const char *file, int line, size_t size)
+  {
+    MemAlloc a(func, file, line);
+    void *ptr = aligned_malloc(a, size);
+    track_malloc(MAPPED, a, ptr);
+#ifdef HOST_DEBUG
+    memset(ptr, 0xff, a.base_size);
+#endif
+    return ptr;
+  }
+
+  /**
+   * Allocate "managed" memory.  This function should only be called
+   * via the managed_malloc() macro, defined in malloc_quda.h
+   */
+  void *managed_malloc_(const char *func, const char *file, int line, size_t size)
+  {
+    MemAlloc a(func, file, line);
+    void *ptr = aligned_malloc(a, size);
+    track_malloc(MANAGED, a, ptr);
+#ifdef HOST_DEBUG
+    memset(ptr, 0xff, a.base_size);
+#endif
+    return ptr;
+  }
+
+  /**
+   * Allocate device memory for comms.  Should only be called via the
+   * device_comms_pinned_malloc macro, defined in malloc_quda.h
+   */
+  void *device_comms_pinned_malloc_(const char *func, const char *file, int line, size_t size)
+  {
+    return device_pinned_malloc_(func, file, line, size);
+  }
+
+  /**
+   * Free device memory allocated with device_malloc().  This function
+   * should only be called via the device_free() macro, defined in
+   * malloc_quda.h
+   */
+  void device_free_(const char *func, const char *file, int line, void *ptr)
+  {
+    if (!ptr) { errorQuda("Attempt to free NULL device pointer (%s:%d in %s())\n", file, line, func); }
+    if (!alloc[DEVICE].count(ptr)) {
+      errorQuda("Attempt to free invalid device pointer (%s:%d in %s())\n", file, line, func);
+    }
+    track_free(DEVICE, ptr);
+    free(ptr);
+  }
+
+  /**
+   * Free device memory allocated with device_pinned malloc().  This
+   * function should only be called via the device_pinned_free()
+   * macro, defined in malloc_quda.h
+   */
+  void device_pinned_free_(const char *func, const char *file, int line, void *ptr)
+  {
+    device_free_(func, file, line, ptr);
+  }
+
+  /**
+   * Free managed memory allocated with managed_malloc().  This
+   * function should only be called via the managed_free() macro,
+   * defined in malloc_quda.h
+   */
+  void managed_free_(const char *func, const char *file, int line, void *ptr)
+  {
+    if (!ptr) { errorQuda("Attempt to free NULL managed pointer (%s:%d in %s())\n", file, line, func); }
+    if (!alloc[MANAGED].count(ptr)) {
+      errorQuda("Attempt to free invalid managed pointer (%s:%d in %s())\n", file, line, func);
+    }
+    track_free(MANAGED, ptr);
+    free(ptr);
+  }
+
+  /**
+   * Free host memory allocated with safe_malloc(), pinned_malloc(),
+   * or mapped_malloc().  This function should only be called via the
+   * host_free() macro, defined in malloc_quda.h
+   */
+  void host_free_(const char *func, const char *file, int line, void *ptr)
+  {
+    if (!ptr) { errorQuda("Attempt to free NULL host pointer (%s:%d in %s())\n", file, line, func); }
+    if (alloc[HOST].count(ptr)) {
+      track_free(HOST, ptr);
+    } else if (alloc[PINNED].count(ptr)) {
+      track_free(PINNED, ptr);
+    } else if (alloc[MAPPED].count(ptr)) {
+      track_free(MAPPED, ptr);
+    } else {
+      printfQuda("ERROR: Attempt to free invalid host pointer (%s:%d in %s())\n", file, line, func);
+      print_trace();
+      errorQuda("Aborting");
+    }
+    free(ptr);
+  }
+
+  /**
+   * Free device comms memory allocated with device_comms_pinned_malloc(). This function should only be
+   * called via the device_comms_pinned_free() macro, defined in malloc_quda.h
+   */
+  void device_comms_pinned_free_(const char *func, const char *file, int line, void *ptr)
+  {
+    device_pinned_free_(func, file, line, ptr);
+  }
+
+  void printPeakMemUsage()
+  {
+    printfQuda("Device memory used = %.1f MiB\n", max_total_bytes[DEVICE] / (double)(1 << 20));
+    printfQuda("Managed memory used = %.1f MiB\n", max_total_bytes[MANAGED] / (double)(1 << 20));
+    printfQuda("Page-locked host memory used = %.1f MiB\n", max_total_pinned_bytes / (double)(1 << 20));
+    printfQuda("Total host memory used >= %.1f MiB\n", max_total_host_bytes / (double)(1 << 20));
+
+    pool::print_stats();
+    alloc_trace::print_summary();
+  }
+
+  void assertAllMemFree()
+  {
+    if (!alloc[DEVICE].empty() || !alloc[DEVICE_PINNED].empty() || !alloc[HOST].empty() || !alloc[PINNED].empty()
+        || !alloc[MAPPED].empty() || !alloc[MANAGED].empty()) {
+      warningQuda("The following internal memory allocations were not freed.");
+      printfQuda("\n");
+      print_alloc_header();
+      print_alloc(DEVICE);
+      print_alloc(DEVICE_PINNED);
+      print_alloc(HOST);
+      print_alloc(PINNED);
+      print_alloc(MAPPED);
+      print_alloc(MANAGED);
+      printfQuda("\n");
+    }
+  }
+
+  /**
+     All memory is host memory, so the location of a pointer is
+     whatever it was allocated as: pointers returned by the device and
+     managed allocators are treated as device pointers, and everything
+     else (including memory not allocated by QUDA) as host pointers.
+     Pointers into the interior of an allocation are resolved too.
+   */
+  QudaFieldLocation get_pointer_location(const void *ptr)
+  {
+    auto p = static_cast<const char *>(ptr);
+    for (auto type : {DEVICE, DEVICE_PINNED, MANAGED}) {
+      auto it = alloc[type].upper_bound(const_cast<void *>(ptr));
+      if (it == alloc[type].begin()) continue;
+      --it;
+      auto base = static_cast<const char *>(it->first);
+      if (p >= base && p < base + it->second.base_size) return QUDA_CUDA_FIELD_LOCATION;
+    }
+    return QUDA_CPU_FIELD_LOCATION;
+  }
+
+  void *get_mapped_device_pointer_(const char *, const char *, int, const void *host)
+  {
+    return const_cast<void *>(host);
+  }
+
+  void register_pinned_(const char *, const char *, int, void *, size_t) { }
+
+  void unregister_pinned_(const char *, const char *, int, void *) { }
+
+  namespace pool
+  {
+
+    static bool pool_init = false;
+
+    /** whether to use a memory pool allocator for device memory */
+    static bool device_memory_pool = true;
+
+    /** whether to use a memory pool allocator for pinned memory */
+    static bool pinned_memory_pool = true;
+
+    /** minimum size of the slabs the pools obtain from the underlying allocators */
+    static constexpr size_t pool_slab_bytes = 2 << 20;
+
+    /**
+       @brief The maximum fraction by which a block handed out by the
+       pools may exceed the request, before it is split, which is set
+       with the environment variable QUDA_MEMORY_POOL_MAX_WASTE
+       (default 0.25)
+     */
+    static double pool_max_waste()
+    {
+      static bool init = false;
+      static double max_waste = 0.25;
+
+      if (!init) {
+        char *max_waste_env = getenv("QUDA_MEMORY_POOL_MAX_WASTE");
+        if (max_waste_env) max_waste = std::strtod(max_waste_env, nullptr);
+        init = true;
+      }
+      return max_waste;
+    }
+
+    /** Pool of device-memory allocations, which fields can reuse with minimal overhead */
+    static MemoryPool &device_pool()
+    {
+      static MemoryPool pool("Device", quda::device_malloc_, quda::device_free_, pool_slab_bytes, pool_max_waste());
+      return pool;
+    }
+
+    /** Pool of pinned-memory allocations, which fields can reuse with minimal overhead */
+    static MemoryPool &pinned_pool()
+    {
+      static MemoryPool pool("Pinned", quda::pinned_malloc_, quda::host_free_, pool_slab_bytes, pool_max_waste());
+      return pool;
+    }
+
+    /**
+       @brief Allocate a block from a pool, which is traced in place of
+       any slab the pool obtains to serve it
+     */
+    static void *pool_allocate(MemoryPool &pool, const char *kind, bool device, const char *func, const char *file,
+                               int line, size_t nbytes)
+    {
+      pool_slab = true;
+      void *ptr = pool.allocate(func, file, line, nbytes);
+      pool_slab = false;
+      if (alloc_trace::enabled()) alloc_trace::record_alloc(kind, device, ptr, nbytes, func, file, line);
+      return ptr;
+    }
+
+    /**
+       @brief Return a block to a pool
+     */
+    static void pool_free(MemoryPool &pool, void *ptr)
+    {
+      if (alloc_trace::enabled()) alloc_trace::record_free(ptr);
+      pool.free(ptr);
+    }
+
+    void init()
+    {
+      if (!pool_init) {
+        // device memory pool
+        char *enable_device_pool = getenv("QUDA_ENABLE_DEVICE_MEMORY_POOL");
+        if (!enable_device_pool || strcmp(enable_device_pool, "0") != 0) {
+          warningQuda("Using device memory pool allocator");
+          device_memory_pool = true;
+        } else {
+          warningQuda("Not using device memory pool allocator");
+          device_memory_pool = false;
+        }
+
+        // pinned memory pool
+        char *enable_pinned_pool = getenv("QUDA_ENABLE_PINNED_MEMORY_POOL");
+        if (!enable_pinned_pool || strcmp(enable_pinned_pool, "0") != 0) {
+          warningQuda("Using pinned memory pool allocator");
+          pinned_memory_pool = true;
+        } else {
+          warningQuda("Not using pinned memory pool allocator");
+          pinned_memory_pool = false;
+        }
+        pool_init = true;
+      }
+    }
+
+    void *pinned_malloc_(const char *func, const char *file, int line, size_t nbytes)
+    {
+      return pinned_memory_pool ? pool_allocate(pinned_pool(), "pinned", false, func, file, line, nbytes) :
+                                  quda::pinned_malloc_(func, file, line, nbytes);
+    }
+
+    void pinned_free_(const char *func, const char *file, int line, void *ptr)
+    {
+      if (pinned_memory_pool) {
+        pool_free(pinned_pool(), ptr);
+      } else {
+        quda::host_free_(func, file, line, ptr);
+      }
+    }
+
+    void *device_malloc_(const char *func, const char *file, int line, size_t nbytes)
+    {
+      return device_memory_pool ? pool_allocate(device_pool(), "device", true, func, file, line, nbytes) :
+                                  quda::device_malloc_(func, file, line, nbytes);
+    }
+
+    void device_free_(const char *func, const char *file, int line, void *ptr)
+    {
+      if (device_memory_pool) {
+        pool_free(device_pool(), ptr);
+      } else {
+        quda::device_free_(func, file, line, ptr);
+      }
+    }
+
+    void flush_pinned()
+    {
+      if (pinned_memory_pool) pinned_pool().flush();
+    }
+
+    void flush_device()
+    {
+      if (device_memory_pool) device_pool().flush();
+    }
+
+    void print_stats()
+    {
+      if (device_memory_pool) device_pool().print_stats();
+      if (pinned_memory_pool) pinned_pool().print_stats();
+    }
+
+  } // namespace pool
+
+} // namespace quda
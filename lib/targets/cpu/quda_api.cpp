@@ -0,0 +1,234 @@
+#include <chrono>
+#include <cstring>
+#include <tune_quda.h>
+#include <quda_internal.h>
+#include <timer.h>
+#include <device.h>
+#include <target_device.h>
+#include <host_thread_helper.h>
+
+// if this macro is defined then we profile the API calls
+//#define API_PROFILE
+
+#ifdef API_PROFILE
+#define PROFILE(f, idx)                                                                                                \
+  apiTimer.TPSTART(idx);                                                                                               \
+  f;                                                                                                                   \
+  apiTimer.TPSTOP(idx);
+#else
+#define PROFILE(f, idx) f;
+#endif
+
+/**
+   The API of the CPU target.  All work is done synchronously by the
+   calling process: kernels are run by the host launcher below before
+   it returns, so streams are only labels, memory copies are plain
+   host copies, and events are satisfied as soon as they are
+   recorded.  Events record the host time, so that the event timing
+   used by the autotuner and the profiler remains meaningful.
+ */
+
+namespace quda
+{
+
+  /* This is checked in the tuner */
+  static qudaError_t last_error = QUDA_SUCCESS;
+
+  /* This is only ever printed */
+  static std::string last_error_str {"CPU_SUCCESS"};
+
+  /* For the tuner to operat correctly we need to clear the last error */
+  qudaError_t qudaGetLastError()
+  {
+    auto rtn = last_error;
+    last_error = QUDA_SUCCESS; // Clear the error prior to returning
+    return rtn;
+  }
+
+  std::string qudaGetLastErrorString()
+  {
+    auto rtn = last_error_str;
+    last_error_str = "CPU_SUCCESS"; // Clear the error prior to returning.
+    return rtn;
+  }
+
+  static TimeProfile apiTimer("CPU API calls (runtime)");
+
+  namespace
+  {
+    /**
+       @brief Execute a kernel over the launch grid.  The blocks are
+       distributed among the host threads, and each block is executed
+       by a single host thread, which runs the threads of the block in
+       turn after setting the emulated indices.
+       @param[in] kernel The kernel entry point, which executes a single thread
+       @param[in] grid The grid dimensions
+       @param[in] block The block dimensions
+       @param[in] arg Host address of the kernel argument
+     */
+    void launch_grid(void (*kernel)(const void *), const dim3 grid, const dim3 block, const void *arg)
+    {
+      const int64_t n_block = static_cast<int64_t>(grid.x) * grid.y * grid.z;
+      const int n_threads = std::max(1, static_cast<int>(std::min<int64_t>(host::max_threads(), n_block)));
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(n_threads)
+#endif
+      {
+        auto &state = target::cpu::state;
+        state.grid_dim = grid;
+        state.block_dim = block;
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int64_t b = 0; b < n_block; b++) {
+          state.block_idx = dim3(b % grid.x, (b / grid.x) % grid.y, b / (static_cast<int64_t>(grid.x) * grid.y));
+          for (unsigned int z = 0; z < block.z; z++) {
+            for (unsigned int y = 0; y < block.y; y++) {
+              for (unsigned int x = 0; x < block.x; x++) {
+                state.thread_idx = dim3(x, y, z);
+                kernel(arg);
+              }
+            }
+          }
+        }
+
+        // restore the single-thread grid seen outside of kernels
+        state = target::cpu::grid_state();
+      }
+    }
+  } // namespace
+
+  qudaError_t qudaLaunchKernel(const void *func, const TuneParam &tp, const qudaStream_t &, const void *arg)
+  {
+    if (tp.shared_bytes > target::cpu::shared_memory_bytes) {
+      last_error = QUDA_ERROR;
+      last_error_str = "CPU_ERROR_LAUNCH_OUT_OF_RESOURCES";
+      if (!activeTuning())
+        errorQuda("Requested shared memory %u exceeds the maximum %u", tp.shared_bytes, target::cpu::shared_memory_bytes);
+      return QUDA_ERROR;
+    }
+
+    auto kernel = reinterpret_cast<void (*)(const void *)>(func);
+    PROFILE(launch_grid(kernel, tp.grid, tp.block, arg), QUDA_PROFILE_LAUNCH_KERNEL);
+
+    return QUDA_SUCCESS;
+  }
+
+  void qudaMemcpy_(void *dst, const void *src, size_t count, qudaMemcpyKind, const char *, const char *, const char *)
+  {
+    if (count == 0) return;
+    memcpy(dst, src, count);
+  }
+
+  void qudaMemcpyAsync_(void *dst, const void *src, size_t count, qudaMemcpyKind kind, const qudaStream_t &,
+                        const char *, const char *, const char *)
+  {
+    if (count == 0) return;
+    PROFILE(memcpy(dst, src, count),
+            kind == qudaMemcpyDeviceToHost ? QUDA_PROFILE_MEMCPY_D2H_ASYNC : QUDA_PROFILE_MEMCPY_H2D_ASYNC);
+  }
+
+  void qudaMemcpyP2PAsync_(void *dst, const void *src, size_t count, const qudaStream_t &, const char *, const char *,
+                           const char *)
+  {
+    if (count == 0) return;
+    memcpy(dst, src, count);
+  }
+
+  void qudaMemset_(void *ptr, int value, size_t count, const char *, const char *, const char *)
+  {
+    if (count == 0) return;
+    memset(ptr, value, count);
+  }
+
+  void qudaMemsetAsync_(void *ptr, int value, size_t count, const qudaStream_t &, const char *, const char *,
+                        const char *)
+  {
+    if (count == 0) return;
+    memset(ptr, value, count);
+  }
+
+  void qudaMemset2D_(void *ptr, size_t pitch, int value, size_t width, size_t height, const char *, const char *,
+                     const char *)
+  {
+    for (size_t i = 0; i < height; i++) memset(static_cast<char *>(ptr) + i * pitch, value, width);
+  }
+
+  void qudaMemset2DAsync_(void *ptr, size_t pitch, int value, size_t width, size_t height, const qudaStream_t &,
+                          const char *func, const char *file, const char *line)
+  {
+    qudaMemset2D_(ptr, pitch, value, width, height, func, file, line);
+  }
+
+  void qudaMemPrefetchAsync_(void *, size_t, QudaFieldLocation, const qudaStream_t &, const char *, const char *,
+                             const char *)
+  {
+    // No prefetch
+  }
+
+  namespace
+  {
+    /**
+       An event holds the host time at which it was last recorded
+     */
+    struct host_event {
+      std::chrono::steady_clock::time_point time;
+    };
+
+    host_event &get_event(const qudaEvent_t &quda_event) { return *static_cast<host_event *>(quda_event.event); }
+  } // namespace
+
+  bool qudaEventQuery_(qudaEvent_t &, const char *, const char *, const char *) { return true; }
+
+  void qudaEventRecord_(qudaEvent_t &quda_event, qudaStream_t, const char *, const char *, const char *)
+  {
+    PROFILE(get_event(quda_event).time = std::chrono::steady_clock::now(), QUDA_PROFILE_EVENT_RECORD);
+  }
+
+  void qudaStreamWaitEvent_(qudaStream_t, qudaEvent_t, unsigned int, const char *, const char *, const char *) { }
+
+  qudaEvent_t qudaEventCreate_(const char *, const char *, const char *)
+  {
+    qudaEvent_t quda_event;
+    quda_event.event = new host_event;
+    return quda_event;
+  }
+
+  qudaEvent_t qudaChronoEventCreate_(const char *func, const char *file, const char *line)
+  {
+    return qudaEventCreate_(func, file, line);
+  }
+
+  float qudaEventElapsedTime_(const qudaEvent_t &quda_start, const qudaEvent_t &quda_end, const char *, const char *,
+                              const char *)
+  {
+    return std::chrono::duration<float>(get_event(quda_end).time - get_event(quda_start).time).count();
+  }
+
+  void qudaEventDestroy_(qudaEvent_t &event, const char *, const char *, const char *)
+  {
+    delete static_cast<host_event *>(event.event);
+    event.event = nullptr;
+  }
+
+  void qudaEventSynchronize_(const qudaEvent_t &, const char *, const char *, const char *) { }
+
+  void qudaStreamSynchronize_(const qudaStream_t &, const char *, const char *, const char *) { }
+
+  void qudaDeviceSynchronize_(const char *, const char *, const char *) { }
+
+  void *qudaGetSymbolAddress_(const char *symbol, const char *, const char *, const char *)
+  {
+    return const_cast<char *>(symbol);
+  }
+
+  void printAPIProfile()
+  {
+#ifdef API_PROFILE
+    apiTimer.Print();
+#endif
+  }
+
+} // namespace quda
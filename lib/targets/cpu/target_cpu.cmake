@@ -0,0 +1,46 @@
+# ######################################################################################################################
+# CPU specific part of CMakeLists: the kernels are compiled as host C++ and run by the host launcher
+set(QUDA_TARGET_CPU ON)
+
+# the block orthogonalization and coarse-operator kernels need thread blocks larger than the single-thread blocks of
+# this target
+if(QUDA_MULTIGRID)
+  message(FATAL_ERROR "QUDA_MULTIGRID is not supported by the CPU target, configure with -DQUDA_MULTIGRID=OFF")
+endif()
+
+if(NOT QUDA_OPENMP)
+  message(WARNING "The CPU target without QUDA_OPENMP runs all kernels on a single host thread")
+endif()
+
+# ######################################################################################################################
+# CPU specific QUDA options options
+set(QUDA_HETEROGENEOUS_ATOMIC OFF)
+mark_as_advanced(QUDA_HETEROGENEOUS_ATOMIC)
+
+# QUDA_HASH for tunecache
+set(HASH cpu_arch=${CPU_ARCH},cxx_compiler=${CMAKE_CXX_COMPILER_ID}-${CMAKE_CXX_COMPILER_VERSION})
+set(GITVERSION "${PROJECT_VERSION}-${GITVERSION}-cpu")
+
+# ######################################################################################################################
+# cpu specific compile options
+
+target_include_directories(quda PRIVATE ${CMAKE_SOURCE_DIR}/include/targets/cpu)
+target_include_directories(quda PUBLIC $<BUILD_INTERFACE:${CMAKE_BINARY_DIR}/include/targets/cpu>
+                                       $<INSTALL_INTERFACE:include/targets/cpu>)
+
+target_compile_options(
+  quda
+  PRIVATE -Wall
+          -Wextra
+          -Wno-unknown-pragmas
+          -Wno-unused-parameter
+          $<$<CONFIG:STRICT>:-Werror>
+          $<$<CONFIG:SANITIZE>:-fsanitize=address
+          -fsanitize=undefined>)
+
+# the .cu sources are plain C++ for this target
+set_source_files_properties(${QUDA_CU_OBJS} PROPERTIES LANGUAGE CXX COMPILE_OPTIONS "-xc++")
+
+add_subdirectory(targets/cpu)
+
+install(FILES ${CMAKE_SOURCE_DIR}/cmake/find_target_cpu_dependencies.cmake DESTINATION lib/cmake/QUDA)
@@ -239,6 +239,12 @@ if(${CMAKE_CUDA_COMPILER_VERSION} VERSION_LESS "11.5")
             "SHELL: -Xcudafe --diag_suppress=177" >)
 endif()
 
+# enable OpenMP for the host code in the CUDA sources, used by the host kernel launchers
+if(QUDA_OPENMP)
+  target_compile_options(quda PRIVATE $<$<COMPILE_LANG_AND_ID:CUDA,NVIDIA>:-Xcompiler=${OpenMP_CXX_FLAGS}>
+                                      $<$<COMPILE_LANG_AND_ID:CUDA,Clang>:${OpenMP_CXX_FLAGS}>)
+endif()
+
 target_compile_options(
   quda 
   PRIVATE $<$<COMPILE_LANG_AND_ID:CUDA,NVHPC>:
@@ -0,0 +1,228 @@
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <util_quda.h>
+#include <blas_host_simd.h>
+#include <reduction_kernel_host.h>
+
+// the scalar fallback is compiled in this translation unit
+#define QUDA_HOST_SIMD_ISA scalar
+#include "blas_host_simd_impl.h"
+
+namespace quda
+{
+
+  namespace blas
+  {
+
+    namespace simd
+    {
+
+#ifdef QUDA_HOST_SIMD_AVX2
+      namespace avx2
+      {
+        template <typename real> const kernel_table<real> &kernels();
+      }
+#endif
+
+#ifdef QUDA_HOST_SIMD_AVX512
+      namespace avx512
+      {
+        template <typename real> const kernel_table<real> &kernels();
+      }
+#endif
+
+      /**
+         Number of real numbers in each chunk that is handed out to
+         the host threads.  This is fixed so that the shape of the
+         reductions is independent of the number of threads.
+       */
+      constexpr size_t chunk = 16384;
+
+      /**
+         @brief Return whether the CPU supports a given instruction set
+       */
+      static bool supported(isa_t isa)
+      {
+        switch (isa) {
+        case isa_t::scalar: return true;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#ifdef QUDA_HOST_SIMD_AVX2
+        case isa_t::avx2: return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+#ifdef QUDA_HOST_SIMD_AVX512
+        case isa_t::avx512: return __builtin_cpu_supports("avx512f");
+#endif
+#endif
+        default: return false;
+        }
+      }
+
+      static bool simd_enabled = true;
+
+      static isa_t init_isa()
+      {
+        isa_t isa = supported(isa_t::avx512) ? isa_t::avx512 : supported(isa_t::avx2) ? isa_t::avx2 : isa_t::scalar;
+
+        char *isa_env = getenv("QUDA_HOST_SIMD");
+        if (isa_env) {
+          if (strcmp(isa_env, "off") == 0) {
+            simd_enabled = false;
+          } else {
+            isa_t requested = isa_t::scalar;
+            if (strcmp(isa_env, "scalar") == 0) requested = isa_t::scalar;
+            else if (strcmp(isa_env, "avx2") == 0) requested = isa_t::avx2;
+            else if (strcmp(isa_env, "avx512") == 0) requested = isa_t::avx512;
+            else errorQuda("Invalid QUDA_HOST_SIMD=%s", isa_env);
+            if (!supported(requested)) errorQuda("QUDA_HOST_SIMD=%s not compiled in or not supported by this CPU", isa_env);
+            isa = requested;
+          }
+        }
+        return isa;
+      }
+
+      isa_t isa()
+      {
+        static const isa_t isa = init_isa();
+        return isa;
+      }
+
+      bool enabled()
+      {
+        isa(); // ensure the environment has been parsed
+        return simd_enabled;
+      }
+
+      template <typename real> static const kernel_table<real> &kernels()
+      {
+        switch (isa()) {
+#ifdef QUDA_HOST_SIMD_AVX2
+        case isa_t::avx2: return avx2::kernels<real>();
+#endif
+#ifdef QUDA_HOST_SIMD_AVX512
+        case isa_t::avx512: return avx512::kernels<real>();
+#endif
+        default: return scalar::kernels<real>();
+        }
+      }
+
+      /**
+         @brief Split the range [0, n) into fixed-size chunks and
+         distribute these among the host threads
+         @param[in] n Length of the range
+         @param[in] param Host launch parameters
+         @param[in] body Callable invoked as body(c, begin, end) for each chunk c
+       */
+      template <typename Body> static void parallel_for(size_t n, const host::launch_param &param, Body body)
+      {
+        if (n % 2 != 0) errorQuda("Length %lu is not even", n);
+        const int64_t n_chunk = (n + chunk - 1) / chunk;
+        auto compute_chunk = [&](int64_t c) { body(c, c * chunk, std::min((c + 1) * chunk, n)); };
+
+#ifdef _OPENMP
+        const int n_threads = static_cast<int>(std::max(std::min(static_cast<int64_t>(param.threads), n_chunk), int64_t(1)));
+#pragma omp parallel num_threads(n_threads) if (n_threads > 1)
+        {
+          if (param.dynamic) {
+#pragma omp for schedule(dynamic, 1)
+            for (int64_t c = 0; c < n_chunk; c++) compute_chunk(c);
+          } else {
+#pragma omp for schedule(static)
+            for (int64_t c = 0; c < n_chunk; c++) compute_chunk(c);
+          }
+        }
+#else
+        for (int64_t c = 0; c < n_chunk; c++) compute_chunk(c);
+#endif
+      }
+
+      /**
+         Reducer used to combine the per-chunk partial sums
+       */
+      struct sum_reducer {
+        static double init() { return 0.0; }
+        double operator()(double a, double b) const { return a + b; }
+      };
+
+      template <typename real>
+      void axpbyz(real a, const real *x, real b, const real *y, real *z, size_t n, const host::launch_param &param)
+      {
+        const auto &k = kernels<real>();
+        parallel_for(n, param, [&](int64_t, size_t begin, size_t end) {
+          k.axpbyz(a, x + begin, b, y + begin, z + begin, end - begin);
+        });
+      }
+
+      template <typename real>
+      void caxpy(const complex<real> &a, const real *x, real *y, size_t n, const host::launch_param &param)
+      {
+        const auto &k = kernels<real>();
+        parallel_for(n, param, [&](int64_t, size_t begin, size_t end) {
+          k.caxpy(a.real(), a.imag(), x + begin, y + begin, end - begin);
+        });
+      }
+
+      template <typename real>
+      void axpyZpbx(real a, real *x, real *y, const real *z, real b, size_t n, const host::launch_param &param)
+      {
+        const auto &k = kernels<real>();
+        parallel_for(n, param, [&](int64_t, size_t begin, size_t end) {
+          k.axpyZpbx(a, x + begin, y + begin, z + begin, b, end - begin);
+        });
+      }
+
+      template <typename real> double norm2(const real *x, size_t n, const host::launch_param &param)
+      {
+        const auto &k = kernels<real>();
+        std::vector<double> partial((n + chunk - 1) / chunk);
+        parallel_for(n, param,
+                     [&](int64_t c, size_t begin, size_t end) { partial[c] = k.norm2(x + begin, end - begin); });
+        return host::tree_reduce(sum_reducer(), partial.data(), partial.size());
+      }
+
+      template <typename real>
+      array<double, 2> cDotProduct(const real *x, const real *y, size_t n, const host::launch_param &param)
+      {
+        const auto &k = kernels<real>();
+        std::vector<double> partial_re((n + chunk - 1) / chunk, 0.0);
+        std::vector<double> partial_im((n + chunk - 1) / chunk, 0.0);
+        parallel_for(n, param, [&](int64_t c, size_t begin, size_t end) {
+          k.cDotProduct(x + begin, y + begin, end - begin, partial_re[c], partial_im[c]);
+        });
+        return {host::tree_reduce(sum_reducer(), partial_re.data(), partial_re.size()),
+                host::tree_reduce(sum_reducer(), partial_im.data(), partial_im.size())};
+      }
+
+      template <typename real>
+      double axpbyzNorm(real a, const real *x, real b, const real *y, real *z, size_t n, const host::launch_param &param)
+      {
+        const auto &k = kernels<real>();
+        std::vector<double> partial((n + chunk - 1) / chunk);
+        parallel_for(n, param, [&](int64_t c, size_t begin, size_t end) {
+          partial[c] = k.axpbyzNorm(a, x + begin, b, y + begin, z + begin, end - begin);
+        });
+        return host::tree_reduce(sum_reducer(), partial.data(), partial.size());
+      }
+
+      template void axpbyz<float>(float, const float *, float, const float *, float *, size_t, const host::launch_param &);
+      template void axpbyz<double>(double, const double *, double, const double *, double *, size_t,
+                                   const host::launch_param &);
+      template void caxpy<float>(const complex<float> &, const float *, float *, size_t, const host::launch_param &);
+      template void caxpy<double>(const complex<double> &, const double *, double *, size_t, const host::launch_param &);
+      template void axpyZpbx<float>(float, float *, float *, const float *, float, size_t, const host::launch_param &);
+      template void axpyZpbx<double>(double, double *, double *, const double *, double, size_t,
+                                     const host::launch_param &);
+      template double norm2<float>(const float *, size_t, const host::launch_param &);
+      template double norm2<double>(const double *, size_t, const host::launch_param &);
+      template array<double, 2> cDotProduct<float>(const float *, const float *, size_t, const host::launch_param &);
+      template array<double, 2> cDotProduct<double>(const double *, const double *, size_t, const host::launch_param &);
+      template double axpbyzNorm<float>(float, const float *, float, const float *, float *, size_t,
+                                        const host::launch_param &);
+      template double axpbyzNorm<double>(double, const double *, double, const double *, double *, size_t,
+                                         const host::launch_param &);
+
+    } // namespace simd
+
+  } // namespace blas
+
+} // namespace quda
@@ -0,0 +1,26 @@
+// compiled with the avx2 target flags (see CMakeLists.txt)
+#define QUDA_HOST_SIMD_ISA avx2
+#include "blas_host_simd_impl.h"
+
+namespace quda
+{
+
+  namespace blas
+  {
+
+    namespace simd
+    {
+
+      namespace avx2
+      {
+
+        template const kernel_table<float> &kernels<float>();
+        template const kernel_table<double> &kernels<double>();
+
+      } // namespace avx2
+
+    } // namespace simd
+
+  } // namespace blas
+
+} // namespace quda
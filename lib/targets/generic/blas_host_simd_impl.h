@@ -0,0 +1,265 @@
+#pragma once
+
+#include <cstddef>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+// some versions of the intrinsics headers trip uninitialized-variable warnings (GCC bug 105593)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+/**
+   @file blas_host_simd_impl.h
+
+   @section Implementation of the vectorized host BLAS kernels.  This
+   file is included by one translation unit per instruction set, each
+   of which is compiled with the matching target flags and defines
+   QUDA_HOST_SIMD_ISA to name the namespace its kernels live in (this
+   keeps the differently compiled instantiations distinct).  The
+   kernels process a contiguous range of real numbers and are
+   single-threaded: the threading is done by the dispatcher in
+   blas_host_simd.cpp.
+ */
+
+#ifndef QUDA_HOST_SIMD_ISA
+#error "QUDA_HOST_SIMD_ISA must be defined before including blas_host_simd_impl.h"
+#endif
+
+namespace quda
+{
+
+  namespace blas
+  {
+
+    namespace simd
+    {
+
+      /**
+         Table of the single-threaded range kernels for a given
+         precision, as exported by each instruction-set translation unit
+       */
+      template <typename real> struct kernel_table {
+        void (*axpbyz)(real a, const real *x, real b, const real *y, real *z, size_t n);
+        void (*caxpy)(real a_re, real a_im, const real *x, real *y, size_t n);
+        void (*axpyZpbx)(real a, real *x, real *y, const real *z, real b, size_t n);
+        double (*norm2)(const real *x, size_t n);
+        void (*cDotProduct)(const real *x, const real *y, size_t n, double &re, double &im);
+        double (*axpbyzNorm)(real a, const real *x, real b, const real *y, real *z, size_t n);
+      };
+
+      namespace QUDA_HOST_SIMD_ISA
+      {
+
+        /**
+           Portable two-wide vector that is used for the scalar
+           fallback and for the remainder of each range.  It is two
+           wide so that each complex number occupies a single vector.
+         */
+        struct scalar_vec {
+          static constexpr int width = 2;
+          double v[2];
+
+          static scalar_vec set1(double a) { return {{a, a}}; }
+          static scalar_vec set_alt(double even, double odd) { return {{even, odd}}; }
+          template <typename real> static scalar_vec load(const real *p) { return {{double(p[0]), double(p[1])}}; }
+          template <typename real> void store(real *p) const
+          {
+            p[0] = static_cast<real>(v[0]);
+            p[1] = static_cast<real>(v[1]);
+          }
+        };
+
+        inline scalar_vec fmadd(const scalar_vec &a, const scalar_vec &b, const scalar_vec &c)
+        {
+          return {{a.v[0] * b.v[0] + c.v[0], a.v[1] * b.v[1] + c.v[1]}};
+        }
+        inline scalar_vec mul(const scalar_vec &a, const scalar_vec &b) { return {{a.v[0] * b.v[0], a.v[1] * b.v[1]}}; }
+        inline scalar_vec swap_pairs(const scalar_vec &a) { return {{a.v[1], a.v[0]}}; }
+        inline double hsum(const scalar_vec &a) { return a.v[0] + a.v[1]; }
+
+#if defined(__AVX512F__)
+        struct simd_vec {
+          static constexpr int width = 8;
+          __m512d v;
+
+          static simd_vec set1(double a) { return {_mm512_set1_pd(a)}; }
+          static simd_vec set_alt(double even, double odd)
+          {
+            return {_mm512_setr_pd(even, odd, even, odd, even, odd, even, odd)};
+          }
+          static simd_vec load(const double *p) { return {_mm512_loadu_pd(p)}; }
+          static simd_vec load(const float *p) { return {_mm512_cvtps_pd(_mm256_loadu_ps(p))}; }
+          void store(double *p) const { _mm512_storeu_pd(p, v); }
+          void store(float *p) const { _mm256_storeu_ps(p, _mm512_cvtpd_ps(v)); }
+        };
+
+        inline simd_vec fmadd(const simd_vec &a, const simd_vec &b, const simd_vec &c)
+        {
+          return {_mm512_fmadd_pd(a.v, b.v, c.v)};
+        }
+        inline simd_vec mul(const simd_vec &a, const simd_vec &b) { return {_mm512_mul_pd(a.v, b.v)}; }
+        inline simd_vec swap_pairs(const simd_vec &a) { return {_mm512_permute_pd(a.v, 0x55)}; }
+        inline double hsum(const simd_vec &a) { return _mm512_reduce_add_pd(a.v); }
+#elif defined(__AVX2__) && defined(__FMA__)
+        struct simd_vec {
+          static constexpr int width = 4;
+          __m256d v;
+
+          static simd_vec set1(double a) { return {_mm256_set1_pd(a)}; }
+          static simd_vec set_alt(double even, double odd) { return {_mm256_setr_pd(even, odd, even, odd)}; }
+          static simd_vec load(const double *p) { return {_mm256_loadu_pd(p)}; }
+          static simd_vec load(const float *p) { return {_mm256_cvtps_pd(_mm_loadu_ps(p))}; }
+          void store(double *p) const { _mm256_storeu_pd(p, v); }
+          void store(float *p) const { _mm_storeu_ps(p, _mm256_cvtpd_ps(v)); }
+        };
+
+        inline simd_vec fmadd(const simd_vec &a, const simd_vec &b, const simd_vec &c)
+        {
+          return {_mm256_fmadd_pd(a.v, b.v, c.v)};
+        }
+        inline simd_vec mul(const simd_vec &a, const simd_vec &b) { return {_mm256_mul_pd(a.v, b.v)}; }
+        inline simd_vec swap_pairs(const simd_vec &a) { return {_mm256_permute_pd(a.v, 0x5)}; }
+        inline double hsum(const simd_vec &a)
+        {
+          __m128d s = _mm_add_pd(_mm256_castpd256_pd128(a.v), _mm256_extractf128_pd(a.v, 1));
+          return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+        }
+#else
+        using simd_vec = scalar_vec;
+#endif
+
+        template <typename V, typename real>
+        void axpbyz(size_t begin, size_t end, real a, const real *x, real b, const real *y, real *z)
+        {
+          const V a_ = V::set1(a), b_ = V::set1(b);
+          for (size_t i = begin; i < end; i += V::width) fmadd(a_, V::load(x + i), mul(b_, V::load(y + i))).store(z + i);
+        }
+
+        template <typename V, typename real>
+        void caxpy(size_t begin, size_t end, real a_re, real a_im, const real *x, real *y)
+        {
+          // y_re += a_re * x_re - a_im * x_im, y_im += a_re * x_im + a_im * x_re
+          const V a_re_ = V::set1(a_re), a_im_ = V::set_alt(-a_im, a_im);
+          for (size_t i = begin; i < end; i += V::width) {
+            V x_ = V::load(x + i);
+            fmadd(a_im_, swap_pairs(x_), fmadd(a_re_, x_, V::load(y + i))).store(y + i);
+          }
+        }
+
+        template <typename V, typename real>
+        void axpyZpbx(size_t begin, size_t end, real a, real *x, real *y, const real *z, real b)
+        {
+          const V a_ = V::set1(a), b_ = V::set1(b);
+          for (size_t i = begin; i < end; i += V::width) {
+            V x_ = V::load(x + i);
+            fmadd(a_, x_, V::load(y + i)).store(y + i);
+            fmadd(b_, x_, V::load(z + i)).store(x + i);
+          }
+        }
+
+        template <typename V, typename real> double norm2(size_t begin, size_t end, const real *x)
+        {
+          V sum = V::set1(0.0);
+          for (size_t i = begin; i < end; i += V::width) {
+            V x_ = V::load(x + i);
+            sum = fmadd(x_, x_, sum);
+          }
+          return hsum(sum);
+        }
+
+        template <typename V, typename real>
+        void cDotProduct(size_t begin, size_t end, const real *x, const real *y, double &re, double &im)
+        {
+          // re += x_re * y_re + x_im * y_im, im += x_re * y_im - x_im * y_re
+          const V sign = V::set_alt(-1.0, 1.0);
+          V sum_re = V::set1(0.0), sum_im = V::set1(0.0);
+          for (size_t i = begin; i < end; i += V::width) {
+            V x_ = V::load(x + i), y_ = V::load(y + i);
+            sum_re = fmadd(x_, y_, sum_re);
+            sum_im = fmadd(mul(sign, swap_pairs(x_)), y_, sum_im);
+          }
+          re += hsum(sum_re);
+          im += hsum(sum_im);
+        }
+
+        template <typename V, typename real>
+        double axpbyzNorm(size_t begin, size_t end, real a, const real *x, real b, const real *y, real *z)
+        {
+          const V a_ = V::set1(a), b_ = V::set1(b);
+          V sum = V::set1(0.0);
+          for (size_t i = begin; i < end; i += V::width) {
+            V z_ = fmadd(a_, V::load(x + i), mul(b_, V::load(y + i)));
+            z_.store(z + i);
+            sum = fmadd(z_, z_, sum);
+          }
+          return hsum(sum);
+        }
+
+        /**
+           @brief Return the end of the part of a range that can be
+           processed with full-width vectors, with the remainder
+           processed with scalar_vec
+         */
+        inline size_t vector_end(size_t n) { return n - n % simd_vec::width; }
+
+        template <typename real> void axpbyz_range(real a, const real *x, real b, const real *y, real *z, size_t n)
+        {
+          axpbyz<simd_vec>(0, vector_end(n), a, x, b, y, z);
+          axpbyz<scalar_vec>(vector_end(n), n, a, x, b, y, z);
+        }
+
+        template <typename real> void caxpy_range(real a_re, real a_im, const real *x, real *y, size_t n)
+        {
+          caxpy<simd_vec>(0, vector_end(n), a_re, a_im, x, y);
+          caxpy<scalar_vec>(vector_end(n), n, a_re, a_im, x, y);
+        }
+
+        template <typename real> void axpyZpbx_range(real a, real *x, real *y, const real *z, real b, size_t n)
+        {
+          axpyZpbx<simd_vec>(0, vector_end(n), a, x, y, z, b);
+          axpyZpbx<scalar_vec>(vector_end(n), n, a, x, y, z, b);
+        }
+
+        template <typename real> double norm2_range(const real *x, size_t n)
+        {
+          return norm2<simd_vec>(0, vector_end(n), x) + norm2<scalar_vec>(vector_end(n), n, x);
+        }
+
+        template <typename real> void cDotProduct_range(const real *x, const real *y, size_t n, double &re, double &im)
+        {
+          cDotProduct<simd_vec>(0, vector_end(n), x, y, re, im);
+          cDotProduct<scalar_vec>(vector_end(n), n, x, y, re, im);
+        }
+
+        template <typename real>
+        double axpbyzNorm_range(real a, const real *x, real b, const real *y, real *z, size_t n)
+        {
+          return axpbyzNorm<simd_vec>(0, vector_end(n), a, x, b, y, z)
+            + axpbyzNorm<scalar_vec>(vector_end(n), n, a, x, b, y, z);
+        }
+
+        /**
+           @brief Return the table of range kernels compiled for this instruction set
+         */
+        template <typename real> const kernel_table<real> &kernels()
+        {
+          static const kernel_table<real> table
+            = {axpbyz_range<real>, caxpy_range<real>,       axpyZpbx_range<real>,
+               norm2_range<real>,  cDotProduct_range<real>, axpbyzNorm_range<real>};
+          return table;
+        }
+
+      } // namespace QUDA_HOST_SIMD_ISA
+
+    } // namespace simd
+
+  } // namespace blas
+
+} // namespace quda
@@ -0,0 +1,148 @@
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+#include <util_quda.h>
+#include <host_thread_helper.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace quda
+{
+
+  namespace host
+  {
+
+    static int default_threads()
+    {
+      static bool init = false;
+      static int threads = 1;
+
+      if (!init) {
+#ifdef _OPENMP
+        threads = omp_get_max_threads();
+#endif
+        char *threads_env = getenv("QUDA_HOST_THREADS");
+        if (threads_env) {
+          int n = atoi(threads_env);
+          if (n < 1) errorQuda("Invalid QUDA_HOST_THREADS=%s", threads_env);
+#ifndef _OPENMP
+          if (n > 1) warningQuda("QUDA_HOST_THREADS=%d ignored since OpenMP is not enabled", n);
+#else
+          threads = n;
+#endif
+        }
+        init = true;
+      }
+      return threads;
+    }
+
+    static int threads_override = 0;
+
+    int max_threads() { return threads_override > 0 ? threads_override : default_threads(); }
+
+    void set_max_threads(int n_threads)
+    {
+#ifndef _OPENMP
+      if (n_threads > 1) warningQuda("Requested %d host threads but OpenMP is not enabled", n_threads);
+      n_threads = 1;
+#endif
+      threads_override = n_threads;
+    }
+
+    static dim3 default_chunk()
+    {
+      static bool init = false;
+      static dim3 chunk(0, 0, 0);
+
+      if (!init) {
+        char *chunk_env = getenv("QUDA_HOST_CHUNK");
+        if (chunk_env) { // comma-separated list of chunk extents, e.g., 1024,1,1
+          std::stringstream chunk_list(chunk_env);
+          unsigned int extent[3] = {0, 0, 0};
+          int d = 0;
+          while (d < 3 && chunk_list >> extent[d]) {
+            d++;
+            if (chunk_list.peek() == ',') chunk_list.ignore();
+          }
+          if (d == 0 || !chunk_list.eof()) errorQuda("Invalid QUDA_HOST_CHUNK=%s", chunk_env);
+          chunk = dim3(extent[0], extent[1], extent[2]);
+        }
+        init = true;
+      }
+      return chunk;
+    }
+
+    static bool chunk_set = false;
+    static dim3 chunk_override(0, 0, 0);
+
+    dim3 chunk() { return chunk_set ? chunk_override : default_chunk(); }
+
+    void set_chunk(const dim3 &chunk)
+    {
+      chunk_override = chunk;
+      chunk_set = true;
+    }
+
+    /**
+       @brief Candidate chunk extents.  Zero (automatic) comes first,
+       so that the search starts from the default partitioning.
+     */
+    static const std::vector<unsigned int> chunk_x_candidates = {0, 256, 1024, 4096, 16384};
+    static const std::vector<unsigned int> chunk_yz_candidates = {0, 1};
+
+    /**
+       @brief Advance a value to the next entry of a candidate list,
+       wrapping around to the first entry at the end of the list
+       @return Whether the value was advanced without wrapping
+     */
+    static bool advance_candidate(unsigned int &value, const std::vector<unsigned int> &candidates)
+    {
+      auto it = std::find(candidates.begin(), candidates.end(), value);
+      if (it != candidates.end() && ++it != candidates.end()) {
+        value = *it;
+        return true;
+      }
+      value = candidates[0];
+      return false;
+    }
+
+    void init_tune_param(TuneParam &tp, int chunk_dim)
+    {
+      launch_param param;
+      param.threads = 1;
+      param.dynamic = false;
+      param.chunk = dim3(chunk_dim > 0 ? chunk_x_candidates[0] : chunk().x, chunk_dim > 1 ? chunk_yz_candidates[0] : chunk().y,
+                         chunk_dim > 2 ? chunk_yz_candidates[0] : chunk().z);
+      set_launch_param(tp, param);
+    }
+
+    bool advance_tune_param(TuneParam &tp, int chunk_dim)
+    {
+      launch_param param = get_launch_param(tp);
+      bool advanced = false;
+
+      if (param.threads < max_threads()) {
+        param.threads = std::min(2 * param.threads, max_threads());
+        advanced = true;
+      } else {
+        param.threads = 1;
+        if (!param.dynamic) {
+          param.dynamic = true;
+          advanced = true;
+        } else {
+          param.dynamic = false;
+          advanced = (chunk_dim > 0 && advance_candidate(param.chunk.x, chunk_x_candidates))
+            || (chunk_dim > 1 && advance_candidate(param.chunk.y, chunk_yz_candidates))
+            || (chunk_dim > 2 && advance_candidate(param.chunk.z, chunk_yz_candidates));
+        }
+      }
+
+      set_launch_param(tp, param);
+      return advanced;
+    }
+
+  } // namespace host
+
+} // namespace quda
@@ -5,6 +5,9 @@
 #include <unistd.h>   // for getpagesize()
 #include <execinfo.h> // for backtrace
 #include <quda_internal.h>
+#include <memory_pool.h>
+#include <host_numa.h>
+#include <alloc_trace.h>
 #include <device.h>
 
 #include <hip/hip_runtime.h>
@@ -97,6 +100,12 @@ namespace quda
     }
   }
 
+  /** names of the allocation types in the allocation trace */
+  static const char *alloc_trace_kind[] = {"device", "device pinned", "host", "pinned", "mapped", "managed"};
+
+  /** whether the allocation is a slab of a memory pool, in which case the blocks of the pool are traced instead */
+  static bool pool_slab = false;
+
   static void track_malloc(const AllocType &type, const MemAlloc &a, void *ptr)
   {
     total_bytes[type] += a.base_size;
@@ -110,6 +119,11 @@ namespace quda
       if (total_pinned_bytes > max_total_pinned_bytes) { max_total_pinned_bytes = total_pinned_bytes; }
     }
     alloc[type][ptr] = a;
+    if (alloc_trace::enabled() && !pool_slab) {
+      const bool device = type == DEVICE || type == DEVICE_PINNED;
+      alloc_trace::record_alloc(alloc_trace_kind[type], device, ptr, a.base_size, a.func.c_str(), a.file.c_str(),
+                                a.line);
+    }
   }
 
   static void track_free(const AllocType &type, void *ptr)
@@ -119,6 +133,7 @@ namespace quda
     if (type != DEVICE && type != DEVICE_PINNED) { total_host_bytes -= size; }
     if (type == PINNED || type == MAPPED) { total_pinned_bytes -= size; }
     alloc[type].erase(ptr);
+    if (alloc_trace::enabled()) alloc_trace::record_free(ptr);
   }
 
   /**
@@ -140,6 +155,7 @@ namespace quda
       errorQuda("Failed to allocate aligned host memory of size %zu (%s:%d in %s())\n", size, a.file.c_str(), a.line,
                 a.func.c_str());
     }
+    numa::place(ptr, a.base_size); // prior to any registration, which faults in the pages
     return ptr;
   }
 
@@ -211,6 +227,7 @@ namespace quda
     // Regular version
     hipError_t err = hipMalloc(&ptr, size);
     if (err != hipSuccess) {
+      alloc_trace::print_summary();
       errorQuda("Failed to allocate device memory of size %zu (%s:%d in %s())\n", size, file, line, func);
     }
 #else
@@ -244,6 +261,7 @@ namespace quda
     hipError_t err = hipMalloc(&ptr, size);
 
     if (err != hipSuccess) {
+      alloc_trace::print_summary();
       errorQuda("Failed to allocate device memory of size %zu (%s:%d in %s())\n", size, file, line, func);
     }
     track_malloc(DEVICE_PINNED, a, ptr);
@@ -265,6 +283,7 @@ namespace quda
 
     void *ptr = malloc(size);
     if (!ptr) { errorQuda("Failed to allocate host memory of size %zu (%s:%d in %s())\n", size, file, line, func); }
+    numa::place(ptr, size);
     track_malloc(HOST, a, ptr);
 #ifdef HOST_DEBUG
     // memset(ptr, 0xff, size);
@@ -497,6 +516,9 @@ namespace quda
     //    printfQuda("Shmem memory used = %.1f MiB\n", max_total_bytes[SHMEM] / (double)(1 << 20));
     printfQuda("Page-locked host memory used = %.1f MiB\n", max_total_pinned_bytes / (double)(1 << 20));
     printfQuda("Total host memory used >= %.1f MiB\n", max_total_host_bytes / (double)(1 << 20));
+
+    pool::print_stats();
+    alloc_trace::print_summary();
   }
 
   void assertAllMemFree()
@@ -567,26 +589,6 @@ namespace quda
   namespace pool
   {
 
-    /** Cache of inactive pinned-memory allocations.  We cache pinned
-        memory allocations so that fields can reuse these with minimal
-        overhead.*/
-    static std::multimap<size_t, void *> pinnedCache;
-
-    /** Sizes of active pinned-memory allocations.  For convenience,
-        we keep track of the sizes of active allocations (i.e., those not
-        in the cache). */
-    static std::map<void *, size_t> pinnedSize;
-
-    /** Cache of inactive device-memory allocations.  We cache pinned
-        memory allocations so that fields can reuse these with minimal
-        overhead.*/
-    static std::multimap<size_t, void *> deviceCache;
-
-    /** Sizes of active device-memory allocations.  For convenience,
-        we keep track of the sizes of active allocations (i.e., those not
-        in the cache). */
-    static std::map<void *, size_t> deviceSize;
-
     static bool pool_init = false;
 
     /** whether to use a memory pool allocator for device memory */
@@ -595,6 +597,65 @@ namespace quda
     /** whether to use a memory pool allocator for pinned memory */
     static bool pinned_memory_pool = true;
 
+    /** minimum size of the slabs the pools obtain from the underlying allocators */
+    static constexpr size_t pool_slab_bytes = 2 << 20;
+
+    /**
+       @brief The maximum fraction by which a block handed out by the
+       pools may exceed the request, before it is split, which is set
+       with the environment variable QUDA_MEMORY_POOL_MAX_WASTE
+       (default 0.25)
+     */
+    static double pool_max_waste()
+    {
+      static bool init = false;
+      static double max_waste = 0.25;
+
+      if (!init) {
+        char *max_waste_env = getenv("QUDA_MEMORY_POOL_MAX_WASTE");
+        if (max_waste_env) max_waste = std::strtod(max_waste_env, nullptr);
+        init = true;
+      }
+      return max_waste;
+    }
+
+    /** Pool of device-memory allocations, which fields can reuse with minimal overhead */
+    static MemoryPool &device_pool()
+    {
+      static MemoryPool pool("Device", quda::device_malloc_, quda::device_free_, pool_slab_bytes, pool_max_waste());
+      return pool;
+    }
+
+    /** Pool of pinned-memory allocations, which fields can reuse with minimal overhead */
+    static MemoryPool &pinned_pool()
+    {
+      static MemoryPool pool("Pinned", quda::pinned_malloc_, quda::host_free_, pool_slab_bytes, pool_max_waste());
+      return pool;
+    }
+
+    /**
+       @brief Allocate a block from a pool, which is traced in place of
+       any slab the pool obtains to serve it
+     */
+    static void *pool_allocate(MemoryPool &pool, const char *kind, bool device, const char *func, const char *file,
+                               int line, size_t nbytes)
+    {
+      pool_slab = true;
+      void *ptr = pool.allocate(func, file, line, nbytes);
+      pool_slab = false;
+      if (alloc_trace::enabled()) alloc_trace::record_alloc(kind, device, ptr, nbytes, func, file, line);
+      return ptr;
+    }
+
+    /**
+       @brief Return a block to a pool
+     */
+    static void pool_free(MemoryPool &pool, void *ptr)
+    {
+      if (alloc_trace::enabled()) alloc_trace::record_free(ptr);
+      pool.free(ptr);
+    }
+
     void init()
     {
       if (!pool_init) {
@@ -623,39 +684,14 @@ namespace quda
 
     void *pinned_malloc_(const char *func, const char *file, int line, size_t nbytes)
     {
-      void *ptr = nullptr;
-      if (pinned_memory_pool) {
-        std::multimap<size_t, void *>::iterator it;
-
-        if (pinnedCache.empty()) {
-          ptr = quda::pinned_malloc_(func, file, line, nbytes);
-        } else {
-          it = pinnedCache.lower_bound(nbytes);
-          if (it != pinnedCache.end()) { // sufficiently large allocation found
-            nbytes = it->first;
-            ptr = it->second;
-            pinnedCache.erase(it);
-          } else { // sacrifice the smallest cached allocation
-            it = pinnedCache.begin();
-            ptr = it->second;
-            pinnedCache.erase(it);
-            host_free(ptr);
-            ptr = quda::pinned_malloc_(func, file, line, nbytes);
-          }
-        }
-        pinnedSize[ptr] = nbytes;
-      } else {
-        ptr = quda::pinned_malloc_(func, file, line, nbytes);
-      }
-      return ptr;
+      return pinned_memory_pool ? pool_allocate(pinned_pool(), "pinned", false, func, file, line, nbytes) :
+                                  quda::pinned_malloc_(func, file, line, nbytes);
     }
 
     void pinned_free_(const char *func, const char *file, int line, void *ptr)
     {
       if (pinned_memory_pool) {
-        if (!pinnedSize.count(ptr)) { errorQuda("Attempt to free invalid pointer"); }
-        pinnedCache.insert(std::make_pair(pinnedSize[ptr], ptr));
-        pinnedSize.erase(ptr);
+        pool_free(pinned_pool(), ptr);
       } else {
         quda::host_free_(func, file, line, ptr);
       }
@@ -663,39 +699,14 @@ namespace quda
 
     void *device_malloc_(const char *func, const char *file, int line, size_t nbytes)
     {
-      void *ptr = nullptr;
-      if (device_memory_pool) {
-        std::multimap<size_t, void *>::iterator it;
-
-        if (deviceCache.empty()) {
-          ptr = quda::device_malloc_(func, file, line, nbytes);
-        } else {
-          it = deviceCache.lower_bound(nbytes);
-          if (it != deviceCache.end()) { // sufficiently large allocation found
-            nbytes = it->first;
-            ptr = it->second;
-            deviceCache.erase(it);
-          } else { // sacrifice the smallest cached allocation
-            it = deviceCache.begin();
-            ptr = it->second;
-            deviceCache.erase(it);
-            quda::device_free_(func, file, line, ptr);
-            ptr = quda::device_malloc_(func, file, line, nbytes);
-          }
-        }
-        deviceSize[ptr] = nbytes;
-      } else {
-        ptr = quda::device_malloc_(func, file, line, nbytes);
-      }
-      return ptr;
+      return device_memory_pool ? pool_allocate(device_pool(), "device", true, func, file, line, nbytes) :
+                                  quda::device_malloc_(func, file, line, nbytes);
     }
 
     void device_free_(const char *func, const char *file, int line, void *ptr)
     {
       if (device_memory_pool) {
-        if (!deviceSize.count(ptr)) { errorQuda("Attempt to free invalid pointer"); }
-        deviceCache.insert(std::make_pair(deviceSize[ptr], ptr));
-        deviceSize.erase(ptr);
+        pool_free(device_pool(), ptr);
       } else {
         quda::device_free_(func, file, line, ptr);
       }
@@ -703,26 +714,18 @@ namespace quda
 
     void flush_pinned()
     {
-      if (pinned_memory_pool) {
-        std::multimap<size_t, void *>::iterator it;
-        for (it = pinnedCache.begin(); it != pinnedCache.end(); it++) {
-          void *ptr = it->second;
-          host_free(ptr);
-        }
-        pinnedCache.clear();
-      }
+      if (pinned_memory_pool) pinned_pool().flush();
     }
 
     void flush_device()
     {
-      if (device_memory_pool) {
-        std::multimap<size_t, void *>::iterator it;
-        for (it = deviceCache.begin(); it != deviceCache.end(); it++) {
-          void *ptr = it->second;
-          device_free(ptr);
-        }
-        deviceCache.clear();
-      }
+      if (device_memory_pool) device_pool().flush();
+    }
+
+    void print_stats()
+    {
+      if (device_memory_pool) device_pool().print_stats();
+      if (pinned_memory_pool) pinned_pool().print_stats();
     }
 
   } // namespace pool
@@ -108,6 +108,11 @@ target_compile_options(
           -fsanitize=undefined>)
 
 set_source_files_properties( ${QUDA_CU_OBJS} PROPERTIES LANGUAGE HIP)
+
+# enable OpenMP for the host code in the HIP sources, used by the host kernel launchers
+if(QUDA_OPENMP)
+  target_compile_options(quda PRIVATE $<$<COMPILE_LANGUAGE:HIP>:${OpenMP_CXX_FLAGS}>)
+endif()
 # malloc.cpp uses both the driver and runtime api So we need to find the CUDA_CUDA_LIBRARY (driver api) or the stub
 # version for cmake 3.8 and later this has been integrated into  FindCUDALibs.cmake
 target_link_libraries(quda PUBLIC hip::hiprand roc::rocrand hip::hipcub roc::rocprim_hip)
@@ -0,0 +1,166 @@
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <timeline.h>
+#include <util_quda.h>
+#include "externals/json.hpp"
+
+namespace quda
+{
+
+  namespace timeline
+  {
+
+    using json = nlohmann::json;
+
+    struct event_t {
+      std::string name;
+      const char *category;
+      double start;
+      double duration;
+      args_t args;
+    };
+
+    /**
+       The epoch of the timeline, which is recorded with both the
+       steady clock used for the timestamps and the system clock,
+       which is used to align the timelines of different processes
+     */
+    static const auto epoch = std::chrono::steady_clock::now();
+    static const auto system_epoch = std::chrono::system_clock::now();
+
+    static std::vector<event_t> events;
+    static std::mutex events_mutex;
+    static size_t dropped = 0;
+
+    bool enabled()
+    {
+      static bool init = false;
+      static bool enable = false;
+
+      if (!init) {
+        char *enable_timeline_env = getenv("QUDA_ENABLE_TIMELINE");
+        if (enable_timeline_env && strcmp(enable_timeline_env, "1") == 0) enable = true;
+        init = true;
+      }
+      return enable;
+    }
+
+    /**
+       @brief The maximum number of events recorded, which is set with
+       the QUDA_TIMELINE_MAX_EVENTS environment variable (default
+       1000000), after which further events are dropped
+     */
+    static size_t max_events()
+    {
+      static bool init = false;
+      static size_t max = 1000000;
+
+      if (!init) {
+        char *max_events_env = getenv("QUDA_TIMELINE_MAX_EVENTS");
+        if (max_events_env) max = std::strtoull(max_events_env, nullptr, 10);
+        init = true;
+      }
+      return max;
+    }
+
+    double now() { return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - epoch).count(); }
+
+    void record(const std::string &name, const char *category, double start, double duration, const args_t &args)
+    {
+      std::lock_guard<std::mutex> lock(events_mutex);
+      if (events.size() < max_events()) {
+        events.push_back({name, category, start, duration, args});
+      } else {
+        dropped++;
+      }
+    }
+
+    void save(const std::string &path, int rank)
+    {
+      json trace_events = json::array();
+      std::map<std::string, int> tid; // each category is shown on its own track
+
+      {
+        std::lock_guard<std::mutex> lock(events_mutex);
+        for (auto &event : events) {
+          auto track = tid.emplace(event.category, tid.size() + 1).first->second;
+          json e = {{"name", event.name}, {"cat", event.category}, {"ph", "X"},  {"ts", event.start},
+                    {"dur", event.duration}, {"pid", rank},           {"tid", track}};
+          if (!event.args.empty()) {
+            json args = json::object();
+            for (auto &arg : event.args) args[arg.first] = arg.second;
+            e["args"] = args;
+          }
+          trace_events.push_back(e);
+        }
+      }
+
+      trace_events.push_back({{"name", "process_name"}, {"ph", "M"}, {"pid", rank}, {"args", {{"name", "rank " + std::to_string(rank)}}}});
+      for (auto &track : tid)
+        trace_events.push_back({{"name", "thread_name"},
+                                {"ph", "M"},
+                                {"pid", rank},
+                                {"tid", track.second},
+                                {"args", {{"name", track.first}}}});
+
+      const double system_epoch_us
+        = std::chrono::duration<double, std::micro>(system_epoch.time_since_epoch()).count();
+      json trace = {{"traceEvents", trace_events},
+                    {"displayTimeUnit", "ms"},
+                    {"otherData", {{"rank", rank}, {"epoch", system_epoch_us}, {"dropped", dropped}}}};
+
+      std::ofstream out(path);
+      if (!out) {
+        warningQuda("Unable to open %s.  Timeline will not be saved to disk.", path.c_str());
+        return;
+      }
+      out << trace.dump() << std::endl;
+      if (dropped > 0)
+        warningQuda("Timeline in %s is missing %lu events beyond QUDA_TIMELINE_MAX_EVENTS", path.c_str(), dropped);
+    }
+
+    void merge(const std::vector<std::string> &inputs, const std::string &output)
+    {
+      std::vector<json> traces;
+      double epoch_min = 0.0;
+      for (auto &input : inputs) {
+        std::ifstream in(input);
+        if (!in) errorQuda("Unable to open %s", input.c_str());
+        json trace;
+        try {
+          in >> trace;
+        } catch (const json::exception &e) {
+          errorQuda("Failed to parse %s: %s", input.c_str(), e.what());
+        }
+        if (!trace.contains("otherData") || !trace["otherData"].contains("epoch"))
+          errorQuda("%s is not a QUDA timeline", input.c_str());
+        double epoch = trace["otherData"]["epoch"];
+        epoch_min = traces.empty() ? epoch : std::min(epoch, epoch_min);
+        traces.push_back(std::move(trace));
+      }
+
+      // shift the events of each process by the offset of its epoch from the earliest one
+      json merged_events = json::array();
+      for (auto &trace : traces) {
+        const double offset = trace["otherData"]["epoch"].get<double>() - epoch_min;
+        for (auto &event : trace["traceEvents"]) {
+          if (event.contains("ts")) event["ts"] = event["ts"].get<double>() + offset;
+          merged_events.push_back(std::move(event));
+        }
+      }
+
+      json merged = {{"traceEvents", merged_events}, {"displayTimeUnit", "ms"}};
+      std::ofstream out(output);
+      if (!out) errorQuda("Unable to open %s", output.c_str());
+      out << merged.dump() << std::endl;
+
+      printfQuda("Merged %lu timelines with %lu events to %s\n", traces.size(), merged_events.size(), output.c_str());
+    }
+
+  } // namespace timeline
+
+} // namespace quda
@@ -7,6 +7,7 @@
 #include <multigrid.h>
 #include <tune_quda.h>
 #include <malloc_quda.h>
+#include <alloc_trace.h>
 
 #include <iostream>
 #include <algorithm>
@@ -50,6 +51,7 @@ namespace quda {
     flops_(0),
     profile(profile)
   {
+    alloc_trace::category_scope category("transfer");
     postTrace();
     int ndim = B[0]->Ndim();
 
@@ -234,6 +236,7 @@ namespace quda {
 
   void Transfer::reset()
   {
+    alloc_trace::category_scope category("transfer");
     postTrace();
 
     if (transfer_type == QUDA_TRANSFER_COARSE_KD || transfer_type == QUDA_TRANSFER_OPTIMIZED_KD
@@ -2,7 +2,10 @@
 #include <comm_quda.h>
 #include <quda.h>     // for QUDA_VERSION_STRING
 #include <timer.h>
+#include <timeline.h>
+#include <alloc_trace.h>
 #include <sys/stat.h> // for stat()
+#include <sys/mman.h> // for mmap()
 #include <fcntl.h>
 #include <cfloat> // for FLT_MAX
 #include <ctime>
@@ -13,11 +16,15 @@
 #include <unistd.h>
 #include <uint_to_char.h>
 #include <target_device.h>
+#include <host_thread_helper.h>
 
 #include <deque>
 #include <queue>
 #include <functional>
 #include <utility>
+#include <array>
+#include <algorithm>
+#include <cmath>
 #include <json_helper.h>
 
 #include <communicator_quda.h>
@@ -31,8 +38,6 @@ namespace quda
 
   TuneKey getLastTuneKey() { return quda::last_key; }
 
-  typedef std::map<TuneKey, TuneParam> map;
-
   struct TraceKey {
 
     TuneKey key;
@@ -102,9 +107,7 @@ namespace quda
 
   static const std::string quda_hash = QUDA_HASH; // defined in lib/Makefile
   static std::string resource_path;
-  static map tunecache;
-  static map::iterator it;
-  static size_t initial_cache_size = 0;
+  static TuneCache tunecache;
 
 #define STR_(x) #x
 #define STR(x) STR_(x)
@@ -124,12 +127,21 @@ namespace quda
   void disableProfileCount() { profile_count = false; }
   void enableProfileCount() { profile_count = true; }
 
-  const map &getTuneCache() { return tunecache; }
+  const TuneCache &getTuneCache() { return tunecache; }
+
+  std::vector<const TuneCache::entry_t *> TuneCache::sorted() const
+  {
+    std::vector<const entry_t *> s;
+    s.reserve(entries.size());
+    for (const auto &e : entries) s.push_back(&e);
+    std::sort(s.begin(), s.end(), [](const entry_t *a, const entry_t *b) { return a->first < b->first; });
+    return s;
+  }
 
   /**
-   * Deserialize tunecache from an istream, useful for reading a file or receiving from other nodes.
+   * Deserialize tunecache from an istream in the TSV format.
    */
-  static void deserializeTuneCache(std::istream &in)
+  static void deserializeTuneCache(std::istream &in, TuneCache &cache)
   {
     std::string line;
     std::stringstream ls;
@@ -160,20 +172,19 @@ namespace quda
       ls.ignore(1);               // throw away tab before comment
       getline(ls, param.comment); // assume anything remaining on the line is a comment
       param.comment += "\n";      // our convention is to include the newline, since ctime() likes to do this
-      tunecache[key] = param;
+      key.rehash();
+      cache[key] = param;
     }
   }
 
   /**
-   * Serialize tunecache to an ostream, useful for writing to a file or sending to other nodes.
+   * Serialize tunecache to an ostream in the TSV format.
    */
-  static void serializeTuneCache(std::ostream &out)
+  static void serializeTuneCache(std::ostream &out, const TuneCache &cache)
   {
-    map::iterator entry;
-
-    for (entry = tunecache.begin(); entry != tunecache.end(); entry++) {
-      TuneKey key = entry->first;
-      TuneParam param = entry->second;
+    for (auto entry : cache.sorted()) {
+      const TuneKey &key = entry->first;
+      const TuneParam &param = entry->second;
 
       out << std::setw(16) << key.volume << "\t" << key.name << "\t" << key.aux << "\t";
       out << param.block.x << "\t" << param.block.y << "\t" << param.block.z << "\t";
@@ -184,6 +195,362 @@ namespace quda
     }
   }
 
+  /**
+     The version strings that identify the build a tunecache file was
+     written by
+   */
+  struct tunecache_version_t {
+    std::string version;
+    std::string git;
+    std::string hash;
+  };
+
+  static tunecache_version_t current_tunecache_version()
+  {
+#ifdef GITVERSION
+    return {quda_version, gitversion, quda_hash};
+#else
+    return {quda_version, quda_version, quda_hash};
+#endif
+  }
+
+  static bool operator==(const tunecache_version_t &a, const tunecache_version_t &b)
+  {
+    return a.version == b.version && a.git == b.git && a.hash == b.hash;
+  }
+
+  static void checkTuneCacheVersion(const tunecache_version_t &v, const std::string &path)
+  {
+    auto current = current_tunecache_version();
+    if (v.version != current.version || v.git != current.git)
+      errorQuda("Cache file %s does not match current QUDA version. \nPlease delete this file or set the "
+                "QUDA_RESOURCE_PATH environment variable to point to a new path.",
+                path.c_str());
+    if (v.hash != current.hash)
+      errorQuda("Cache file %s does not match current QUDA build. \nPlease delete this file or set the "
+                "QUDA_RESOURCE_PATH environment variable to point to a new path.",
+                path.c_str());
+  }
+
+  /**
+   * Read a tunecache in the TSV format, header included, returning its version.
+   */
+  static tunecache_version_t readTuneCacheTSV(std::istream &in, TuneCache &cache, const std::string &path)
+  {
+    std::string line, token;
+    std::stringstream ls;
+    tunecache_version_t v;
+
+    if (!in.good()) errorQuda("Bad format in %s", path.c_str());
+    getline(in, line);
+    ls.str(line);
+    ls >> token;
+    if (token.compare("tunecache")) errorQuda("Bad format in %s", path.c_str());
+    ls >> v.version >> v.git >> v.hash;
+
+    if (!in.good()) errorQuda("Bad format in %s", path.c_str());
+    getline(in, line); // eat the blank line
+
+    if (!in.good()) errorQuda("Bad format in %s", path.c_str());
+    getline(in, line); // eat the description line
+
+    deserializeTuneCache(in, cache);
+    return v;
+  }
+
+  /**
+   * Write a tunecache in the TSV format, header included.
+   */
+  static void writeTuneCacheTSV(std::ostream &out, const TuneCache &cache, const tunecache_version_t &v)
+  {
+    time_t now;
+    time(&now);
+    out << "tunecache\t" << v.version << "\t" << v.git << "\t" << v.hash << "\t# Last updated " << ctime(&now)
+        << std::endl;
+    out << std::setw(16) << "volume"
+        << "\tname\taux\tblock.x\tblock.y\tblock.z\tgrid.x\tgrid.y\tgrid.z\tshared_bytes\taux.x\taux.y\taux."
+           "z\taux.w\ttime\tcomment"
+        << std::endl;
+    serializeTuneCache(out, cache);
+  }
+
+  /**
+     The binary tunecache format.  A file starts with a header (magic
+     string, format version, byte-order check, followed by the
+     version, git version and build hash strings, each prefixed with
+     its length), and is followed by records that are only ever
+     appended, so that newly tuned kernels can be saved without
+     rewriting the file.  When a key appears more than once the last
+     record wins.  The same records are used to broadcast the cache.
+   */
+  static constexpr char binary_magic[8] = {'Q', 'U', 'D', 'A', 'T', 'U', 'N', 'E'};
+  static constexpr uint32_t binary_format_version = 1;
+  static constexpr uint32_t binary_byte_order = 0x01020304;
+
+  /**
+     The fixed-size part of a binary record, which is followed by the
+     volume, name, aux and comment strings (without terminators) and
+     padding to a multiple of 8 bytes
+   */
+  struct binary_record_t {
+    uint32_t size; // total size of the record in bytes
+    uint32_t volume_len;
+    uint32_t name_len;
+    uint32_t aux_len;
+    uint32_t comment_len;
+    uint32_t block[3];
+    uint32_t grid[3];
+    uint32_t shared_bytes;
+    int32_t aux[4];
+    float time;
+  };
+
+  template <typename T> static void appendBinary(std::string &buf, const T &value)
+  {
+    buf.append(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  static void writeBinaryHeader(std::string &buf, const tunecache_version_t &v)
+  {
+    buf.append(binary_magic, sizeof(binary_magic));
+    appendBinary(buf, binary_format_version);
+    appendBinary(buf, binary_byte_order);
+    for (auto s : {&v.version, &v.git, &v.hash}) {
+      appendBinary(buf, static_cast<uint32_t>(s->size()));
+      buf.append(*s);
+    }
+  }
+
+  static void appendBinaryRecord(std::string &buf, const TuneKey &key, const TuneParam &param)
+  {
+    binary_record_t r = {};
+    r.volume_len = strlen(key.volume);
+    r.name_len = strlen(key.name);
+    r.aux_len = strlen(key.aux);
+    r.comment_len = param.comment.size();
+    const size_t size = sizeof(r) + r.volume_len + r.name_len + r.aux_len + r.comment_len;
+    r.size = ((size + 7) / 8) * 8;
+    r.block[0] = param.block.x;
+    r.block[1] = param.block.y;
+    r.block[2] = param.block.z;
+    r.grid[0] = param.grid.x;
+    r.grid[1] = param.grid.y;
+    r.grid[2] = param.grid.z;
+    r.shared_bytes = param.shared_bytes;
+    r.aux[0] = param.aux.x;
+    r.aux[1] = param.aux.y;
+    r.aux[2] = param.aux.z;
+    r.aux[3] = param.aux.w;
+    r.time = param.time;
+
+    appendBinary(buf, r);
+    buf.append(key.volume, r.volume_len);
+    buf.append(key.name, r.name_len);
+    buf.append(key.aux, r.aux_len);
+    buf.append(param.comment);
+    buf.append(r.size - size, '\0');
+  }
+
+  /**
+     @brief Parse the header of a binary tunecache
+     @param[in] data The file contents
+     @param[in] size The file size
+     @param[out] v The version strings of the file
+     @param[in] path The file path, for error reporting
+     @param[in] strict Whether a truncated header, or one of another
+     format version or byte order, is an error; otherwise it is
+     treated as not being a binary tunecache
+     @return The offset of the first record, or zero if this is not a binary tunecache
+   */
+  static size_t readBinaryHeader(const char *data, size_t size, tunecache_version_t &v, const std::string &path,
+                                 bool strict = true)
+  {
+    size_t offset = 0;
+    bool valid = true;
+    auto read = [&](void *dst, size_t n) {
+      if (offset + n > size) {
+        if (strict) errorQuda("Truncated header in %s", path.c_str());
+        valid = false;
+        return;
+      }
+      memcpy(dst, data + offset, n);
+      offset += n;
+    };
+
+    if (size < sizeof(binary_magic) || memcmp(data, binary_magic, sizeof(binary_magic)) != 0) return 0;
+    offset += sizeof(binary_magic);
+
+    uint32_t format = 0, byte_order = 0;
+    read(&format, sizeof(format));
+    read(&byte_order, sizeof(byte_order));
+    if (!valid) return 0;
+    if (byte_order != binary_byte_order) {
+      if (strict) errorQuda("Cache file %s was written with a different byte order", path.c_str());
+      return 0;
+    }
+    if (format != binary_format_version) {
+      if (strict) errorQuda("Cache file %s has format version %u, expected %u", path.c_str(), format, binary_format_version);
+      return 0;
+    }
+
+    for (auto s : {&v.version, &v.git, &v.hash}) {
+      uint32_t len = 0;
+      read(&len, sizeof(len));
+      if (!valid || offset + len > size) {
+        if (strict) errorQuda("Truncated header in %s", path.c_str());
+        return 0;
+      }
+      s->assign(data + offset, len);
+      offset += len;
+    }
+    return offset;
+  }
+
+  /**
+     @brief Parse binary tunecache records, inserting them into the
+     cache if one is given.  Parsing stops at the first incomplete or
+     malformed record, e.g., left by an interrupted write.
+     @param[in] data The records
+     @param[in] size The size of the records
+     @param[in,out] cache The cache to insert into (may be nullptr to only validate)
+     @return The size of the complete records parsed
+   */
+  static size_t deserializeTuneCacheBinary(const char *data, size_t size, TuneCache *cache)
+  {
+    size_t offset = 0;
+    while (offset + sizeof(binary_record_t) <= size) {
+      binary_record_t r;
+      memcpy(&r, data + offset, sizeof(r));
+      if (r.volume_len >= TuneKey::volume_n || r.name_len >= TuneKey::name_n || r.aux_len >= TuneKey::aux_n) break;
+      if (r.size < sizeof(r) + r.volume_len + r.name_len + r.aux_len + r.comment_len || r.size > size - offset) break;
+
+      if (cache) {
+        const char *str = data + offset + sizeof(r);
+        TuneKey key;
+        memcpy(key.volume, str, r.volume_len);
+        key.volume[r.volume_len] = '\0';
+        str += r.volume_len;
+        memcpy(key.name, str, r.name_len);
+        key.name[r.name_len] = '\0';
+        str += r.name_len;
+        memcpy(key.aux, str, r.aux_len);
+        key.aux[r.aux_len] = '\0';
+        str += r.aux_len;
+        key.rehash();
+
+        TuneParam &param = (*cache)[key];
+        param.block = dim3(r.block[0], r.block[1], r.block[2]);
+        param.grid = dim3(r.grid[0], r.grid[1], r.grid[2]);
+        param.shared_bytes = r.shared_bytes;
+        param.aux = make_int4(r.aux[0], r.aux[1], r.aux[2], r.aux[3]);
+        param.time = r.time;
+        param.comment.assign(str, r.comment_len);
+      }
+      offset += r.size;
+    }
+    return offset;
+  }
+
+  /**
+     A read-only memory mapping of a file
+   */
+  struct mapped_file_t {
+    int fd = -1;
+    const char *data = nullptr;
+    size_t size = 0;
+
+    mapped_file_t(const std::string &path)
+    {
+      fd = open(path.c_str(), O_RDONLY);
+      if (fd == -1) return;
+      struct stat st;
+      if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        void *ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (ptr != MAP_FAILED) {
+          data = static_cast<const char *>(ptr);
+          size = st.st_size;
+        }
+      }
+    }
+
+    mapped_file_t(const mapped_file_t &) = delete;
+    mapped_file_t &operator=(const mapped_file_t &) = delete;
+
+    ~mapped_file_t()
+    {
+      if (data) munmap(const_cast<char *>(data), size);
+      if (fd != -1) close(fd);
+    }
+
+    bool exists() const { return fd != -1; }
+  };
+
+  /**
+     @brief Load a binary tunecache file into the cache
+     @return The number of bytes of valid records in the file
+   */
+  static size_t loadTuneCacheBinary(const mapped_file_t &file, TuneCache &cache, tunecache_version_t &v,
+                                    const std::string &path)
+  {
+    size_t offset = readBinaryHeader(file.data, file.size, v, path);
+    if (!offset) errorQuda("Bad format in %s", path.c_str());
+    size_t valid = offset + deserializeTuneCacheBinary(file.data + offset, file.size - offset, &cache);
+    if (valid < file.size)
+      warningQuda("Ignoring %lu bytes of incomplete records at the end of %s", file.size - valid, path.c_str());
+    return valid;
+  }
+
+  /**
+     @brief Save the tunecache entries that have changed since they
+     were last saved (newly tuned or re-tuned) by appending them to
+     the binary tunecache file, where the later record of a re-tuned
+     key supersedes the earlier one.  An incomplete record at the end
+     of the file is dropped first, and a file written by a different
+     build, format version or byte order is truncated and rewritten
+     in full with a new header.
+     @param[in] path The path of the binary tunecache
+     @return The number of entries written
+   */
+  static size_t saveTuneCacheBinary(const std::string &path)
+  {
+    const auto current = current_tunecache_version();
+    size_t valid = 0; // size of the existing contents that we keep
+
+    {
+      mapped_file_t file(path);
+      tunecache_version_t v;
+      size_t offset = file.data ? readBinaryHeader(file.data, file.size, v, path, false) : 0;
+      if (offset && v == current)
+        valid = offset + deserializeTuneCacheBinary(file.data + offset, file.size - offset, nullptr);
+    }
+
+    std::string buf;
+    size_t n = 0;
+    if (valid == 0) writeBinaryHeader(buf, current);
+    for (size_t i = 0; i < tunecache.size(); i++) {
+      if (valid > 0 && !tunecache.dirty(i)) continue;
+      const auto &entry = *(tunecache.begin() + i);
+      appendBinaryRecord(buf, entry.first, entry.second);
+      n++;
+    }
+
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT, 0666);
+    if (fd == -1) {
+      warningQuda("Unable to open %s.  Tuned launch parameters will not be cached to disk.", path.c_str());
+      return 0;
+    }
+    bool ok = ftruncate(fd, valid) == 0 && lseek(fd, valid, SEEK_SET) != -1;
+    for (size_t done = 0; ok && done < buf.size();) {
+      auto n = write(fd, buf.data() + done, buf.size() - done);
+      if (n <= 0) ok = false;
+      done += n;
+    }
+    close(fd);
+    if (!ok) warningQuda("Failed to write %s", path.c_str());
+
+    return n;
+  }
+
   template <class T> struct less_significant {
     inline bool operator()(const T &lhs, const T &rhs)
     {
@@ -196,7 +563,6 @@ namespace quda
    */
   static void serializeProfile(std::ostream &out, std::ostream &async_out)
   {
-    map::iterator entry;
     double total_time = 0.0;
     double async_total_time = 0.0;
 
@@ -206,9 +572,9 @@ namespace quda
     queue_t q(tunecache.begin(), tunecache.end());
 
     // now compute total time spent in kernels so we can give each kernel a significance
-    for (entry = tunecache.begin(); entry != tunecache.end(); entry++) {
-      TuneKey key = entry->first;
-      TuneParam param = entry->second;
+    for (auto entry = tunecache.begin(); entry != tunecache.end(); entry++) {
+      const TuneKey &key = entry->first;
+      const TuneParam &param = entry->second;
 
       char tmp[TuneKey::aux_n] = {};
       strncpy(tmp, key.aux, TuneKey::aux_n);
@@ -295,35 +661,213 @@ namespace quda
     }
   }
 
+  bool launchStatsEnabled()
+  {
+    static bool init = false;
+    static bool enable = false;
+
+    if (!init) {
+      char *enable_stats_env = getenv("QUDA_ENABLE_LAUNCH_STATS");
+      if (enable_stats_env && strcmp(enable_stats_env, "1") == 0) enable = true;
+      init = true;
+    }
+    return enable;
+  }
+
+  /**
+     The measured durations of the launches of a kernel.  Besides the
+     running moments, the durations are binned into a histogram with
+     logarithmically spaced bins, from which the percentiles are
+     estimated, so the memory footprint is independent of the number
+     of launches.
+   */
+  struct LaunchStats {
+    static constexpr int bins_per_octave = 8;
+    static constexpr double min_time = 1e-7; /** lower edge of the histogram in seconds */
+    static constexpr int n_bin = 30 * bins_per_octave; /** upper edge is min_time * 2^30 ~ 100 s */
+
+    uint64_t count = 0;
+    double mean = 0.0; /** running mean of the duration */
+    double m2 = 0.0;   /** running sum of squared deviations from the mean */
+    double max = 0.0;
+    double flops = 0.0; /** accumulated flops of the measured launches */
+    double bytes = 0.0; /** accumulated bytes of the measured launches */
+    std::array<uint64_t, n_bin> histogram = {};
+
+    static int bin(double time)
+    {
+      if (time <= min_time) return 0;
+      return std::min(static_cast<int>(bins_per_octave * std::log2(time / min_time)), n_bin - 1);
+    }
+
+    void add(double time, long long launch_flops, long long launch_bytes)
+    {
+      // Welford's update, which is stable for long runs
+      count++;
+      double delta = time - mean;
+      mean += delta / count;
+      m2 += delta * (time - mean);
+      max = std::max(max, time);
+      flops += launch_flops;
+      bytes += launch_bytes;
+      histogram[bin(time)]++;
+    }
+
+    double stddev() const { return count > 1 ? std::sqrt(m2 / (count - 1)) : 0.0; }
+
+    /**
+       @brief Estimate a percentile of the durations from the
+       histogram, as the geometric center of the bin it falls in
+       @param[in] p The percentile in the range [0,1]
+     */
+    double percentile(double p) const
+    {
+      uint64_t rank = std::max<uint64_t>(1, std::ceil(p * count));
+      uint64_t sum = 0;
+      for (int i = 0; i < n_bin; i++) {
+        sum += histogram[i];
+        if (sum >= rank) return std::min(min_time * std::exp2((i + 0.5) / bins_per_octave), max);
+      }
+      return max;
+    }
+  };
+
+  static std::map<TuneKey, LaunchStats> launch_stats;
+
+  /**
+     A launch being timed.  Launches are asynchronous, so the events
+     are queued and only read once the stop event has completed,
+     which avoids synchronizing the stream after each launch.
+   */
+  struct pending_launch_t {
+    qudaEvent_t start;
+    qudaEvent_t stop;
+    LaunchStats *stats;
+    long long flops;
+    long long bytes;
+  };
+
+  static std::deque<pending_launch_t> pending_launches;
+  static std::vector<qudaEvent_t> launch_event_pool;
+  static pending_launch_t *active_launch = nullptr;
+
+  /** the maximum number of queued launches before we block for the oldest to complete */
+  static constexpr size_t max_pending_launches = 1024;
+
+  static qudaEvent_t getLaunchEvent()
+  {
+    if (launch_event_pool.empty()) return qudaChronoEventCreate();
+    auto event = launch_event_pool.back();
+    launch_event_pool.pop_back();
+    return event;
+  }
+
+  /**
+     @brief Accumulate the completed launches at the head of the
+     queue into their statistics
+     @param[in] block Whether to wait for all queued launches to complete
+   */
+  static void retireLaunches(bool block)
+  {
+    while (!pending_launches.empty()) {
+      auto &launch = pending_launches.front();
+      if (block)
+        qudaEventSynchronize(launch.stop);
+      else if (!qudaEventQuery(launch.stop))
+        break;
+      launch.stats->add(qudaEventElapsedTime(launch.start, launch.stop), launch.flops, launch.bytes);
+      launch_event_pool.push_back(launch.start);
+      launch_event_pool.push_back(launch.stop);
+      pending_launches.pop_front();
+    }
+  }
+
+  void recordLaunchStart(LaunchStats &stats, const qudaStream_t &stream, long long flops, long long bytes)
+  {
+    pending_launches.push_back({getLaunchEvent(), getLaunchEvent(), &stats, flops, bytes});
+    active_launch = &pending_launches.back();
+    qudaEventRecord(active_launch->start, stream);
+  }
+
+  void recordLaunchStop(const qudaStream_t &stream)
+  {
+    if (!active_launch) errorQuda("recordLaunchStop called without a matching recordLaunchStart");
+    qudaEventRecord(active_launch->stop, stream);
+    active_launch = nullptr;
+    retireLaunches(pending_launches.size() > max_pending_launches);
+  }
+
+  /**
+   * Serialize the launch statistics to an ostream, sorted by the total
+   * measured time of each kernel.
+   */
+  static void serializeLaunchStats(std::ostream &out)
+  {
+    retireLaunches(true);
+
+    std::vector<std::pair<const TuneKey *, const LaunchStats *>> entries;
+    double total_time = 0.0;
+    for (auto &entry : launch_stats) {
+      if (entry.second.count == 0) continue; // e.g., host launches, which are not measured
+      entries.push_back({&entry.first, &entry.second});
+      total_time += entry.second.count * entry.second.mean;
+    }
+    std::stable_sort(entries.begin(), entries.end(), [](const auto &a, const auto &b) {
+      return a.second->count * a.second->mean > b.second->count * b.second->mean;
+    });
+
+    for (auto &entry : entries) {
+      const TuneKey &key = *entry.first;
+      const LaunchStats &stats = *entry.second;
+      const double time = stats.count * stats.mean;
+      const TuneParam *param = tunecache.find(key);
+
+      out << std::setw(12) << time << "\t";
+      out << std::setw(12) << stats.count << "\t";
+      out << std::setw(12) << 1e6 * stats.mean << "\t";
+      out << std::setw(12) << 1e6 * stats.stddev() << "\t";
+      out << std::setw(12) << 1e6 * stats.percentile(0.5) << "\t";
+      out << std::setw(12) << 1e6 * stats.percentile(0.99) << "\t";
+      out << std::setw(12) << 1e6 * stats.max << "\t";
+      out << std::setw(12) << (param ? 1e6 * param->time : 0.0) << "\t";
+      out << std::setw(12) << (time > 0.0 ? 1e-9 * stats.flops / time : 0.0) << "\t";
+      out << std::setw(12) << (time > 0.0 ? 1e-9 * stats.bytes / time : 0.0) << "\t";
+      out << std::setw(16) << key.volume << "\t" << key.name << "\t" << key.aux << std::endl;
+    }
+
+    out << std::endl << "# Total measured time spent in kernels = " << total_time << " seconds" << std::endl;
+  }
+
   /**
-   * Distribute the tunecache from node 0 to all other nodes.
+   * Distribute the tunecache from node 0 to all other nodes.  The
+   * cache is shipped as binary records, which are cheap to parse.
    */
   static void broadcastTuneCache()
   {
-    std::stringstream serialized;
+    std::string serialized;
     size_t size;
 
     if (comm_rank_global() == 0) {
-      serializeTuneCache(serialized);
-      size = serialized.str().length();
+      for (auto &entry : tunecache) appendBinaryRecord(serialized, entry.first, entry.second);
+      size = serialized.size();
     }
     comm_broadcast_global(&size, sizeof(size_t));
 
     if (size > 0) {
       if (comm_rank_global() == 0) {
-        comm_broadcast_global(const_cast<char *>(serialized.str().c_str()), size);
+        comm_broadcast_global(const_cast<char *>(serialized.data()), size);
       } else {
-        std::vector<char> serstr(size + 1);
+        std::vector<char> serstr(size);
         comm_broadcast_global(serstr.data(), size);
-        serstr[size] = '\0'; // null-terminate
-        serialized.str(serstr.data());
-        deserializeTuneCache(serialized);
+        deserializeTuneCacheBinary(serstr.data(), size, &tunecache);
       }
     }
   }
 
   /*
-   * Read tunecache from disk.
+   * Read tunecache from disk.  The binary tunecache.bin is memory
+   * mapped if present, otherwise a legacy tunecache.tsv is imported
+   * (and will be written in binary form at the next save).
    */
   void loadTuneCache()
   {
@@ -334,9 +878,6 @@ namespace quda
 
     char *path;
     struct stat pstat;
-    std::string cache_path, line, token;
-    std::ifstream cache_file;
-    std::stringstream ls;
 
     path = getenv("QUDA_RESOURCE_PATH");
 
@@ -360,73 +901,46 @@ namespace quda
     }
 
     if (comm_rank_global() == 0) {
-      cache_path = resource_path;
-      cache_path += "/tunecache.tsv";
-      cache_file.open(cache_path.c_str());
-
-      if (cache_file) {
-
-        if (!cache_file.good()) errorQuda("Bad format in %s", cache_path.c_str());
-        getline(cache_file, line);
-        ls.str(line);
-        ls >> token;
-        if (token.compare("tunecache")) errorQuda("Bad format in %s", cache_path.c_str());
-        ls >> token;
-        if (version_check && token.compare(quda_version))
-          errorQuda("Cache file %s does not match current QUDA version. \nPlease delete this file or set the "
-                    "QUDA_RESOURCE_PATH environment variable to point to a new path.",
-                    cache_path.c_str());
-        ls >> token;
-#ifdef GITVERSION
-        if (version_check && token.compare(gitversion))
-          errorQuda("Cache file %s does not match current QUDA version. \nPlease delete this file or set the "
-                    "QUDA_RESOURCE_PATH environment variable to point to a new path.",
-                    cache_path.c_str());
-#else
-      if (version_check && token.compare(quda_version))
-        errorQuda("Cache file %s does not match current QUDA version. \nPlease delete this file or set the "
-                  "QUDA_RESOURCE_PATH environment variable to point to a new path.",
-                  cache_path.c_str());
-#endif
-        ls >> token;
-        if (version_check && token.compare(quda_hash))
-          errorQuda("Cache file %s does not match current QUDA build. \nPlease delete this file or set the "
-                    "QUDA_RESOURCE_PATH environment variable to point to a new path.",
-                    cache_path.c_str());
-
-        if (!cache_file.good()) errorQuda("Bad format in %s", cache_path.c_str());
-        getline(cache_file, line); // eat the blank line
-
-        if (!cache_file.good()) errorQuda("Bad format in %s", cache_path.c_str());
-        getline(cache_file, line); // eat the description line
-
-        deserializeTuneCache(cache_file);
-
-        cache_file.close();
-        initial_cache_size = tunecache.size();
-
-        if (getVerbosity() >= QUDA_SUMMARIZE) {
-          printfQuda("Loaded %d sets of cached parameters from %s\n", static_cast<int>(initial_cache_size),
-                     cache_path.c_str());
-        }
-
+      std::string cache_path = resource_path + "/tunecache.bin";
+      std::string tsv_path = resource_path + "/tunecache.tsv";
+      mapped_file_t cache_file(cache_path);
+      std::ifstream tsv_file;
+      if (!cache_file.exists()) tsv_file.open(tsv_path.c_str());
+
+      if (cache_file.exists()) {
+        tunecache_version_t v;
+        size_t offset = readBinaryHeader(cache_file.data, cache_file.size, v, cache_path);
+        if (!offset) errorQuda("Bad format in %s", cache_path.c_str());
+        if (version_check) checkTuneCacheVersion(v, cache_path);
+        loadTuneCacheBinary(cache_file, tunecache, v, cache_path);
+        tunecache.clear_dirty();
+      } else if (tsv_file) {
+        auto v = readTuneCacheTSV(tsv_file, tunecache, tsv_path);
+        if (version_check) checkTuneCacheVersion(v, tsv_path);
+        cache_path = tsv_path; // the entries remain dirty since they are not yet in the binary cache
       } else {
         warningQuda("Cache file not found.  All kernels will be re-tuned (if tuning is enabled).");
       }
+
+      if (!tunecache.empty() && getVerbosity() >= QUDA_SUMMARIZE) {
+        printfQuda("Loaded %d sets of cached parameters from %s\n", static_cast<int>(tunecache.size()),
+                   cache_path.c_str());
+      }
     }
 
     broadcastTuneCache();
   }
 
   /**
-   * Write tunecache to disk.
+   * Write tunecache to disk.  Only the entries (re-)tuned since the last
+   * load or save are appended to tunecache.bin.  If the environment
+   * variable QUDA_TUNECACHE_TSV is set to 1, the full cache is
+   * additionally exported to tunecache.tsv.
    */
   void saveTuneCache(bool error)
   {
-    time_t now;
     int lock_handle;
     std::string lock_path, cache_path;
-    std::ofstream cache_file;
 
     if (resource_path.empty()) return;
 
@@ -436,7 +950,7 @@ namespace quda
 
     if (comm_rank_global() == 0) {
 
-      if (tunecache.size() == initial_cache_size && !error) return;
+      if (tunecache.num_dirty() == 0 && !error) return;
 
       // Acquire lock.  Note that this is only robust if the filesystem supports flock() semantics, which is true for
       // NFS on recent versions of linux but not Lustre by default (unless the filesystem was mounted with "-o flock").
@@ -454,34 +968,34 @@ namespace quda
       int stat = write(lock_handle, msg, sizeof(msg)); // check status to avoid compiler warning
       if (stat == -1) warningQuda("Unable to write to lock file for some bizarre reason");
 
-      cache_path = resource_path + (error ? "/tunecache_error.tsv" : "/tunecache.tsv");
-      cache_file.open(cache_path.c_str());
+      static const bool export_tsv = getenv("QUDA_TUNECACHE_TSV") && strcmp(getenv("QUDA_TUNECACHE_TSV"), "1") == 0;
 
-      if (getVerbosity() >= QUDA_SUMMARIZE) {
-        printfQuda("Saving %d sets of cached parameters to %s\n", static_cast<int>(tunecache.size()), cache_path.c_str());
+      if (error) {
+        // the error cache is a one-off diagnostic, so we write it in full as text
+        cache_path = resource_path + "/tunecache_error.tsv";
+        if (getVerbosity() >= QUDA_SUMMARIZE)
+          printfQuda("Saving %d sets of cached parameters to %s\n", static_cast<int>(tunecache.size()),
+                     cache_path.c_str());
+        std::ofstream cache_file(cache_path.c_str());
+        writeTuneCacheTSV(cache_file, tunecache, current_tunecache_version());
+      } else {
+        cache_path = resource_path + "/tunecache.bin";
+        size_t n = saveTuneCacheBinary(cache_path);
+        if (getVerbosity() >= QUDA_SUMMARIZE)
+          printfQuda("Saved %lu new sets of cached parameters to %s (%lu total)\n", n, cache_path.c_str(),
+                     tunecache.size());
+
+        if (export_tsv) {
+          std::ofstream cache_file((resource_path + "/tunecache.tsv").c_str());
+          writeTuneCacheTSV(cache_file, tunecache, current_tunecache_version());
+        }
+        tunecache.clear_dirty();
       }
 
-      time(&now);
-      cache_file << "tunecache\t" << quda_version;
-#ifdef GITVERSION
-      cache_file << "\t" << gitversion;
-#else
-    cache_file << "\t" << quda_version;
-#endif
-      cache_file << "\t" << quda_hash << "\t# Last updated " << ctime(&now) << std::endl;
-      cache_file << std::setw(16) << "volume"
-                 << "\tname\taux\tblock.x\tblock.y\tblock.z\tgrid.x\tgrid.y\tgrid.z\tshared_bytes\taux.x\taux.y\taux."
-                    "z\taux.w\ttime\tcomment"
-                 << std::endl;
-      serializeTuneCache(cache_file);
-      cache_file.close();
-
       // Release lock.
       close(lock_handle);
       remove(lock_path.c_str());
 
-      initial_cache_size = tunecache.size();
-
     } else {
       // give process 0 time to write out its tunecache if needed, but
       // doesn't cause a hang if error is not triggered on process 0
@@ -489,6 +1003,34 @@ namespace quda
     }
   }
 
+  void convertTuneCache(const std::string &in_path, const std::string &out_path)
+  {
+    TuneCache cache;
+    tunecache_version_t v;
+    mapped_file_t in_file(in_path);
+    if (!in_file.exists()) errorQuda("Unable to open %s", in_path.c_str());
+
+    bool binary = in_file.data && readBinaryHeader(in_file.data, in_file.size, v, in_path);
+    if (binary) {
+      loadTuneCacheBinary(in_file, cache, v, in_path);
+      std::ofstream out(out_path.c_str());
+      if (!out) errorQuda("Unable to open %s", out_path.c_str());
+      writeTuneCacheTSV(out, cache, v);
+    } else {
+      std::ifstream in(in_path.c_str());
+      v = readTuneCacheTSV(in, cache, in_path);
+      std::string buf;
+      writeBinaryHeader(buf, v);
+      for (auto &entry : cache) appendBinaryRecord(buf, entry.first, entry.second);
+      std::ofstream out(out_path.c_str(), std::ios::binary);
+      if (!out) errorQuda("Unable to open %s", out_path.c_str());
+      out.write(buf.data(), buf.size());
+    }
+
+    printfQuda("Converted %lu sets of cached parameters from %s (%s) to %s (%s)\n", cache.size(), in_path.c_str(),
+               binary ? "binary" : "tsv", out_path.c_str(), binary ? "tsv" : "binary");
+  }
+
   static bool policy_tuning = false;
   bool policyTuning() { return policy_tuning; }
 
@@ -502,7 +1044,7 @@ namespace quda
   // flush profile, setting counts to zero
   void flushProfile()
   {
-    for (map::iterator entry = tunecache.begin(); entry != tunecache.end(); entry++) {
+    for (auto entry = tunecache.begin(); entry != tunecache.end(); entry++) {
       // set all n_calls = 0
       TuneParam &param = entry->second;
       param.n_calls = 0;
@@ -514,11 +1056,21 @@ namespace quda
   {
     time_t now;
     int lock_handle;
-    std::string lock_path, profile_path, async_profile_path, trace_path;
-    std::ofstream profile_file, async_profile_file, trace_file;
+    std::string lock_path, profile_path, async_profile_path, trace_path, stats_path;
+    std::ofstream profile_file, async_profile_file, trace_file, stats_file;
 
     if (resource_path.empty()) return;
 
+    // every rank writes its own timeline and allocation trace, which hold all events recorded so far
+    if (timeline::enabled() || alloc_trace::enabled()) {
+      char *profile_fname = getenv("QUDA_PROFILE_OUTPUT_BASE");
+      const std::string prefix
+        = resource_path + "/" + (profile_fname ? std::string(profile_fname) + "_" : std::string());
+      if (timeline::enabled())
+        timeline::save(prefix + "timeline_" + std::to_string(comm_rank_global()) + ".json", comm_rank_global());
+      alloc_trace::save(prefix, comm_rank_global());
+    }
+
     if (comm_rank_global() == 0) { // Make sure only one rank is writing to disk
 
       // Acquire lock.  Note that this is only robust if the filesystem supports flock() semantics, which is true for
@@ -548,11 +1100,14 @@ namespace quda
         profile_path = resource_path + "/profile_" + std::to_string(count) + ".tsv";
         async_profile_path = resource_path + "/profile_async_" + std::to_string(count) + ".tsv";
         if (traceEnabled()) trace_path = resource_path + "/trace_" + std::to_string(count) + ".tsv";
+        if (launchStatsEnabled()) stats_path = resource_path + "/profile_stats_" + std::to_string(count) + ".tsv";
       } else {
         profile_path = resource_path + "/" + profile_fname + "_" + std::to_string(count) + ".tsv";
         async_profile_path = resource_path + "/" + profile_fname + "_" + std::to_string(count) + "_async.tsv";
         if (traceEnabled())
           trace_path = resource_path + "/" + profile_fname + "_trace_" + std::to_string(count) + ".tsv";
+        if (launchStatsEnabled())
+          stats_path = resource_path + "/" + profile_fname + "_" + std::to_string(count) + "_stats.tsv";
       }
 
       count++;
@@ -560,12 +1115,13 @@ namespace quda
       profile_file.open(profile_path.c_str());
       async_profile_file.open(async_profile_path.c_str());
       if (traceEnabled()) trace_file.open(trace_path.c_str());
+      if (launchStatsEnabled()) stats_file.open(stats_path.c_str());
 
       if (getVerbosity() >= QUDA_SUMMARIZE) {
         // compute number of non-zero entries that will be output in the profile
         int n_entry = 0;
         int n_policy = 0;
-        for (map::iterator entry = tunecache.begin(); entry != tunecache.end(); entry++) {
+        for (auto entry = tunecache.begin(); entry != tunecache.end(); entry++) {
           // if a policy entry, then we can ignore
           char tmp[TuneKey::aux_n] = {};
           strncpy(tmp, entry->first.aux, TuneKey::aux_n);
@@ -579,6 +1135,8 @@ namespace quda
         printfQuda("Saving %d sets of cached profiles to %s\n", n_policy, async_profile_path.c_str());
         if (traceEnabled())
           printfQuda("Saving trace list with %lu entries to %s\n", trace_list.size(), trace_path.c_str());
+        if (launchStatsEnabled())
+          printfQuda("Saving launch statistics of %lu kernels to %s\n", launch_stats.size(), stats_path.c_str());
       }
 
       time(&now);
@@ -640,6 +1198,33 @@ namespace quda
         trace_file.close();
       }
 
+      if (launchStatsEnabled()) {
+        stats_file << "stats"
+                   << "\t" << quda_version;
+#ifdef GITVERSION
+        stats_file << "\t" << gitversion;
+#else
+        stats_file << "\t" << quda_version;
+#endif
+        stats_file << "\t" << quda_hash << "\t# Last updated " << ctime(&now) << std::endl;
+        stats_file << std::setw(12) << "total time"
+                   << "\t" << std::setw(12) << "calls"
+                   << "\t" << std::setw(12) << "mean (us)"
+                   << "\t" << std::setw(12) << "stddev (us)"
+                   << "\t" << std::setw(12) << "p50 (us)"
+                   << "\t" << std::setw(12) << "p99 (us)"
+                   << "\t" << std::setw(12) << "max (us)"
+                   << "\t" << std::setw(12) << "tuned (us)"
+                   << "\t" << std::setw(12) << "GFLOP/s"
+                   << "\t" << std::setw(12) << "GB/s"
+                   << "\t" << std::setw(16) << "volume"
+                   << "\tname\taux" << std::endl;
+
+        serializeLaunchStats(stats_file);
+
+        stats_file.close();
+      }
+
       // Release lock.
       close(lock_handle);
       remove(lock_path.c_str());
@@ -665,6 +1250,23 @@ namespace quda
   static TimeProfile launchTimer("tuneLaunch");
 #endif
 
+  /**
+   * @brief Timer used when tuning.  Host launches are synchronous and
+   * so are timed on the host, while device launches are timed with
+   * events on the stream.
+   */
+  struct tune_timer_t {
+    const bool host;
+    device_timer_t device_timer;
+    host_timer_t host_timer;
+
+    tune_timer_t(bool host, const qudaStream_t &stream) : host(host), device_timer(stream) { }
+
+    void start() { host ? host_timer.start() : device_timer.start(); }
+    void stop() { host ? host_timer.stop() : device_timer.stop(); }
+    double last() { return host ? host_timer.last() : device_timer.last(); }
+  };
+
   /**
    * @brief Compare two TuneParams with respect to which has the lower time.
    *
@@ -681,6 +1283,123 @@ namespace quda
   NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(TuneParam, block, grid, shared_bytes, set_max_shared_bytes, aux, comment, time,
                                      n_calls)
 
+  /**
+     @brief Whether the tuning of new kernels is distributed across
+     all ranks, which is enabled by setting the environment variable
+     QUDA_TUNE_DISTRIBUTED=1.  Each rank then times a disjoint subset
+     of the candidate launch parameters (with coordinate descent, of
+     the candidates of each step, so that all ranks walk the same
+     path), and the fastest is agreed on with a global min-allreduce,
+     rather than rank 0 timing all of them while the other ranks
+     wait.  This assumes the ranks run on identical devices, since
+     timings from different ranks are compared.
+   */
+  static bool distributedTuning()
+  {
+    static bool init = false;
+    static bool distributed = false;
+
+    if (!init) {
+      char *distributed_env = getenv("QUDA_TUNE_DISTRIBUTED");
+      if (distributed_env && strcmp(distributed_env, "1") == 0) distributed = true;
+      init = true;
+    }
+    return distributed && comm_size_global() > 1;
+  }
+
+  /** The number of doubles a TuneParam is packed into for a reduction */
+  static constexpr int packed_param_size = 13;
+
+  /**
+     @brief Pack the launch parameters and time of a TuneParam for a reduction
+     @param[out] p The packed parameters
+     @param[in] param The parameters to pack
+   */
+  static void packParam(double *p, const TuneParam &param)
+  {
+    const double packed[packed_param_size]
+      = {static_cast<double>(param.block.x),      static_cast<double>(param.block.y),
+         static_cast<double>(param.block.z),      static_cast<double>(param.grid.x),
+         static_cast<double>(param.grid.y),       static_cast<double>(param.grid.z),
+         static_cast<double>(param.shared_bytes), static_cast<double>(param.set_max_shared_bytes),
+         static_cast<double>(param.aux.x),        static_cast<double>(param.aux.y),
+         static_cast<double>(param.aux.z),        static_cast<double>(param.aux.w),
+         static_cast<double>(param.time)};
+    std::copy(packed, packed + packed_param_size, p);
+  }
+
+  /**
+     @brief Unpack the launch parameters and time packed with packParam
+     @param[out] param The unpacked parameters
+     @param[in] p The packed parameters
+   */
+  static void unpackParam(TuneParam &param, const double *p)
+  {
+    param.block = dim3(p[0], p[1], p[2]);
+    param.grid = dim3(p[3], p[4], p[5]);
+    param.shared_bytes = p[6];
+    param.set_max_shared_bytes = p[7];
+    param.aux = make_int4(p[8], p[9], p[10], p[11]);
+    param.time = p[12];
+  }
+
+  /**
+     @brief Agree on the fastest launch parameters found by any rank
+     with distributed tuning.  The fastest rank (lowest on a tie) is
+     found with min-allreduces, and its parameters are then also
+     distributed with a min-allreduce, to which the other ranks
+     contribute values that cannot be the minimum.
+     @param[in,out] param The fastest local parameters, replaced by the global ones
+     @param[in,out] time The time of the local parameters, replaced by the global one
+   */
+  static void reduceBestParam(TuneParam &param, float &time)
+  {
+    double best_time = time;
+    comm_allreduce_min_array_global(&best_time, 1);
+
+    double winner = time == best_time ? comm_rank_global() : DBL_MAX;
+    comm_allreduce_min_array_global(&winner, 1);
+
+    double p[packed_param_size];
+    packParam(p, param);
+    if (winner != comm_rank_global())
+      for (auto &p_i : p) p_i = DBL_MAX;
+    comm_allreduce_min_array_global(p, packed_param_size);
+
+    unpackParam(param, p);
+    time = best_time;
+  }
+
+  /**
+     @brief Gather the tuning candidates of all ranks with distributed
+     tuning.  Each rank contributes its candidates to its own slots of
+     a min-allreduce, with the other slots left at values that cannot
+     be the minimum.
+     @param[in] local The timed candidates of this rank
+     @param[in] max_size The maximum number of candidates of any rank, which is also the number kept
+     @return The fastest candidates over all ranks, fastest first, identical on all ranks
+   */
+  static std::vector<TuneParam> gatherCandidates(const std::vector<TuneParam> &local, size_t max_size)
+  {
+    const size_t slots = comm_size_global() * max_size;
+    std::vector<double> p(slots * packed_param_size, DBL_MAX);
+    double *p_local = p.data() + comm_rank_global() * max_size * packed_param_size;
+    for (size_t i = 0; i < std::min(local.size(), max_size); i++) packParam(p_local + i * packed_param_size, local[i]);
+    comm_allreduce_min_array_global(p.data(), p.size());
+
+    std::vector<TuneParam> all;
+    for (size_t i = 0; i < slots; i++) {
+      const double *p_i = p.data() + i * packed_param_size;
+      if (p_i[packed_param_size - 1] == DBL_MAX) continue; // an empty slot
+      TuneParam param;
+      unpackParam(param, p_i);
+      all.push_back(param);
+    }
+    std::stable_sort(all.begin(), all.end(), TuneParamComp());
+    if (all.size() > max_size) all.resize(max_size);
+    return all;
+  }
+
   class TuneCandidates : public std::priority_queue<TuneParam, std::vector<TuneParam>, TuneParamComp>
   {
   private:
@@ -766,6 +1485,17 @@ namespace quda
       }
     }
 
+    /**
+     * @brief Reduce the best time found in tuning over all ranks, for distributed tuning.
+     *
+     */
+    void reduceBestTime()
+    {
+      double time = besttime;
+      comm_allreduce_min_array_global(&time, 1);
+      besttime = time;
+    }
+
     /**
      * @brief Return the best time found in tuning.
      *
@@ -774,6 +1504,252 @@ namespace quda
     float getBestTime() const { return besttime; }
   };
 
+  TuneSearch getTuneSearch()
+  {
+    static bool init = false;
+    static TuneSearch search = TuneSearch::EXHAUSTIVE;
+
+    if (!init) {
+      char *search_env = getenv("QUDA_TUNE_SEARCH");
+      if (search_env) {
+        if (strcmp(search_env, "exhaustive") == 0) {
+          search = TuneSearch::EXHAUSTIVE;
+        } else if (strcmp(search_env, "descent") == 0) {
+          search = TuneSearch::DESCENT;
+        } else if (strcmp(search_env, "halving") == 0) {
+          search = TuneSearch::HALVING;
+        } else {
+          errorQuda("QUDA_TUNE_SEARCH=%s not recognized (exhaustive, descent or halving)", search_env);
+        }
+      }
+      init = true;
+    }
+    return search;
+  }
+
+  double getTuneBudget()
+  {
+    static bool init = false;
+    static double budget = 0.0;
+
+    if (!init) {
+      char *budget_env = getenv("QUDA_TUNE_BUDGET");
+      if (budget_env) budget = std::max(atof(budget_env), 0.0);
+      init = true;
+    }
+    return budget;
+  }
+
+  /**
+     @brief Return the volume of a TuneKey volume string, which is the
+     product of its extents, e.g., 16x16x16x32
+   */
+  static double keyVolume(const char *volume)
+  {
+    double v = 1.0;
+    for (const char *s = volume; *s;) {
+      char *end;
+      auto extent = strtoull(s, &end, 10);
+      if (end == s) {
+        s++;
+      } else {
+        v *= extent;
+        s = end;
+      }
+    }
+    return std::max(v, 1.0);
+  }
+
+  /**
+     @brief Find the tuned parameters of the same kernel (name and
+     aux string) at the nearest other volume, which are used to warm
+     start the search
+     @param[in] key The key of the kernel being tuned
+     @param[out] nearest_key Optional, the key of the nearest volume
+     @return The parameters at the nearest volume, or nullptr if the kernel has not been tuned at any
+   */
+  static const TuneParam *nearestVolumeParam(const TuneKey &key, const TuneKey **nearest_key = nullptr)
+  {
+    const TuneParam *nearest = nullptr;
+    const double volume = keyVolume(key.volume);
+    double distance = DBL_MAX;
+    for (auto &entry : tunecache) {
+      if (strcmp(entry.first.name, key.name) || strcmp(entry.first.aux, key.aux)) continue;
+      const double d = std::abs(std::log(keyVolume(entry.first.volume) / volume));
+      if (d < distance) {
+        distance = d;
+        nearest = &entry.second;
+        if (nearest_key) *nearest_key = &entry.first;
+      }
+    }
+    return nearest;
+  }
+
+  /**
+     @brief Return the launch parameters as coordinates of the search
+     space: block (0-2), grid (3-5), shared bytes (6) and aux (7-10)
+   */
+  static std::array<double, 11> tuneCoords(const TuneParam &param)
+  {
+    return {static_cast<double>(param.block.x), static_cast<double>(param.block.y),
+            static_cast<double>(param.block.z), static_cast<double>(param.grid.x),
+            static_cast<double>(param.grid.y),  static_cast<double>(param.grid.z),
+            static_cast<double>(param.shared_bytes), static_cast<double>(param.aux.x),
+            static_cast<double>(param.aux.y),   static_cast<double>(param.aux.z),
+            static_cast<double>(param.aux.w)};
+  }
+
+  /**
+     The groups of coordinates along which the coordinate descent
+     moves: the block size (with the shared bytes, which are derived
+     from it), the grid size, the shared bytes alone and the aux
+     parameters
+   */
+  static const std::vector<std::vector<int>> tune_coord_groups = {{0, 1, 2, 6}, {3, 4, 5}, {6}, {7, 8, 9, 10}};
+
+  /**
+     @brief Whether two launch parameters only differ in the given group of coordinates
+   */
+  static bool sameOutsideGroup(const TuneParam &a, const TuneParam &b, const std::vector<int> &group)
+  {
+    auto a_coords = tuneCoords(a);
+    auto b_coords = tuneCoords(b);
+    for (int i : group) a_coords[i] = b_coords[i];
+    return a_coords == b_coords;
+  }
+
+  /**
+     @brief Return the index of the candidate that is closest to the
+     given parameters, where each coordinate contributes its relative
+     difference
+   */
+  static size_t closestCandidate(const std::vector<TuneParam> &candidates, const TuneParam &param)
+  {
+    const auto target = tuneCoords(param);
+    size_t closest = 0;
+    double distance = DBL_MAX;
+    for (size_t i = 0; i < candidates.size(); i++) {
+      const auto coords = tuneCoords(candidates[i]);
+      double d = 0.0;
+      for (size_t j = 0; j < coords.size(); j++)
+        d += std::abs(coords[j] - target[j]) / std::max({std::abs(coords[j]), std::abs(target[j]), 1.0});
+      if (d < distance) {
+        distance = d;
+        closest = i;
+      }
+    }
+    return closest;
+  }
+
+  /**
+     @brief Whether kernels that have not been tuned at the present
+     volume launch with the parameters tuned at the nearest volume
+     instead of being tuned, which is enabled by setting the
+     environment variable QUDA_TUNE_INTERPOLATE=1.  This avoids the
+     tuning cost of short jobs, e.g., on a new rank decomposition.
+   */
+  static bool tuneInterpolate()
+  {
+    static bool init = false;
+    static bool interpolate = false;
+
+    if (!init) {
+      char *interpolate_env = getenv("QUDA_TUNE_INTERPOLATE");
+      if (interpolate_env && strcmp(interpolate_env, "1") == 0) interpolate = true;
+      init = true;
+    }
+    return interpolate;
+  }
+
+  /**
+     @brief The number of launches of a kernel with interpolated
+     parameters, after which it is tuned regardless, which is set
+     with the environment variable QUDA_TUNE_INTERPOLATE_RETUNE.  The
+     default of 0 never tunes such kernels, so long jobs recover the
+     fully tuned performance only if this is set.
+   */
+  static uint64_t tuneInterpolateRetune()
+  {
+    static bool init = false;
+    static uint64_t retune = 0;
+
+    if (!init) {
+      char *retune_env = getenv("QUDA_TUNE_INTERPOLATE_RETUNE");
+      if (retune_env) retune = std::strtoull(retune_env, nullptr, 10);
+      init = true;
+    }
+    return retune;
+  }
+
+  /**
+     The parameters used in place of tuned ones, together with the
+     number of times they have been launched.  These are not added to
+     the tunecache, so they are never saved, and a kernel is tuned
+     normally in a later job.
+   */
+  struct interpolated_param_t {
+    TuneParam param;
+    uint64_t n_launch = 0;
+  };
+  static std::map<TuneKey, interpolated_param_t> interpolated_params;
+
+  /**
+     @brief Derive launch parameters for a kernel that has not been
+     tuned at the present volume from those tuned at the nearest
+     volume.  The tuned parameters may not be valid at the present
+     volume (e.g., the grid is derived from the number of threads),
+     so we use the closest of the candidates the tuning would have
+     considered.  The time is scaled by the volume ratio, as an
+     estimate for the profile and timeline.
+     @param[in] tunable The kernel being launched
+     @param[in] key The key of the kernel being launched
+     @param[out] param The interpolated launch parameters
+     @return Whether the kernel has been tuned at any other volume
+   */
+  static bool interpolateTuneParam(const Tunable &tunable, const TuneKey &key, TuneParam &param)
+  {
+    const TuneKey *nearest_key = nullptr;
+    const TuneParam *nearest = nearestVolumeParam(key, &nearest_key);
+    if (!nearest) return false;
+
+    TuneParam candidate;
+    candidate.aux = make_int4(-1, -1, -1, -1);
+    tunable.initTuneParam(candidate);
+    if (tunable.hostLaunch()) host::init_tune_param(candidate, tunable.hostChunkDim());
+
+    std::vector<TuneParam> candidates;
+    for (bool more = true; more;) {
+      candidates.push_back(candidate);
+      more = tunable.hostLaunch() ? host::advance_tune_param(candidate, tunable.hostChunkDim()) :
+                                    tunable.advanceTuneParam(candidate);
+    }
+
+    param = candidates[closestCandidate(candidates, *nearest)];
+    param.comment = nearest->comment;
+    param.time = nearest->time * keyVolume(key.volume) / keyVolume(nearest_key->volume);
+    param.n_calls = 0;
+
+    if (getVerbosity() >= QUDA_VERBOSE)
+      printfQuda("Launching %s with %s at vol=%s with %s interpolated from vol=%s\n", key.name, key.aux, key.volume,
+                 tunable.paramString(param).c_str(), nearest_key->volume);
+    return true;
+  }
+
+  /**
+     @brief Record a kernel launch on the timeline.  Launches are
+     asynchronous, so the event is an estimate: it lasts for the tuned
+     time of the kernel, starting from the launch or from the end of
+     the previous kernel, whichever is later.
+   */
+  static void timelineLaunch(const Tunable &tunable, const TuneKey &key, const TuneParam &param)
+  {
+    static double kernel_end = 0.0;
+    const double start = std::max(timeline::now(), kernel_end);
+    kernel_end = start + 1e6 * param.time;
+    timeline::record(key.name, "kernels", start, 1e6 * param.time,
+                     {{"volume", key.volume}, {"aux", key.aux}, {"param", tunable.paramString(param)}});
+  }
+
   /**
    * Return the optimal launch parameters for a given kernel, either
    * by retrieving them from tunecache or autotuning on the spot.
@@ -787,6 +1763,7 @@ namespace quda
 
     TuneKey key = tunable.tuneKey();
     if (use_managed_memory()) strcat(key.aux, ",managed");
+    key.rehash();
     last_key = key;
 
 #ifdef LAUNCH_TIMER
@@ -795,17 +1772,32 @@ namespace quda
 #endif
 
     static const Tunable *active_tunable; // for error checking
-    it = tunecache.find(key);
+
+    tunable.launch_stats = nullptr;
+
+    // repeat launches with an unchanged key reuse the memoized entry, else we look it up
+    auto &memo = tunable.tune_memo;
+    TuneParam *cached = nullptr;
+    TuneCache::entry_t *entry = nullptr;
+    if (memo.param && memo.generation == tunecache.generation() && *memo.key == key) {
+      cached = memo.param;
+    } else if ((entry = tunecache.find_entry(key))) {
+      cached = &entry->second;
+      memo.key = &entry->first;
+      memo.generation = tunecache.generation();
+      memo.param = cached;
+      memo.stats = nullptr;
+    }
 
     // first check if we have the tuned value and return if we have it
-    if (enabled == QUDA_TUNE_YES && it != tunecache.end()) {
+    if (enabled == QUDA_TUNE_YES && cached) {
 
 #ifdef LAUNCH_TIMER
       launchTimer.TPSTOP(QUDA_PROFILE_PREAMBLE);
       launchTimer.TPSTART(QUDA_PROFILE_COMPUTE);
 #endif
 
-      TuneParam &param_tuned = it->second;
+      TuneParam &param_tuned = *cached;
 
       if (verbosity >= QUDA_DEBUG_VERBOSE) {
         printfQuda("Launching %s with %s at vol=%s with %s\n", key.name, key.aux, key.volume,
@@ -832,6 +1824,13 @@ namespace quda
         trace_list.push_back(trace_entry);
       }
 
+      if (!tuning && timeline::enabled()) timelineLaunch(tunable, key, param_tuned);
+
+      if (!tuning && launchStatsEnabled()) {
+        if (!memo.stats) memo.stats = &launch_stats[key];
+        tunable.launch_stats = memo.stats;
+      }
+
       return param_tuned;
     }
 
@@ -840,12 +1839,46 @@ namespace quda
     launchTimer.TPSTOP(QUDA_PROFILE_TOTAL);
 #endif
 
+    // fall back to the parameters of the nearest volume, unless they have been used enough to warrant tuning
+    if (enabled == QUDA_TUNE_YES && !tuning && tuneInterpolate() && !policyTuning() && !uberTuning()) {
+      auto it = interpolated_params.find(key);
+      if (it == interpolated_params.end()) {
+        TuneParam interpolated;
+        if (interpolateTuneParam(tunable, key, interpolated))
+          it = interpolated_params.emplace(key, interpolated_param_t {interpolated}).first;
+      }
+
+      if (it != interpolated_params.end()) {
+        auto &entry = it->second;
+        if (tuneInterpolateRetune() == 0 || ++entry.n_launch <= tuneInterpolateRetune()) {
+          tunable.checkLaunchParam(entry.param);
+          if (verbosity >= QUDA_DEBUG_VERBOSE) {
+            printfQuda("Launching %s with %s at vol=%s with %s (interpolated)\n", key.name, key.aux, key.volume,
+                       tunable.paramString(entry.param).c_str());
+          }
+
+          if (traceEnabled() >= 2) {
+            TraceKey trace_entry(key, entry.param.time);
+            trace_list.push_back(trace_entry);
+          }
+
+          if (timeline::enabled()) timelineLaunch(tunable, key, entry.param);
+
+          if (launchStatsEnabled()) tunable.launch_stats = &launch_stats[key];
+
+          return entry.param;
+        }
+        interpolated_params.erase(it); // used enough, so tune it now
+      }
+    }
+
     static TuneParam param;
 
     if (enabled == QUDA_TUNE_NO) {
       TuneParam param_default;
       param_default.aux = make_int4(-1, -1, -1, -1);
       tunable.defaultTuneParam(param_default);
+      if (tunable.hostLaunch()) host::set_launch_param(param_default, host::launch_param());
       tunable.checkLaunchParam(param_default);
       if (verbosity >= QUDA_DEBUG_VERBOSE) {
         printfQuda("Launching %s with %s at vol=%s with %s (untuned)\n", key.name, key.aux, key.volume,
@@ -857,8 +1890,13 @@ namespace quda
 
       /* As long as global reductions are not disabled, only do the
          tuning on node 0, else do the tuning on all nodes since we
-         can't guarantee that all nodes are partaking */
-      if (comm_rank_global() == 0 || !commGlobalReduction() || policyTuning() || uberTuning()) {
+         can't guarantee that all nodes are partaking.  With
+         distributed tuning, the candidates are instead split across
+         all nodes.  This is not possible with policy tuning, where all
+         nodes must launch the same policy for the communication to
+         match up. */
+      const bool distributed = distributedTuning() && commGlobalReduction() && !policyTuning() && !uberTuning();
+      if (comm_rank_global() == 0 || !commGlobalReduction() || policyTuning() || uberTuning() || distributed) {
         TuneParam best_param;
         TuneCandidates tc(tunable.num_candidates());
         float best_time;
@@ -876,17 +1914,52 @@ namespace quda
         }
 
         const auto &stream = device::get_default_stream();
-        device_timer_t timer(stream);
+        tune_timer_t timer(tunable.hostLaunch(), stream);
 
         host_timer_t tune_timer;
         tune_timer.start(__func__, __FILE__, __LINE__);
 
         param.aux = make_int4(-1, -1, -1, -1);
         tunable.initTuneParam(param);
+        if (tunable.hostLaunch()) host::init_tune_param(param, tunable.hostChunkDim());
+
+        // with policy tuning all nodes must launch the same candidates, so the search cannot depend on the timings
+        const bool lockstep = policyTuning() || uberTuning();
+        const TuneSearch search = lockstep ? TuneSearch::EXHAUSTIVE : tunable.tune_search();
+        const double budget = lockstep ? 0.0 : tunable.max_tune_time();
+        auto over_budget = [&]() {
+          tune_timer.peek(__func__, __FILE__, __LINE__);
+          return budget > 0.0 && tune_timer.last() > budget;
+        };
+
+        // enumerate the candidates.  With distributed tuning each rank takes every comm_size_global()-th one,
+        // except for coordinate descent, where all ranks walk the same path and share out the timing of each step
+        const bool stride = distributed && search != TuneSearch::DESCENT;
+        std::vector<TuneParam> candidates;
+        for (size_t i = 0; candidatetuning; i++) {
+          if (!stride || i % comm_size_global() == static_cast<size_t>(comm_rank_global()))
+            candidates.push_back(param);
+          candidatetuning = tunable.hostLaunch() ? host::advance_tune_param(param, tunable.hostChunkDim()) :
+                                                   tunable.advanceTuneParam(param);
+        }
+
+        // warm start the search from the candidate closest to the parameters tuned for the nearest volume
+        size_t start = 0;
+        const TuneParam *nearest = candidates.size() > 1 ? nearestVolumeParam(key) : nullptr;
+        if (nearest) start = closestCandidate(candidates, *nearest);
 
         auto error = QUDA_SUCCESS;
         const int candidate_iterations = tunable.candidate_iter();
-        while (tuning && candidatetuning) {
+
+        /*
+          Time a candidate for the given number of iterations after a
+          warm-up call.  If the first iteration is slower than
+          abandon_time, the remaining iterations are skipped.  Returns
+          the time per iteration, or FLT_MAX if the launch failed or
+          the candidate was abandoned.
+        */
+        auto time_candidate = [&](const TuneParam &candidate, int iterations, float abandon_time, const char *tag) {
+          param = candidate;
           qudaDeviceSynchronize();
           tunable.checkLaunchParam(param);
           if (verbosity >= QUDA_DEBUG_VERBOSE) {
@@ -899,11 +1972,20 @@ namespace quda
 
           tunable.apply(stream); // do initial call in case we need to jit compile for these parameters or if policy tuning
 
-          timer.start();
-          for (int i = 0; i < candidate_iterations; i++) {
-            tunable.apply(stream); // calls tuneLaunch() again, which simply returns the currently active param
+          double elapsed = 0.0;
+          int done = 0;
+          while (done < iterations) {
+            // when abandoning slow candidates, the first iteration is timed on its own
+            const int n = (abandon_time < FLT_MAX && done == 0) ? 1 : iterations - done;
+            timer.start();
+            for (int i = 0; i < n; i++) {
+              tunable.apply(stream); // calls tuneLaunch() again, which simply returns the currently active param
+            }
+            timer.stop();
+            elapsed += timer.last();
+            done += n;
+            if (elapsed / done > abandon_time) break;
           }
-          timer.stop();
           qudaDeviceSynchronize();
           error = qudaGetLastError();
 
@@ -913,24 +1995,115 @@ namespace quda
               errorQuda("Failed to clear error state %s\n", qudaGetLastErrorString().c_str());
           }
 
-          float elapsed_time = timer.last() / candidate_iterations;
-          param.time = elapsed_time;
-          if ((error == QUDA_SUCCESS) && (tunable.launchError() == QUDA_SUCCESS)) tc.pushCandidate(param);
-
+          float elapsed_time = elapsed / done;
+          const bool success = error == QUDA_SUCCESS && tunable.launchError() == QUDA_SUCCESS;
           if ((verbosity >= QUDA_DEBUG_VERBOSE)) {
-            if (error == QUDA_SUCCESS && tunable.launchError() == QUDA_SUCCESS) {
-              printfQuda("C   %s gives %s\n", tunable.paramString(param).c_str(),
+            if (!success) {
+              printfQuda("    %s gives %s\n", tunable.paramString(param).c_str(), qudaGetLastErrorString().c_str());
+            } else if (done < iterations) {
+              printfQuda("    %s abandoned after %s\n", tunable.paramString(param).c_str(),
                          tunable.perfString(elapsed_time).c_str());
             } else {
-              printfQuda("    %s gives %s\n", tunable.paramString(param).c_str(), qudaGetLastErrorString().c_str());
-              error = QUDA_SUCCESS;
+              printfQuda("%s   %s gives %s\n", tag, tunable.paramString(param).c_str(),
+                         tunable.perfString(elapsed_time).c_str());
             }
           }
-          candidatetuning = tunable.advanceTuneParam(param);
           tunable.launchError() = QUDA_SUCCESS;
+
+          return (success && done == iterations) ? elapsed_time : FLT_MAX;
+        };
+
+        if (search == TuneSearch::DESCENT) {
+          // coordinate descent: move to the fastest candidate that differs only along one group of
+          // coordinates, cycling through the groups until there is no further improvement
+          std::vector<float> times(candidates.size(), -1.0f); // negative until timed
+
+          /*
+            Time the candidates of a step that are not yet timed.  With
+            distributed tuning these are shared out across the ranks,
+            and the times then min-reduced, so that all ranks take the
+            same step.  Returns false once the budget is exhausted on
+            any rank.
+          */
+          auto time_step = [&](const std::vector<size_t> &step, bool check_budget) {
+            std::vector<size_t> todo;
+            for (auto i : step)
+              if (times[i] < 0.0f) todo.push_back(i);
+
+            std::vector<double> t(todo.size() + 1, DBL_MAX); // the last entry flags the budget
+            bool in_budget = true;
+            for (size_t j = 0; j < todo.size() && tuning; j++) {
+              if (distributed && j % comm_size_global() != static_cast<size_t>(comm_rank_global())) continue;
+              if (check_budget && over_budget()) {
+                in_budget = false;
+                break;
+              }
+              t[j] = time_candidate(candidates[todo[j]], candidate_iterations, FLT_MAX, "C");
+            }
+            t.back() = in_budget ? 1.0 : 0.0;
+            if (distributed) comm_allreduce_min_array_global(t.data(), t.size());
+
+            for (size_t j = 0; j < todo.size(); j++) {
+              times[todo[j]] = std::min(t[j], static_cast<double>(FLT_MAX));
+              if (times[todo[j]] < FLT_MAX) {
+                candidates[todo[j]].time = times[todo[j]];
+                tc.pushCandidate(candidates[todo[j]]);
+              }
+            }
+            return t.back() > 0.0;
+          };
+
+          size_t current = start;
+          bool improved = !candidates.empty();
+          if (improved) time_step({current}, false);
+          float current_time = candidates.empty() ? FLT_MAX : times[current];
+          while (improved && tuning) {
+            improved = false;
+            for (auto &group : tune_coord_groups) {
+              const TuneParam base = candidates[current];
+              std::vector<size_t> step;
+              for (size_t i = 0; i < candidates.size(); i++)
+                if (sameOutsideGroup(candidates[i], base, group)) step.push_back(i);
+              const bool in_budget = time_step(step, true);
+
+              for (auto i : step) {
+                if (times[i] >= 0.0f && times[i] < current_time) {
+                  current = i;
+                  current_time = times[i];
+                  improved = true;
+                }
+              }
+              if (!in_budget || !tuning) {
+                improved = false;
+                break;
+              }
+            }
+          }
+        } else {
+          // sweep over all candidates, starting from the warm start, and abandoning clearly slower ones if halving
+          const float abandon_factor = 2.0;
+          for (size_t n = 0; n < candidates.size() && tuning; n++) {
+            if (n > 0 && over_budget()) {
+              if (verbosity >= QUDA_VERBOSE)
+                printfQuda("Tuning budget of %g seconds exhausted for %s after %lu of %lu candidates\n", budget,
+                           key.name, n, candidates.size());
+              break;
+            }
+            auto &candidate = candidates[(start + n) % candidates.size()];
+            const float abandon_time = search == TuneSearch::HALVING && tc.getBestTime() < FLT_MAX ?
+              abandon_factor * tc.getBestTime() :
+              FLT_MAX;
+            float elapsed_time = time_candidate(candidate, candidate_iterations, abandon_time, "C");
+            if (elapsed_time < FLT_MAX) {
+              candidate.time = elapsed_time;
+              tc.pushCandidate(candidate);
+            }
+          }
         }
 
-        if (tc.empty()) {
+        // with distributed tuning, a rank may have no candidates, so we only fail if no rank has any
+        if (distributed) tc.reduceBestTime();
+        if (distributed ? tc.getBestTime() == FLT_MAX : tc.empty()) {
           if (error != QUDA_SUCCESS) warningQuda("Last error: %s\n", qudaGetLastErrorString().c_str());
           errorQuda("Auto-tuning failed for %s with %s at vol=%s", key.name, key.aux, key.volume);
         }
@@ -946,53 +2119,52 @@ namespace quda
                      key.name, key.aux, tc.getBestTime(), tuneiterations);
         }
 
-        // we now have the candidates, now need to loop over candidates
-        while (!tc.empty()) {
-          param = tc.top();
-          qudaDeviceSynchronize();
-          tunable.checkLaunchParam(param);
-          if (verbosity >= QUDA_DEBUG_VERBOSE) {
-            printfQuda("About to call tunable.apply block=(%d,%d,%d) grid=(%d,%d,%d) shared_bytes=%d aux=(%d,%d,%d,%d)\n",
-                       static_cast<int>(param.block.x), static_cast<int>(param.block.y),
-                       static_cast<int>(param.block.z), static_cast<int>(param.grid.x), static_cast<int>(param.grid.y),
-                       static_cast<int>(param.grid.z), static_cast<int>(param.shared_bytes),
-                       static_cast<int>(param.aux.x), static_cast<int>(param.aux.y), static_cast<int>(param.aux.z), static_cast<int>(param.aux.w));
-          }
-
-          tunable.apply(stream); // do warm up call, for consistency with the candidate tuning
-          timer.start();
-          for (int i = 0; i < tuneiterations; i++) {
-            tunable.apply(stream); // calls tuneLaunch() again, which simply returns the currently active param
+        if (search == TuneSearch::HALVING) {
+          // successive halving: time the candidates with a fraction of the iterations and keep the faster
+          // half, doubling the iterations each round, so that the final pair is timed with all of them
+          std::vector<TuneParam> pool;
+          for (; !tc.empty(); tc.pop()) pool.push_back(tc.top());
+
+          // with distributed tuning the candidates of all ranks are pooled, and the timing of each round
+          // is shared out and min-reduced, so that all ranks promote the same candidates
+          if (distributed) pool = gatherCandidates(pool, tunable.num_candidates());
+
+          int rounds = 1;
+          for (auto n = pool.size(); n > 2; n = (n + 1) / 2) rounds++;
+          int iterations = std::max(tuneiterations >> (rounds - 1), 1);
+
+          while (true) {
+            std::vector<double> t(pool.size(), DBL_MAX);
+            for (size_t j = 0; j < pool.size(); j++)
+              if (!distributed || j % comm_size_global() == static_cast<size_t>(comm_rank_global()))
+                t[j] = time_candidate(pool[j], iterations, FLT_MAX, "T");
+            if (distributed) comm_allreduce_min_array_global(t.data(), t.size());
+            for (size_t j = 0; j < pool.size(); j++) pool[j].time = std::min(t[j], static_cast<double>(FLT_MAX));
+
+            std::stable_sort(pool.begin(), pool.end(), TuneParamComp());
+            if (pool.size() <= 2) break;
+            pool.resize((pool.size() + 1) / 2);
+            iterations = std::min(2 * iterations, tuneiterations);
           }
-          timer.stop();
-          qudaDeviceSynchronize();
-          auto error = qudaGetLastError();
 
-          if (error != QUDA_SUCCESS) { // check we don't have a sticky error
-            qudaDeviceSynchronize();
-            if (qudaGetLastError() != QUDA_SUCCESS)
-              errorQuda("Failed to clear error state %s\n", qudaGetLastErrorString().c_str());
+          if (pool[0].time < FLT_MAX) {
+            best_time = pool[0].time;
+            best_param = pool[0];
           }
+        }
 
-          float elapsed_time = timer.last() / tuneiterations;
-
-          if ((elapsed_time < best_time) && (error == QUDA_SUCCESS) && (tunable.launchError() == QUDA_SUCCESS)) {
+        // we now have the candidates, now need to loop over candidates
+        while (!tc.empty()) {
+          float elapsed_time = time_candidate(tc.top(), tuneiterations, FLT_MAX, "T");
+          if (elapsed_time < best_time) {
             best_time = elapsed_time;
             best_param = param;
           }
-          if ((verbosity >= QUDA_DEBUG_VERBOSE)) {
-            if (error == QUDA_SUCCESS && tunable.launchError() == QUDA_SUCCESS) {
-              printfQuda("T   %s gives %s\n", tunable.paramString(param).c_str(),
-                         tunable.perfString(elapsed_time).c_str());
-            } else {
-              printfQuda("    %s gives %s\n", tunable.paramString(param).c_str(), qudaGetLastErrorString().c_str());
-            }
-          }
-
-          tunable.launchError() = QUDA_SUCCESS;
           tc.pop();
         }
 
+        if (distributed) reduceBestParam(best_param, best_time);
+
         tuning = false;
         candidatetuning = true;
         tune_timer.stop(__func__, __FILE__, __LINE__);
@@ -1020,8 +2192,10 @@ namespace quda
         tuning = false;
         param = best_param;
         tunecache[key] = best_param;
+        tunecache.set_dirty(key); // a re-tuned entry must be saved again
       }
-      if (commGlobalReduction() || policyTuning() || uberTuning()) { broadcastTuneCache(); }
+      // with distributed tuning all nodes have already agreed on the parameters
+      if ((commGlobalReduction() || policyTuning() || uberTuning()) && !distributed) { broadcastTuneCache(); }
 
       {
         static host_timer_t time_since_save;
@@ -1037,9 +2211,9 @@ namespace quda
       }
 
       // check this process is getting the key that is expected
-      if (tunecache.find(key) == tunecache.end()) {
+      if (!tunecache.find(key)) {
 
-        // if we can't find the key, and debugging, then print out the entire map
+        // if we can't find the key, and debugging, then print out the entire cache
         if (verbosity >= QUDA_DEBUG_VERBOSE)
           for (auto elem : tunecache) std::cout << elem.first << ": " << elem.second << std::endl;
 
@@ -1052,6 +2226,10 @@ namespace quda
         trace_list.push_back(trace_entry);
       }
 
+      if (timeline::enabled()) timelineLaunch(tunable, key, param);
+
+      if (launchStatsEnabled()) tunable.launch_stats = &launch_stats[key];
+
     } else if (&tunable != active_tunable) {
       errorQuda("Unexpected call to tuneLaunch() in %s::apply()", typeid(tunable).name());
     }
@@ -9,6 +9,8 @@
 #include <util_quda.h>
 #include <malloc_quda.h>
 #include <tune_quda.h>
+#include <uint_to_char.h>
+#include <host_thread_helper.h>
 
 using namespace quda;
 
@@ -135,15 +137,13 @@ void popOutputPrefix()
 char *getPrintBuffer() { return buffer_; }
 
 char* getOmpThreadStr() {
+  // the host thread count can be changed at run time so we regenerate the string each call
   static char omp_thread_string[128];
-  static bool init = false;
-  if (!init) {
-    strcpy(omp_thread_string,"omp_threads=");
-    char *omp_threads = getenv("OMP_NUM_THREADS");
-    strcat(omp_thread_string, omp_threads ? omp_threads : "1");
-    strcat(omp_thread_string, ",");
-    init = true;
-  }
+  strcpy(omp_thread_string,"omp_threads=");
+  char omp_threads[16];
+  i32toa(omp_threads, quda::host::max_threads());
+  strcat(omp_thread_string, omp_threads);
+  strcat(omp_thread_string, ",");
   return omp_thread_string;
 }
 
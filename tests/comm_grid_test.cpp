@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include <comm_quda.h>
+#include <gtest/gtest.h>
+
+// The grid selection is plain host code, so we test it without initializing communications
+
+using namespace quda;
+
+using grid_t = std::array<int, 4>;
+
+/**
+   @brief Halo volume summed over all ranks that crosses a node boundary for a given grid and rank map
+ */
+static double off_node_volume(const grid_t &X, const grid_t &dims, const std::vector<int> &rank_map,
+                              const std::vector<int> &node)
+{
+  auto index = [&](const grid_t &x) { return ((x[0] * dims[1] + x[1]) * dims[2] + x[2]) * dims[3] + x[3]; };
+  double local_volume = 1.0;
+  for (int d = 0; d < 4; d++) local_volume *= X[d] / dims[d];
+
+  double volume = 0.0;
+  grid_t x;
+  for (x[0] = 0; x[0] < dims[0]; x[0]++)
+    for (x[1] = 0; x[1] < dims[1]; x[1]++)
+      for (x[2] = 0; x[2] < dims[2]; x[2]++)
+        for (x[3] = 0; x[3] < dims[3]; x[3]++)
+          for (int d = 0; d < 4; d++) {
+            if (dims[d] == 1) continue;
+            for (int dir : {-1, 1}) {
+              grid_t y = x;
+              y[d] = (y[d] + dir + dims[d]) % dims[d];
+              if (node[rank_map[index(x)]] != node[rank_map[index(y)]]) volume += local_volume / (X[d] / dims[d]);
+            }
+          }
+  return volume;
+}
+
+static void check_permutation(const std::vector<int> &rank_map, int size)
+{
+  std::vector<int> sorted = rank_map;
+  std::sort(sorted.begin(), sorted.end());
+  for (int r = 0; r < size; r++) EXPECT_EQ(sorted[r], r);
+}
+
+TEST(CommGridTest, single_rank)
+{
+  grid_t X = {8, 8, 8, 8}, dims;
+  std::vector<int> rank_map;
+  comm_select_grid(4, X.data(), {0}, dims.data(), rank_map);
+  EXPECT_EQ(dims, (grid_t {1, 1, 1, 1}));
+  EXPECT_EQ(rank_map, std::vector<int> {0});
+}
+
+TEST(CommGridTest, elongated_lattice)
+{
+  // all cuts should be along the long dimension, which has the smallest faces
+  grid_t X = {8, 8, 8, 128}, dims;
+  std::vector<int> node = {0, 0, 0, 0, 1, 1, 1, 1}, rank_map;
+  comm_select_grid(4, X.data(), node, dims.data(), rank_map);
+  EXPECT_EQ(dims, (grid_t {1, 1, 1, 8}));
+  check_permutation(rank_map, 8);
+  // only the two cuts between the node blocks leave a node
+  EXPECT_EQ(off_node_volume(X, dims, rank_map, node), 2 * 2 * 8 * 8 * 8);
+}
+
+TEST(CommGridTest, even_local_extents)
+{
+  // splitting x by 4 would give an odd local extent
+  grid_t X = {12, 16, 16, 16}, dims;
+  std::vector<int> node(4, 0), rank_map;
+  comm_select_grid(4, X.data(), node, dims.data(), rank_map);
+  EXPECT_EQ(dims[0] * dims[1] * dims[2] * dims[3], 4);
+  for (int d = 0; d < 4; d++) EXPECT_EQ((X[d] / dims[d]) % 2, 0);
+  EXPECT_EQ(X[0] % dims[0], 0);
+}
+
+TEST(CommGridTest, round_robin_placement)
+{
+  // ranks are dealt out to the nodes round robin, so the lexicographical map would scatter each node
+  grid_t X = {16, 16, 16, 32}, dims;
+  const int size = 16;
+  std::vector<int> node, rank_map;
+  for (int r = 0; r < size; r++) node.push_back(r % 4);
+  comm_select_grid(4, X.data(), node, dims.data(), rank_map);
+  check_permutation(rank_map, size);
+
+  std::vector<int> lex_map(size);
+  for (int r = 0; r < size; r++) lex_map[r] = r;
+  double selected = off_node_volume(X, dims, rank_map, node);
+  EXPECT_LT(selected, off_node_volume(X, dims, lex_map, node));
+
+  // the selected map must be at least as good as any grid with a lexicographical block placement
+  std::vector<int> block_node(size);
+  for (int r = 0; r < size; r++) block_node[r] = r / 4;
+  grid_t block_dims;
+  std::vector<int> block_map;
+  comm_select_grid(4, X.data(), block_node, block_dims.data(), block_map);
+  EXPECT_EQ(block_dims, dims);
+  EXPECT_EQ(off_node_volume(X, block_dims, block_map, block_node), selected);
+}
+
+TEST(CommGridTest, intra_node_neighbors)
+{
+  // two nodes, where the cheapest cut between nodes is along t, and the node's ranks split z and t
+  grid_t X = {24, 24, 32, 48}, dims;
+  std::vector<int> node = {0, 0, 0, 0, 1, 1, 1, 1}, rank_map;
+  comm_select_grid(4, X.data(), node, dims.data(), rank_map);
+  check_permutation(rank_map, 8);
+  EXPECT_EQ(dims, (grid_t {1, 1, 2, 4}));
+  EXPECT_EQ(off_node_volume(X, dims, rank_map, node), 2 * 2 * 24 * 24 * 32);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -124,6 +124,15 @@ protected:
       execute = false;
       GTEST_SKIP();
     }
+#endif
+#ifdef QUDA_TARGET_CPU // skip overrelaxation tests since these need multi-thread blocks
+    {
+      const char *name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+      if (strcmp(name, "Landau_Overrelaxation") == 0 || strcmp(name, "Coulomb_Overrelaxation") == 0) {
+        execute = false;
+        GTEST_SKIP();
+      }
+    }
 #endif
     if (execute) {
       setVerbosity(verbosity);
@@ -177,7 +177,7 @@ void init(int argc, char **argv)
   }
 }
 
-std::vector<double> solve(test_t param)
+solve_result_t solve(test_t param)
 {
   inv_param.inv_type = ::testing::get<0>(param);
   inv_param.solution_type = ::testing::get<1>(param);
@@ -205,6 +205,8 @@ std::vector<double> solve(test_t param)
   for (int i = 0; i < 4; i++) inv_param.split_grid[i] = grid_partition[i];
   int num_sub_partition = grid_partition[0] * grid_partition[1] * grid_partition[2] * grid_partition[3];
   bool use_split_grid = num_sub_partition > 1;
+  // block solvers take all the sources at once through the multi-source interface
+  bool use_multi_src = use_split_grid || (inv_param.inv_type == QUDA_BLOCK_CG_INVERTER && Nsrc > 1);
 
   // Now QUDA is initialised and the fields are loaded, we may setup the preconditioner
   void *mg_preconditioner = nullptr;
@@ -235,7 +237,7 @@ std::vector<double> solve(test_t param)
   // QUDA invert test BEGIN
   //----------------------------------------------------------------------------
   if (multishift > 1) {
-    if (use_split_grid) { errorQuda("Split grid does not work with multishift yet."); }
+    if (use_multi_src) { errorQuda("Split grid and block solvers do not work with multishift yet."); }
     inv_param.num_offset = multishift;
     for (int i = 0; i < multishift; i++) {
       // Set masses and offsets
@@ -259,6 +261,9 @@ std::vector<double> solve(test_t param)
 
   quda::RNG rng(check, 1234);
 
+  // start each test from an empty recycled subspace
+  if (inv_param.inv_type == QUDA_GCRODR_INVERTER) flushRecycleQuda(inv_param.recycle_index);
+
   for (int i = 0; i < Nsrc; i++) {
     // Populate the host spinor with random numbers.
     in[i] = quda::ColorSpinorField(cs_param);
@@ -266,7 +271,7 @@ std::vector<double> solve(test_t param)
     out[i] = quda::ColorSpinorField(cs_param);
   }
 
-  if (!use_split_grid) {
+  if (!use_multi_src) {
 
     for (int i = 0; i < Nsrc; i++) {
       // If deflating, preserve the deflation space between solves
@@ -320,17 +325,17 @@ std::vector<double> solve(test_t param)
   if (inv_multigrid) destroyMultigridQuda(mg_preconditioner);
 
   // Compute performance statistics
-  if (Nsrc > 1 && !use_split_grid) performanceStats(time, gflops, iter);
+  if (Nsrc > 1 && !use_multi_src) performanceStats(time, gflops, iter);
 
-  std::vector<double> res(Nsrc);
+  solve_result_t result {std::vector<double>(Nsrc), iter};
   // Perform host side verification of inversion if requested
   if (verify_results) {
     for (int i = 0; i < Nsrc; i++) {
-      res[i] = verifyInversion(out[i].V(), _hp_multi_x[i].data(), in[i].V(), check.V(), gauge_param, inv_param,
-                               gauge.data(), clover.data(), clover_inv.data());
+      result.res[i] = verifyInversion(out[i].V(), _hp_multi_x[i].data(), in[i].V(), check.V(), gauge_param, inv_param,
+                                      gauge.data(), clover.data(), clover_inv.data());
     }
   }
-  return res;
+  return result;
 }
 
 int main(int argc, char **argv)
@@ -120,7 +120,15 @@ bool skip_test(test_t param)
   return false;
 }
 
-std::vector<double> solve(test_t param);
+/**
+   @brief The true residual and the iteration count of each source of a test solve
+ */
+struct solve_result_t {
+  std::vector<double> res;
+  std::vector<int> iter;
+};
+
+solve_result_t solve(test_t param);
 
 TEST_P(InvertTest, verify)
 {
@@ -132,7 +140,13 @@ TEST_P(InvertTest, verify)
   if (is_full_solution(::testing::get<1>(GetParam())) && is_preconditioned_solve(::testing::get<2>(GetParam())))
     tol *= 10;
 
-  for (auto rsd : solve(GetParam())) EXPECT_LE(rsd, tol);
+  auto result = solve(GetParam());
+  for (auto rsd : result.res) EXPECT_LE(rsd, tol);
+
+  // the recycled subspace built by the first solve must accelerate the later ones
+  if (::testing::get<0>(GetParam()) == QUDA_GCRODR_INVERTER && inv_param.recycle_max_dim > 0) {
+    for (auto i = 1u; i < result.iter.size(); i++) EXPECT_LT(result.iter[i], result.iter[0]);
+  }
 }
 
 std::string gettestname(::testing::TestParamInfo<test_t> param)
@@ -212,6 +226,21 @@ INSTANTIATE_TEST_SUITE_P(MultiShiftEvenOdd, InvertTest,
                                  no_schwarz),
                          gettestname);
 
+// preconditioned block solves (all --nsrc sources are solved at once)
+INSTANTIATE_TEST_SUITE_P(BlockEvenOdd, InvertTest,
+                         Combine(Values(QUDA_BLOCK_CG_INVERTER),
+                                 Values(QUDA_MATPCDAG_MATPC_SOLUTION, QUDA_MAT_SOLUTION),
+                                 Values(QUDA_NORMOP_PC_SOLVE), sloppy_precisions, Values(1), Values(1),
+                                 no_schwarz),
+                         gettestname);
+
+// preconditioned recycling solves (the recycled subspace is kept between the --nsrc solves)
+INSTANTIATE_TEST_SUITE_P(RecycleEvenOdd, InvertTest,
+                         Combine(Values(QUDA_GCRODR_INVERTER), Values(QUDA_MATPC_SOLUTION, QUDA_MAT_SOLUTION),
+                                 Values(QUDA_DIRECT_PC_SOLVE), sloppy_precisions, Values(1), Values(1),
+                                 no_schwarz),
+                         gettestname);
+
 // Schwarz-preconditioned normal solves
 INSTANTIATE_TEST_SUITE_P(SchwarzNormal, InvertTest,
                          Combine(Values(QUDA_PCG_INVERTER),
@@ -0,0 +1,152 @@
+#include <cstdlib>
+#include <map>
+
+#include <memory_pool.h>
+#include <gtest/gtest.h>
+
+// The memory pool is plain host code, so we test it on top of the host allocator
+
+using namespace quda;
+
+constexpr size_t MiB = 1 << 20;
+
+/** the outstanding allocations of the underlying allocator */
+static std::map<void *, size_t> raw_alloc;
+
+static void *raw_malloc(const char *, const char *, int, size_t bytes)
+{
+  void *ptr = std::malloc(bytes);
+  raw_alloc[ptr] = bytes;
+  return ptr;
+}
+
+static void raw_free(const char *, const char *, int, void *ptr)
+{
+  ASSERT_EQ(raw_alloc.count(ptr), 1u) << "Underlying allocator freeing unknown pointer";
+  raw_alloc.erase(ptr);
+  std::free(ptr);
+}
+
+class MemoryPoolTest : public ::testing::Test
+{
+protected:
+  MemoryPool pool;
+
+  MemoryPoolTest() : pool("Test", raw_malloc, raw_free, 2 * MiB, 0.25) { }
+
+  void TearDown() override
+  {
+    pool.flush();
+    EXPECT_TRUE(raw_alloc.empty()) << "Flushed pool still holds slabs";
+  }
+};
+
+TEST_F(MemoryPoolTest, reuse)
+{
+  void *a = pool.allocate(__func__, __FILE__, __LINE__, MiB);
+  pool.free(a);
+  void *b = pool.allocate(__func__, __FILE__, __LINE__, MiB);
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(pool.get_stats().n_slab_alloc, 1u);
+  EXPECT_EQ(pool.get_stats().n_hit, 1u);
+  pool.free(b);
+}
+
+TEST_F(MemoryPoolTest, split)
+{
+  // a small request must not take a large cached block whole
+  void *big = pool.allocate(__func__, __FILE__, __LINE__, 64 * MiB);
+  pool.free(big);
+
+  void *small = pool.allocate(__func__, __FILE__, __LINE__, 2 * MiB);
+  EXPECT_EQ(pool.get_stats().n_slab_alloc, 1u);
+  EXPECT_EQ(pool.get_stats().live_bytes, 2 * MiB);
+  EXPECT_EQ(pool.get_stats().cached_bytes, 62 * MiB);
+
+  // the remainder serves the next request
+  void *rest = pool.allocate(__func__, __FILE__, __LINE__, 60 * MiB);
+  EXPECT_EQ(pool.get_stats().n_slab_alloc, 1u);
+  EXPECT_EQ(static_cast<char *>(rest), static_cast<char *>(small) + 2 * MiB);
+
+  pool.free(small);
+  pool.free(rest);
+}
+
+TEST_F(MemoryPoolTest, max_waste)
+{
+  void *a = pool.allocate(__func__, __FILE__, __LINE__, 8 * MiB);
+  pool.free(a);
+
+  // within the maximum waste ratio the block is handed out whole
+  void *b = pool.allocate(__func__, __FILE__, __LINE__, 7 * MiB);
+  EXPECT_EQ(pool.get_stats().n_split, 0u);
+  EXPECT_EQ(pool.get_stats().live_bytes, 8 * MiB);
+  EXPECT_EQ(pool.get_stats().requested_bytes, 7 * MiB);
+  EXPECT_DOUBLE_EQ(pool.get_stats().waste(), 1.0 / 8.0);
+  pool.free(b);
+
+  // beyond it the block is split
+  void *c = pool.allocate(__func__, __FILE__, __LINE__, 4 * MiB);
+  EXPECT_EQ(pool.get_stats().n_split, 1u);
+  EXPECT_EQ(pool.get_stats().live_bytes, 4 * MiB);
+  pool.free(c);
+}
+
+TEST_F(MemoryPoolTest, coalesce)
+{
+  // small requests share a slab
+  void *ptr[4];
+  for (auto &p : ptr) p = pool.allocate(__func__, __FILE__, __LINE__, 256 * 1024);
+  EXPECT_EQ(pool.get_stats().n_slab, 1u);
+  EXPECT_EQ(pool.get_stats().n_live, 4u);
+
+  // freeing alternate blocks fragments the free space
+  pool.free(ptr[0]);
+  pool.free(ptr[2]);
+  EXPECT_EQ(pool.get_stats().n_free, 3u);
+  EXPECT_GT(pool.get_stats().fragmentation(), 0.0);
+
+  // freeing the rest coalesces the slab into a single block
+  pool.free(ptr[1]);
+  pool.free(ptr[3]);
+  EXPECT_EQ(pool.get_stats().n_free, 1u);
+  EXPECT_EQ(pool.get_stats().largest_free_block, 2 * MiB);
+  EXPECT_DOUBLE_EQ(pool.get_stats().fragmentation(), 0.0);
+}
+
+TEST_F(MemoryPoolTest, grow)
+{
+  void *a = pool.allocate(__func__, __FILE__, __LINE__, MiB);
+  void *b = pool.allocate(__func__, __FILE__, __LINE__, 4 * MiB);
+  pool.free(b);
+
+  // a request that fits no cached block returns the free slabs before growing the pool
+  void *c = pool.allocate(__func__, __FILE__, __LINE__, 16 * MiB);
+  EXPECT_EQ(pool.get_stats().n_slab_alloc, 3u);
+  EXPECT_EQ(pool.get_stats().n_slab_free, 1u);
+  EXPECT_EQ(pool.get_stats().n_slab, 2u);
+  EXPECT_EQ(raw_alloc.size(), 2u);
+  EXPECT_EQ(pool.get_stats().peak_reserved_bytes, 18 * MiB);
+
+  pool.free(a);
+  pool.free(c);
+}
+
+TEST_F(MemoryPoolTest, churn)
+{
+  // repeated allocation patterns are served from the cache
+  for (int iter = 0; iter < 100; iter++) {
+    void *ptr[8];
+    for (int i = 0; i < 8; i++) ptr[i] = pool.allocate(__func__, __FILE__, __LINE__, (i + 1) * 300 * 1024);
+    for (int i = 0; i < 8; i++) pool.free(ptr[(3 * i) % 8]);
+  }
+  EXPECT_EQ(pool.get_stats().n_live, 0u);
+  EXPECT_EQ(pool.get_stats().n_alloc, 800u);
+  EXPECT_LE(pool.get_stats().n_slab_alloc, 8u);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
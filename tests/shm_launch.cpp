@@ -0,0 +1,120 @@
+/**
+   @file shm_launch.cpp
+
+   @brief Launch the processes of a job that uses the intra-node
+   shared-memory communications (QUDA_SHM=ON), e.g.,
+
+     shm_launch -n 4 ./invert_test --gridsize 1 1 2 2
+
+   Each process is started with QUDA_SHM_RANK, QUDA_SHM_SIZE and
+   QUDA_SHM_JOB set.  When a process fails the others are terminated,
+   and the shared-memory objects of the job are removed at the end,
+   such that none are left behind by processes that were killed.
+ */
+
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <dirent.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+static std::vector<pid_t> children;
+
+static void terminate_children(int signal)
+{
+  for (auto pid : children)
+    if (pid > 0) kill(pid, signal);
+}
+
+static void forward_signal(int signal) { terminate_children(signal); }
+
+static void usage(const char *name)
+{
+  fprintf(stderr, "Usage: %s -n <number of processes> <command> [arguments]\n", name);
+  exit(1);
+}
+
+/**
+   @brief Remove the shared-memory objects of a job
+ */
+static void cleanup(const std::string &job)
+{
+  const std::string prefix = "quda_shm_" + job;
+  DIR *dir = opendir("/dev/shm");
+  if (!dir) return;
+  while (dirent *entry = readdir(dir)) {
+    std::string name = entry->d_name;
+    if (name.compare(0, prefix.size(), prefix) == 0
+        && (name.size() == prefix.size() || name[prefix.size()] == '_'))
+      shm_unlink(("/" + name).c_str());
+  }
+  closedir(dir);
+}
+
+int main(int argc, char **argv)
+{
+  int n = 0;
+  int arg = 1;
+  while (arg < argc && argv[arg][0] == '-') {
+    if ((strcmp(argv[arg], "-n") == 0 || strcmp(argv[arg], "-np") == 0) && arg + 1 < argc) {
+      n = atoi(argv[arg + 1]);
+      arg += 2;
+    } else {
+      usage(argv[0]);
+    }
+  }
+  if (n < 1 || arg >= argc) usage(argv[0]);
+
+  const std::string job = std::to_string(getpid());
+  signal(SIGINT, forward_signal);
+  signal(SIGTERM, forward_signal);
+
+  children.resize(n, -1);
+  for (int rank = 0; rank < n; rank++) {
+    pid_t pid = fork();
+    if (pid < 0) {
+      fprintf(stderr, "shm_launch: fork failed: %s\n", strerror(errno));
+      terminate_children(SIGTERM);
+      break;
+    } else if (pid == 0) {
+      setenv("QUDA_SHM_RANK", std::to_string(rank).c_str(), 1);
+      setenv("QUDA_SHM_SIZE", std::to_string(n).c_str(), 1);
+      setenv("QUDA_SHM_JOB", job.c_str(), 1);
+      execvp(argv[arg], argv + arg);
+      fprintf(stderr, "shm_launch: unable to execute %s: %s\n", argv[arg], strerror(errno));
+      _exit(127);
+    }
+    children[rank] = pid;
+  }
+
+  // wait for all processes, terminating the others once one fails
+  int status = 0;
+  for (int remaining = n; remaining > 0; remaining--) {
+    int wstatus;
+    pid_t pid = wait(&wstatus);
+    if (pid < 0) {
+      if (errno == EINTR) {
+        remaining++;
+        continue;
+      }
+      break;
+    }
+    for (auto &child : children)
+      if (child == pid) child = -1;
+
+    int code = WIFEXITED(wstatus) ? WEXITSTATUS(wstatus) : 128 + WTERMSIG(wstatus);
+    if (code != 0 && status == 0) {
+      status = code;
+      terminate_children(SIGTERM);
+    }
+  }
+
+  cleanup(job);
+  return status;
+}
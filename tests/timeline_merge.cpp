@@ -0,0 +1,35 @@
+#include <string>
+#include <vector>
+
+#include <timeline.h>
+#include <comm_quda.h>
+#include <host_utils.h>
+#include <command_line_params.h>
+
+/**
+   Merge the per-process timelines written with QUDA_ENABLE_TIMELINE=1
+   (timeline_<rank>.json) into a single Chrome trace / Perfetto view,
+   with the processes aligned to a common epoch.
+ */
+int main(int argc, char **argv)
+{
+  std::vector<std::string> in_paths;
+  std::string out_path = "timeline.json";
+
+  auto app = make_app("Merge the per-process QUDA timelines into a single timeline");
+  app->add_option("--merged", out_path, "merged timeline to write (default timeline.json)");
+  app->add_option("timelines", in_paths, "timelines to merge")->required();
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  // initialize QMP/MPI and the QUDA comms grid (host_utils.cpp)
+  initComms(argc, argv, gridsize_from_cmdline);
+
+  if (quda::comm_rank() == 0) quda::timeline::merge(in_paths, out_path);
+
+  finalizeComms();
+  return 0;
+}
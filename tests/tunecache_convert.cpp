@@ -0,0 +1,34 @@
+#include <string>
+
+#include <tune_quda.h>
+#include <comm_quda.h>
+#include <host_utils.h>
+#include <command_line_params.h>
+
+/**
+   Convert a tunecache between the binary format (tunecache.bin) that
+   QUDA reads and appends to, and the text format (tunecache.tsv) that
+   is convenient for inspection and editing.  The format of the input
+   is detected from its contents.
+ */
+int main(int argc, char **argv)
+{
+  std::string in_path, out_path;
+
+  auto app = make_app("Convert a tunecache between the binary and text formats");
+  app->add_option("input", in_path, "tunecache to read")->required();
+  app->add_option("output", out_path, "tunecache to write")->required();
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  // initialize QMP/MPI and the QUDA comms grid (host_utils.cpp)
+  initComms(argc, argv, gridsize_from_cmdline);
+
+  if (quda::comm_rank() == 0) quda::convertTuneCache(in_path, out_path);
+
+  finalizeComms();
+  return 0;
+}
@@ -54,6 +54,11 @@ int niter = 100;
 int maxiter_precondition = 10;
 QudaVerbosity verbosity_precondition = QUDA_SUMMARIZE;
 int gcrNkrylov = 8;
+int recycle_max_dim = 0;
+std::string checkpoint_file;
+int checkpoint_interval = 0;
+int checkpoint_signal = 0;
+bool checkpoint_resume = false;
 QudaCABasis ca_basis = QUDA_CHEBYSHEV_BASIS;
 double ca_lambda_min = 0.0;
 double ca_lambda_max = -1.0;
@@ -335,7 +340,10 @@ namespace
                                                            {"ca-cg", QUDA_CA_CG_INVERTER},
                                                            {"ca-cgne", QUDA_CA_CGNE_INVERTER},
                                                            {"ca-cgnr", QUDA_CA_CGNR_INVERTER},
-                                                           {"ca-gcr", QUDA_CA_GCR_INVERTER}};
+                                                           {"ca-gcr", QUDA_CA_GCR_INVERTER},
+                                                           {"pipe-cg", QUDA_PIPE_CG_INVERTER},
+                                                           {"block-cg", QUDA_BLOCK_CG_INVERTER},
+                                                           {"gcrodr", QUDA_GCRODR_INVERTER}};
 
   CLI::TransformPairs<QudaPrecision> precision_map {{"double", QUDA_DOUBLE_PRECISION},
                                                     {"single", QUDA_SINGLE_PRECISION},
@@ -501,6 +509,16 @@ std::shared_ptr<QUDAApp> make_app(std::string app_description, std::string app_n
     "If a value N > 1 is passed, heavier masses will be constructed and the multi-shift solver will be called");
   quda_app->add_option("--ngcrkrylov", gcrNkrylov,
                        "The number of inner iterations to use for GCR, BiCGstab-l, CA-CG, CA-GCR (default 8)");
+  quda_app->add_option("--recycle-max-dim", recycle_max_dim,
+                       "The dimension of the recycled subspace kept between solves by GCRO-DR (default 0)");
+  quda_app->add_option("--checkpoint-file", checkpoint_file,
+                       "File to checkpoint the CG, GCR and BiCGstab solver state to (default none)");
+  quda_app->add_option("--checkpoint-interval", checkpoint_interval,
+                       "Minimum number of iterations between solver checkpoints (default 0, only on a signal)");
+  quda_app->add_option("--checkpoint-signal", checkpoint_signal,
+                       "Signal number that requests a solver checkpoint, e.g., 10 for SIGUSR1 (default 0, none)");
+  quda_app->add_option("--checkpoint-resume", checkpoint_resume,
+                       "Whether to resume the solver from the checkpoint file (default false)");
   quda_app->add_option("--niter", niter, "The number of iterations to perform (default 100)");
   quda_app->add_option("--max-res-increase", max_res_increase,
                        "The number of consecutive true residual incrases allowed (default 1)");
@@ -190,6 +190,11 @@ extern int niter;
 extern int maxiter_precondition;
 extern QudaVerbosity verbosity_precondition;
 extern int gcrNkrylov;
+extern int recycle_max_dim;
+extern std::string checkpoint_file;
+extern int checkpoint_interval;
+extern int checkpoint_signal;
+extern bool checkpoint_resume;
 extern QudaCABasis ca_basis;
 extern double ca_lambda_min;
 extern double ca_lambda_max;
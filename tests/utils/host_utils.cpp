@@ -319,6 +319,8 @@ void initRand()
   rank = QMP_get_node_number();
 #elif defined(MPI_COMMS)
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#elif defined(SHM_COMMS)
+  rank = quda::comm_rank_global();
 #endif
 
   srand(17 * rank + 137);
@@ -314,6 +314,9 @@ const char *get_solver_str(QudaInverterType type)
   case QUDA_CA_CGNE_INVERTER: ret = "ca_cgne"; break;
   case QUDA_CA_CGNR_INVERTER: ret = "ca_cgnr"; break;
   case QUDA_CA_GCR_INVERTER: ret = "ca_gcr"; break;
+  case QUDA_PIPE_CG_INVERTER: ret = "pipe_cg"; break;
+  case QUDA_BLOCK_CG_INVERTER: ret = "block_cg"; break;
+  case QUDA_GCRODR_INVERTER: ret = "gcrodr"; break;
   default:
     ret = "unknown";
     errorQuda("Error: invalid solver type %d\n", type);
@@ -188,6 +188,11 @@ void setInvertParam(QudaInvertParam &inv_param)
   inv_param.pipeline = pipeline;
   inv_param.Nsteps = 10;
   inv_param.gcrNkrylov = gcrNkrylov;
+  inv_param.recycle_max_dim = recycle_max_dim;
+  safe_strcpy(inv_param.checkpoint_file, checkpoint_file, 256, "checkpoint_file");
+  inv_param.checkpoint_interval = checkpoint_interval;
+  inv_param.checkpoint_signal = checkpoint_signal;
+  inv_param.checkpoint_resume = checkpoint_resume ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
   inv_param.ca_basis = ca_basis;
   inv_param.ca_lambda_min = ca_lambda_min;
   inv_param.ca_lambda_max = ca_lambda_max;
@@ -709,6 +714,10 @@ void setMultigridInvertParam(QudaInvertParam &inv_param)
   inv_param.inv_type_precondition = QUDA_MG_INVERTER;
   inv_param.pipeline = pipeline;
   inv_param.gcrNkrylov = gcrNkrylov;
+  safe_strcpy(inv_param.checkpoint_file, checkpoint_file, 256, "checkpoint_file");
+  inv_param.checkpoint_interval = checkpoint_interval;
+  inv_param.checkpoint_signal = checkpoint_signal;
+  inv_param.checkpoint_resume = checkpoint_resume ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
   inv_param.tol = tol;
 
   // require both L2 relative and heavy quark residual to determine convergence
@@ -855,6 +864,10 @@ void setStaggeredMGInvertParam(QudaInvertParam &inv_param)
 
   // Specify Krylov sub-size for GCR, BICGSTAB(L)
   inv_param.gcrNkrylov = gcrNkrylov;
+  safe_strcpy(inv_param.checkpoint_file, checkpoint_file, 256, "checkpoint_file");
+  inv_param.checkpoint_interval = checkpoint_interval;
+  inv_param.checkpoint_signal = checkpoint_signal;
+  inv_param.checkpoint_resume = checkpoint_resume ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
 
   // do we want full solution or single-parity solution
   inv_param.solution_type = QUDA_MAT_SOLUTION;
@@ -945,6 +958,11 @@ void setStaggeredInvertParam(QudaInvertParam &inv_param)
 
   // Specify Krylov sub-size for GCR, BICGSTAB(L), basis size for CA-CG, CA-GCR
   inv_param.gcrNkrylov = gcrNkrylov;
+  inv_param.recycle_max_dim = recycle_max_dim;
+  safe_strcpy(inv_param.checkpoint_file, checkpoint_file, 256, "checkpoint_file");
+  inv_param.checkpoint_interval = checkpoint_interval;
+  inv_param.checkpoint_signal = checkpoint_signal;
+  inv_param.checkpoint_resume = checkpoint_resume ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
 
   // Specify basis for CA-CG, CA-GCR, lambda min/max for Chebyshev basis
   //   lambda_max < lambda_max . use power iters to generate